@@ -12,11 +12,13 @@
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
 
 #include <sgpp/globaldef.hpp>
 
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -124,6 +126,122 @@ class AlgorithmMultipleEvaluation {
       }
     }
   }
+
+  /**
+   * Performs a mass evaluation for several coefficient vectors at once. The basis functions that
+   * are non-zero at a data point are determined once and used for all columns.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points, one column per coefficient vector
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix, one row per data point and one column per coefficient vector
+   */
+  void mult_block(GridStorage& storage, BASIS& basis, DataMatrix& source, DataMatrix& x,
+                  DataMatrix& result) {
+    result.setAll(0.0);
+    const size_t numPoints = x.getNrows();
+    const size_t numColumns = source.getNcols();
+
+#pragma omp parallel
+    {
+      DataVector line(x.getNcols());
+      std::vector<std::pair<size_t, double> > affected;
+      GetAffectedBasisFunctions<BASIS> getAffected(storage);
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < numPoints; i++) {
+        x.getRow(i, line);
+
+        if (!transformPointToUnitCube(storage, line)) {
+          continue;
+        }
+
+        getAffected(basis, line, affected);
+        double* resultRow = result.getPointer() + i * numColumns;
+
+        for (const std::pair<size_t, double>& entry : affected) {
+          const double* sourceRow = source.getPointer() + entry.first * numColumns;
+
+          for (size_t j = 0; j < numColumns; j++) {
+            resultRow[j] += entry.second * sourceRow[j];
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Performs a transposed mass evaluation for several vectors at once. The basis functions that
+   * are non-zero at a data point are determined once and used for all columns.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the values at the data points, one row per data point
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result matrix, one row per grid point and as many columns as source
+   */
+  void mult_transpose_block(GridStorage& storage, BASIS& basis, DataMatrix& source,
+                            DataMatrix& x, DataMatrix& result) {
+    result.setAll(0.0);
+    const size_t numPoints = x.getNrows();
+    const size_t numColumns = source.getNcols();
+
+#pragma omp parallel
+    {
+      DataMatrix privateResult(result.getNrows(), numColumns, 0.0);
+      DataVector line(x.getNcols());
+      std::vector<std::pair<size_t, double> > affected;
+      GetAffectedBasisFunctions<BASIS> getAffected(storage);
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < numPoints; i++) {
+        x.getRow(i, line);
+
+        if (!transformPointToUnitCube(storage, line)) {
+          continue;
+        }
+
+        getAffected(basis, line, affected);
+        const double* sourceRow = source.getPointer() + i * numColumns;
+
+        for (const std::pair<size_t, double>& entry : affected) {
+          double* resultRow = privateResult.getPointer() + entry.first * numColumns;
+
+          for (size_t j = 0; j < numColumns; j++) {
+            resultRow[j] += entry.second * sourceRow[j];
+          }
+        }
+      }
+
+#pragma omp critical
+      { result.add(privateResult); }
+    }
+  }
+
+ private:
+  /**
+   * Maps a point from the grid's bounding box to the unit cube.
+   *
+   * @param storage GridStorage object whose bounding box is used
+   * @param point the point, transformed in place
+   * @return false if the point lies outside the bounding box (then it does not contribute)
+   */
+  bool transformPointToUnitCube(GridStorage& storage, DataVector& point) {
+    BoundingBox* bb = storage.getBoundingBox();
+
+    for (size_t d = 0; d < point.getSize(); d++) {
+      if (!bb->isContainingPoint(d, point[d])) {
+        return false;
+      }
+
+      point[d] = bb->transformPointToUnitCube(d, point[d]);
+    }
+
+    return true;
+  }
 };
 
 }  // namespace base
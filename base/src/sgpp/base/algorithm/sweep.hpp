@@ -11,6 +11,11 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <iostream>
@@ -172,6 +177,71 @@ class sweep {
                        dim_sweep);
   }
 
+  /**
+   * Same as sweep1D(DataVector&, DataVector&, size_t), but the 1D poles are processed in chunks by
+   * OpenMP tasks. If this is called from within a parallel region (e.g. from the task-parallel
+   * up/down operators), the sweep itself is parallelized; otherwise, the tasks are executed
+   * immediately by the calling thread.
+   * Each task uses its own copy of the functor, so the functor must not modify shared state.
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1DParallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    std::vector<size_t> poles;
+    bool valid = true;
+
+    collect_rec(index, dim_list, storage.getDimension() - 1, poles, valid);
+
+    if (valid) {
+      sweep_poles(source, result, poles, dim_sweep);
+    } else {
+      sweep1D(source, result, dim_sweep);
+    }
+  }
+
+  /**
+   * Same as sweep1D_Boundary(DataVector&, DataVector&, size_t), but the 1D poles are processed in
+   * chunks by OpenMP tasks (see sweep1DParallel()).
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_BoundaryParallel(DataVector& source, DataVector& result,
+                                size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    index.resetToLevelZero();
+    std::vector<size_t> poles;
+    bool valid = true;
+
+    collect_Boundary_rec(index, dim_list, storage.getDimension() - 1, poles, valid);
+
+    if (valid) {
+      sweep_poles(source, result, poles, dim_sweep);
+    } else {
+      sweep1D_Boundary(source, result, dim_sweep);
+    }
+  }
+
  protected:
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep.
@@ -394,6 +464,137 @@ class sweep {
       }
     }
   }
+
+  /**
+   * Collects the sequence numbers of the starting points of all poles that sweep_rec() passes to
+   * the functor, in the same order.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles sequence numbers of the starting points of the poles
+   * @param valid is set to false if a starting point is not contained in the storage
+   */
+  void collect_rec(grid_iterator& index, std::vector<size_t>& dim_list, size_t dim_rem,
+                   std::vector<size_t>& poles, bool& valid) {
+    valid = valid && !storage.isInvalidSequenceNumber(index.seq());
+    poles.push_back(index.seq());
+
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collect_rec(index, dim_list, d + 1, poles, valid);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collect_rec(index, dim_list, d + 1, poles, valid);
+      }
+
+      index.up(current_dim);
+    }
+  }
+
+  /**
+   * Collects the sequence numbers of the starting points of all poles that sweep_Boundary_rec()
+   * passes to the functor, in the same order.
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles sequence numbers of the starting points of the poles
+   * @param valid is set to false if a starting point is not contained in the storage
+   */
+  void collect_Boundary_rec(grid_iterator& index, std::vector<size_t>& dim_list, size_t dim_rem,
+                            std::vector<size_t>& poles, bool& valid) {
+    if (dim_rem == 0) {
+      valid = valid && !storage.isInvalidSequenceNumber(index.seq());
+      poles.push_back(index.seq());
+    } else {
+      level_t current_level;
+      index_t current_index;
+
+      index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+      if (current_level > 0) {
+        collect_Boundary_rec(index, dim_list, dim_rem - 1, poles, valid);
+
+        if (!index.hint()) {
+          index.leftChild(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(index, dim_list, dim_rem, poles, valid);
+          }
+
+          index.stepRight(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(index, dim_list, dim_rem, poles, valid);
+          }
+
+          index.up(dim_list[dim_rem - 1]);
+        }
+      } else {
+        collect_Boundary_rec(index, dim_list, dim_rem - 1, poles, valid);
+
+        index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+        collect_Boundary_rec(index, dim_list, dim_rem - 1, poles, valid);
+
+        if (!index.hint()) {
+          index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collect_Boundary_rec(index, dim_list, dim_rem, poles, valid);
+          }
+        }
+
+        index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+      }
+    }
+  }
+
+  /**
+   * Applies the functor to the given poles. The poles are distributed to OpenMP tasks in chunks;
+   * since different poles do not share grid points, the tasks write to disjoint entries of result.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param poles sequence numbers of the starting points of the poles
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   */
+  void sweep_poles(DataVector& source, DataVector& result, std::vector<size_t>& poles,
+                   size_t dim_sweep) {
+    size_t numPoles = poles.size();
+    size_t numChunks = 1;
+#ifdef _OPENMP
+    numChunks = 8 * static_cast<size_t>(omp_get_num_threads());
+#endif
+    numChunks = std::max<size_t>(std::min(numChunks, numPoles), 1);
+
+    for (size_t chunk = 0; chunk < numChunks; chunk++) {
+#pragma omp task firstprivate(chunk) shared(source, result, poles)
+      {
+        FUNC chunkFunctor(functor);
+        grid_iterator index(storage);
+
+        for (size_t p = chunk * numPoles / numChunks; p < (chunk + 1) * numPoles / numChunks;
+             p++) {
+          index.set(storage.getPoint(poles[p]));
+          chunkFunctor(source, result, index, dim_sweep);
+        }
+      }
+    }
+
+#pragma omp taskwait
+  }
 };
 
 }  // namespace base
@@ -145,6 +145,80 @@ void DataMatrix::resizeQuadratic(size_t size) {
   this->operator=(std::move(newMatrix));
 }
 
+void DataMatrix::restructureRows(const std::vector<size_t>& remainingRows) {
+  // in place if each row is read before it is overwritten
+  bool inPlace = true;
+
+  for (size_t i = 0; i < remainingRows.size(); i++) {
+    inPlace = inPlace && (remainingRows[i] >= i);
+  }
+
+  if (inPlace) {
+    for (size_t i = 0; i < remainingRows.size(); i++) {
+      if (remainingRows[i] != i) {
+        std::copy(this->row_begin(remainingRows[i]), this->row_end(remainingRows[i]),
+                  this->row_begin(i));
+      }
+    }
+
+    this->resizeRows(remainingRows.size());
+    return;
+  }
+
+  DataMatrix newMatrix(remainingRows.size(), this->ncols);
+
+  for (size_t i = 0; i < remainingRows.size(); i++) {
+    std::copy(this->row_begin(remainingRows[i]), this->row_end(remainingRows[i]),
+              newMatrix.row_begin(i));
+  }
+
+  this->operator=(std::move(newMatrix));
+}
+
+void DataMatrix::restructureQuadratic(const std::vector<size_t>& remainingIndex) {
+  // Throw exception if matrix is not quadratic
+  if (this->nrows != this->ncols) {
+    throw sgpp::base::data_exception(
+        "DataMatrix::restructureQuadratic : DataMatrix is not quadratic");
+  }
+
+  const size_t size = remainingIndex.size();
+  bool inPlace = true;
+
+  for (size_t i = 0; i < size; i++) {
+    inPlace = inPlace && (remainingIndex[i] >= i);
+  }
+
+  if (inPlace) {
+    // entry (i, j) is read from position remainingIndex[i] * ncols + remainingIndex[j], which is
+    // not smaller than the position i * size + j it's written to
+    double* data = this->data();
+
+    for (size_t i = 0; i < size; i++) {
+      const double* oldRow = data + remainingIndex[i] * this->ncols;
+
+      for (size_t j = 0; j < size; j++) {
+        data[i * size + j] = oldRow[remainingIndex[j]];
+      }
+    }
+
+    this->nrows = size;
+    this->ncols = size;
+    this->std::vector<double>::resize(size * size);
+    return;
+  }
+
+  DataMatrix newMatrix(size, size);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      newMatrix(i, j) = (*this)(remainingIndex[i], remainingIndex[j]);
+    }
+  }
+
+  this->operator=(std::move(newMatrix));
+}
+
 void DataMatrix::resizeZero(size_t nrows) { this->resizeRows(nrows); }
 
 void DataMatrix::resizeZero(size_t nrows, size_t ncols) { this->resizeRowsCols(nrows, ncols); }
@@ -148,6 +148,24 @@ class DataMatrix : public std::vector<double> {
    */
   void resizeQuadratic(size_t size);
 
+  /**
+   * Keeps only the given rows: row i of the result is the old row remainingRows[i].
+   * If remainingRows[i] >= i for all i (e.g., for the mappings returned by
+   * HashGridStorage::compact), the rows are moved in place.
+   *
+   * @param remainingRows old indices of the remaining rows
+   */
+  void restructureRows(const std::vector<size_t>& remainingRows);
+
+  /**
+   * Keeps only the given rows and columns of the quadratic DataMatrix: entry (i, j) of the
+   * result is the old entry (remainingIndex[i], remainingIndex[j]). If remainingIndex[i] >= i
+   * for all i, the entries are moved in place.
+   *
+   * @param remainingIndex old indices of the remaining rows and columns
+   */
+  void restructureQuadratic(const std::vector<size_t>& remainingIndex);
+
   /**
    * Resizes the DataMatrix to nrows rows.
    * All new additional entries are set to zero.
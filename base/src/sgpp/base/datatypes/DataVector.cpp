@@ -108,6 +108,23 @@ DataVector DataVector::fromString(const std::string& serializedVector) {
 void DataVector::resizeZero(size_t size) { this->resize(size); }
 
 void DataVector::restructure(std::vector<size_t>& remainingIndex) {
+  // in place if each entry is read before it is overwritten, i.e., remainingIndex[i] >= i,
+  // which holds for the mappings of HashGridStorage::compact
+  bool inPlace = true;
+
+  for (size_t i = 0; i < remainingIndex.size(); i++) {
+    inPlace = inPlace && (remainingIndex[i] >= i);
+  }
+
+  if (inPlace) {
+    for (size_t i = 0; i < remainingIndex.size(); i++) {
+      (*this)[i] = (*this)[remainingIndex[i]];
+    }
+
+    this->resize(remainingIndex.size());
+    return;
+  }
+
   DataVector newVector;
   newVector.reserve(remainingIndex.size());
 
@@ -119,27 +136,28 @@ void DataVector::restructure(std::vector<size_t>& remainingIndex) {
 }
 
 void DataVector::remove(std::vector<size_t>& indexesToRemove) {
-  DataVector newVector;
   std::vector<bool> willBeRemoved(this->size(), false);
 
-  // Count the indexes to remove for the case when there are duplicates in indexesToRemove
-  size_t numIndexesToRemove = 0;
+  // duplicates in indexesToRemove are removed only once
   for (size_t i = 0; i < indexesToRemove.size(); i++) {
-    size_t idx = indexesToRemove[i];
-    if (!willBeRemoved[idx]) {
-      willBeRemoved[idx] = true;
-      numIndexesToRemove++;
+    if (indexesToRemove[i] >= this->size()) {
+      throw sgpp::base::data_exception("DataVector::remove : index out of range");
     }
+
+    willBeRemoved[indexesToRemove[i]] = true;
   }
 
-  newVector.reserve(this->size() - numIndexesToRemove);
+  // the remaining entries keep their order and are moved to the front in place
+  size_t newSize = 0;
+
   for (size_t i = 0; i < this->size(); i++) {
     if (!willBeRemoved[i]) {
-      newVector.emplace_back((*this)[i]);
+      (*this)[newSize] = (*this)[i];
+      newSize++;
     }
   }
 
-  *this = std::move(newVector);
+  this->resize(newSize);
 }
 
 size_t DataVector::append() { return this->append(0.0); }
@@ -107,14 +107,17 @@ class DataVector : public std::vector<double> {
 
   /**
    * Resizes the DataVector by removing entries. Throws an exception
-   * if boundaries a violated.
+   * if boundaries a violated. If remainingIndex[i] >= i for all i (e.g., for the mappings
+   * returned by HashGridStorage::compact), the entries are moved in place.
    *
    * @param remainingIndex vector that contains the remaining indices of the DataVector
    */
   void restructure(std::vector<size_t>& remainingIndex);
 
   /**
-   * Removes indexes form the vector. Throws an exception if the boundaries are violated
+   * Removes indexes form the vector. Throws an exception if the boundaries are violated.
+   * The remaining entries keep their order and are moved in place, like the payloads of a
+   * HashGridStorage::compact with the stable policy.
    *
    * @param indexesToRemove a vector if indexes that will be removed from the vector
    */
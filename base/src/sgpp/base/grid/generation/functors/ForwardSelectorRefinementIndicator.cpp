@@ -78,6 +78,10 @@ double ForwardSelectorRefinementIndicator::getRefinementThreshold() const {
   return threshold;
 }
 
+bool ForwardSelectorRefinementIndicator::isThreadSafe() const {
+  return true;
+}
+
 double ForwardSelectorRefinementIndicator::start() const { return 0.0; }
 
 double ForwardSelectorRefinementIndicator::operator()(GridPoint& point) const {
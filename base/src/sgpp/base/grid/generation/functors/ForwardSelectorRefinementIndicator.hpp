@@ -83,6 +83,13 @@ class ForwardSelectorRefinementIndicator : public RefinementFunctor {
    */
   double getRefinementThreshold() const override;
 
+  /**
+   * The evaluation only reads the state of the functor.
+   *
+   * @return true
+   */
+  bool isThreadSafe() const override;
+
   double start() const override;
 
   /**
@@ -96,6 +96,10 @@ double ImpurityRefinementIndicator::getRefinementThreshold() const {
   return threshold;
 }
 
+bool ImpurityRefinementIndicator::isThreadSafe() const {
+  return true;
+}
+
 double ImpurityRefinementIndicator::start() const { return 0.0; }
 
 double ImpurityRefinementIndicator::operator()(GridStorage& storage,
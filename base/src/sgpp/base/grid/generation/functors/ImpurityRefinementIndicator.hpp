@@ -87,6 +87,13 @@ class ImpurityRefinementIndicator : public RefinementFunctor {
    */
   double getRefinementThreshold() const override;
 
+  /**
+   * The evaluation only reads the state of the functor.
+   *
+   * @return true
+   */
+  bool isThreadSafe() const override;
+
   double start() const override;
 
   /**
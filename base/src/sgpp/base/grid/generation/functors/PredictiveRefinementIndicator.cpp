@@ -124,6 +124,10 @@ double PredictiveRefinementIndicator::getRefinementThreshold() const {
   return threshold;
 }
 
+bool PredictiveRefinementIndicator::isThreadSafe() const {
+  return true;
+}
+
 double PredictiveRefinementIndicator::start() const {
   return 0.0;
 }
@@ -71,6 +71,17 @@ class RefinementFunctor {
    */
   virtual double getRefinementThreshold() const = 0;
 
+  /**
+   * Returns whether operator() may be called concurrently from several threads, in which case
+   * the refinement scans the grid in parallel. Functors that only read their state during the
+   * evaluation may return true.
+   *
+   * @return whether the functor is thread safe. Default value: false.
+   */
+  virtual bool isThreadSafe() const {
+    return false;
+  }
+
   /**
    * Returns the total sum of local (error) indicators used for refinement
    *
@@ -39,5 +39,9 @@ double SurplusRefinementFunctor::getRefinementThreshold() const {
   return this->threshold;
 }
 
+bool SurplusRefinementFunctor::isThreadSafe() const {
+  return true;
+}
+
 }  // namespace base
 }  // namespace sgpp
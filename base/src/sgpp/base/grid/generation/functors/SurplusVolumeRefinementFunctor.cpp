@@ -39,5 +39,9 @@ double SurplusVolumeRefinementFunctor::getRefinementThreshold() const {
   return this->threshold;
 }
 
+bool SurplusVolumeRefinementFunctor::isThreadSafe() const {
+  return true;
+}
+
 }  // namespace base
 }  // namespace sgpp
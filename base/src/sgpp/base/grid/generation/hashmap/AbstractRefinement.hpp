@@ -11,12 +11,19 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <exception>
 #include <forward_list>
 #include <iosfwd>
 #include <vector>
 #include <unordered_map>
 #include <utility>
 #include <memory>
+#include <mutex>
 
 
 namespace sgpp {
@@ -85,6 +92,103 @@ class AbstractRefinement_refinement_key {
 };
 
 
+/***
+ * Plain record of a refinement candidate found while scanning the grid.
+ */
+struct AbstractRefinement_refinement_candidate {
+  /// sequential number of the grid point
+  size_t seq;
+  /// direction (for refinements along single directions, zero otherwise)
+  size_t dim;
+  /// refinement value
+  double value;
+};
+
+
+/***
+ * Min-heap of bounded size which keeps the refinement candidates with the largest values.
+ * Candidates with equal values are ordered by their sequential numbers and directions, hence
+ * the kept candidates don't depend on the order of insertion.
+ */
+class AbstractRefinement_candidate_heap {
+ public:
+  typedef AbstractRefinement_refinement_candidate candidate_type;
+
+  /***
+   * Constructor
+   *
+   * @param capacity maximal number of candidates to keep
+   */
+  explicit AbstractRefinement_candidate_heap(size_t capacity = 0) :
+    capacity(capacity), candidates() {
+  }
+
+
+  /***
+   * Offers a candidate, which is kept if it is among the capacity best ones.
+   *
+   * @param seq sequential number of the grid point
+   * @param dim direction
+   * @param value refinement value
+   */
+  void push(size_t seq, size_t dim, double value) {
+    const candidate_type candidate = {seq, dim, value};
+
+    if (candidates.size() < capacity) {
+      if (candidates.empty()) {
+        // allocate on the first push, i.e., by the thread which owns the heap
+        candidates.reserve(capacity);
+      }
+
+      candidates.push_back(candidate);
+      std::push_heap(candidates.begin(), candidates.end(), isBetter);
+    } else if ((capacity > 0) && isBetter(candidate, candidates.front())) {
+      // replace the top (worst) element
+      std::pop_heap(candidates.begin(), candidates.end(), isBetter);
+      candidates.back() = candidate;
+      std::push_heap(candidates.begin(), candidates.end(), isBetter);
+    }
+  }
+
+
+  /***
+   * Offers all candidates of another heap.
+   *
+   * @param other heap
+   */
+  void merge(const AbstractRefinement_candidate_heap& other) {
+    for (const candidate_type& candidate : other.candidates) {
+      push(candidate.seq, candidate.dim, candidate.value);
+    }
+  }
+
+
+  /***
+   * Sorts the candidates (best first), the heap must not be used afterwards.
+   *
+   * @return sorted candidates
+   */
+  std::vector<candidate_type>& sort() {
+    std::sort_heap(candidates.begin(), candidates.end(), isBetter);
+    return candidates;
+  }
+
+ private:
+  static bool isBetter(const candidate_type& lhs, const candidate_type& rhs) {
+    if (lhs.value != rhs.value) {
+      return lhs.value > rhs.value;
+    } else if (lhs.seq != rhs.seq) {
+      return lhs.seq < rhs.seq;
+    } else {
+      return lhs.dim < rhs.dim;
+    }
+  }
+
+  size_t capacity;
+  std::vector<candidate_type> candidates;
+};
+
+
 /**
  * Abstract refinement class for sparse grids
  */
@@ -113,6 +217,18 @@ class AbstractRefinement {
   refinement_list_type;
 
 
+  /**
+   * Plain record of a refinement candidate (sequential number, direction and value)
+   */
+  typedef AbstractRefinement_refinement_candidate refinement_candidate_type;
+
+
+  /**
+   * Bounded heap of the best refinement candidates
+   */
+  typedef AbstractRefinement_candidate_heap refinement_candidate_heap_type;
+
+
   /**
    * Comparison of the refinement_pair_type. This way the priority queue
    * has the elements with the smallest refinement_value_type on top
@@ -305,6 +421,102 @@ class AbstractRefinement {
     const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const = 0;
 
+  /**
+   * Scans all grid points and collects the numCandidates candidates with the largest values.
+   * If the functor is thread safe, the grid points are scanned by all OpenMP threads, each of
+   * which keeps its own bounded heap of plain records; the heaps are merged at the end. The
+   * indicator gets a copy of the grid point, which it may modify, its sequential number and the
+   * heap of the thread, to which it pushes the candidates of the grid point:
+   * indicator(GridPoint& point, size_t seq, refinement_candidate_heap_type& heap).
+   * The first exception thrown by the indicator is rethrown after the scan.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param functor refinement functor (decides whether the scan may be parallel)
+   * @param numCandidates maximal number of candidates
+   * @param indicator computes the candidates of a grid point
+   * @return candidates with the largest values (largest value first)
+   */
+  template <class INDICATOR>
+  static std::vector<refinement_candidate_type> collectCandidates(
+    GridStorage& storage, const RefinementFunctor& functor, size_t numCandidates,
+    INDICATOR indicator) {
+    const size_t size = storage.getSize();
+    std::vector<refinement_candidate_heap_type> heaps;
+    std::once_flag onceFlag;
+    std::exception_ptr exceptionPtr;
+
+    #pragma omp parallel if (functor.isThreadSafe())
+    {
+      size_t threadId = 0;
+      size_t numThreads = 1;
+#ifdef _OPENMP
+      threadId = omp_get_thread_num();
+      numThreads = omp_get_num_threads();
+#endif
+
+      #pragma omp single
+      heaps.assign(numThreads, refinement_candidate_heap_type(numCandidates));
+
+      refinement_candidate_heap_type& heap = heaps[threadId];
+      GridPoint point(storage.getDimension());
+
+      #pragma omp for schedule(dynamic, 256)
+      for (size_t seq = 0; seq < size; seq++) {
+        try {
+          point = storage.getPoint(seq);
+          indicator(point, seq, heap);
+        } catch (...) {
+          // exceptions must not leave the parallel region, store the first one for rethrow
+          std::call_once(onceFlag, [&]() { exceptionPtr = std::current_exception(); });
+        }
+      }
+    }
+
+    if (exceptionPtr) {
+      std::rethrow_exception(exceptionPtr);
+    }
+
+    for (size_t i = 1; i < heaps.size(); i++) {
+      heaps[0].merge(heaps[i]);
+    }
+
+    return std::move(heaps[0].sort());
+  }
+
+
+  /**
+   * Checks whether at least one child of a grid point is missing.
+   *
+   * @param storage hashmap that stores the grid points
+   * @param point grid point (restored before returning)
+   * @return whether a child is missing
+   */
+  static bool hasMissingChild(GridStorage& storage, GridPoint& point) {
+    for (size_t d = 0; d < storage.getDimension(); d++) {
+      index_t source_index;
+      level_t source_level;
+      point.get(d, source_level, source_index);
+
+      // test existence of the left and the right child
+      point.set(d, source_level + 1, 2 * source_index - 1);
+      bool missing = !storage.isContaining(point);
+
+      if (!missing) {
+        point.set(d, source_level + 1, 2 * source_index + 1);
+        missing = !storage.isContaining(point);
+      }
+
+      // reset current grid point in dimension d
+      point.set(d, source_level, source_index);
+
+      if (missing) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
   friend class
   // need to be a friend since it delegates the calls to
   // protected class methods
@@ -23,7 +23,8 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
                                              size_t numFirstPoints,
                                              size_t minIndexConsidered,
                                              std::vector<HashGridPoint>* removedPoints,
-                                             std::vector<size_t>* removedSeq) {
+                                             std::vector<size_t>* removedSeq,
+                                             CompactionPolicy policy) {
   // check if the grid has any points
   if (storage.getSize() == 0) {
     throw generation_exception("storage empty");
@@ -57,16 +58,7 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
   // also assure, that indices bigger than minIndexConsidered are not checked
   for (size_t z = minIndexConsidered; z < numFirstPoints; z++) {
     GridPoint& point = storage.getPoint(z);
-    std::cout << "(";
-    for (size_t d = 0; d < point.getDimension(); d++) {
-        std::cout << point.getStandardCoordinate(d);
-        if (d != point.getDimension()-1) {
-            std::cout << ",";
-        } else 
-        {
-            std::cout << ")";
-        }
-    }
+
     if (point.isLeaf()) {
       // auto start = std::chrono::system_clock::now();
       CoarseningFunctor::value_type current_value = functor(storage, z);
@@ -88,21 +80,9 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
           }
         }
       }
-    } else
-    {
-        std::cout<<";NaN;NaN;NaN"<<std::endl;
     }
   }
 
-  // DEBUG : print list of removable candidates
-  std::cout << "list of removable candidates:\n";
-  for (size_t i = 0; i < remove_num; i++) {
-    std::cout << "Index: " << removeCandidates[i].first << " with surplus " <<
-    removeCandidates[i].second
-              << std::endl;
-  }
-  std::cout << std::endl;
-
   // remove the marked grid point if their surplus
   // is below the given threshold
   CoarseningFunctor::value_type threshold = functor.getCoarseningThreshold();
@@ -120,7 +100,6 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
   for (size_t i = 0; i < remove_num; i++) {
     if (removeCandidates[i].second < initValue && removeCandidates[i].second <= threshold) {
       localRemovedPoints.push_back(removeCandidates[i].first);
-      std::cout << "This candidate has score:" << removeCandidates[i].second << std::endl;
       if (removedPoints != 0) {
         removedPoints->push_back(GridPoint(storage.getPoint(removeCandidates[i].first)));
       }
@@ -130,29 +109,8 @@ void HashCoarsening::free_coarsen_NFirstOnly(GridStorage& storage,
     }
   }
 
-  // DEBUG : print list points to delete
-
-
-
-  // For some reason HashGridStorage expects a std::list and not a vector D:
-  std::list<size_t> removedPointsList(localRemovedPoints.begin(),
-                                      localRemovedPoints.end());
-  std::cout << "list of points to delete:\n";
-  for (auto i:removedPointsList){
-      std::cout << i << ",";
-  }
-  std::cout << std::endl;
-  remainingIndex = storage.deletePoints(removedPointsList);
-
-  // DEBUG
-  // std::cout << "List of remaining GridPoints (indices)" << std::endl;
-  // for (size_t i = 0; i < remainingIndex.size(); i++)
-  // {
-  //   std::cout << remainingIndex[i] << " ";
-  // }
-  // std::cout << std::endl << std::endl;
-
-  // Drop Elements from DataVector
+  // remove the points in place and drop the corresponding elements from the DataVector
+  remainingIndex = storage.compact(localRemovedPoints, policy);
   alpha.restructure(remainingIndex);
 
   delete[] removeCandidates;
@@ -162,8 +120,10 @@ void HashCoarsening::free_coarsen(GridStorage& storage,
                                   CoarseningFunctor& functor,
                                   DataVector& alpha,
                                   std::vector<HashGridPoint>* removedPoints,
-                                  std::vector<size_t>* removedSeq) {
-  free_coarsen_NFirstOnly(storage, functor, alpha, storage.getSize(), 0, removedPoints, removedSeq);
+                                  std::vector<size_t>* removedSeq,
+                                  CompactionPolicy policy) {
+  free_coarsen_NFirstOnly(storage, functor, alpha, storage.getSize(), 0, removedPoints, removedSeq,
+                          policy);
 }
 
 
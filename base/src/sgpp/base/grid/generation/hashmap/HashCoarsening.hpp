@@ -47,6 +47,7 @@ class HashCoarsening {
    * parameter to be allowed to get coarsened
    * @param removedPoints pointer to vector to append coarsened (removed) grid points to
    * @param removedSeq pointer to vector to append the seq numbers of coarsened grid points to
+   * @param policy how the remaining grid points are moved into the holes of the removed ones
    */
   void free_coarsen_NFirstOnly(GridStorage& storage,
                                CoarseningFunctor& functor,
@@ -54,7 +55,8 @@ class HashCoarsening {
                                size_t numFirstPoints,
                                size_t minIndexConsidered = 0,
                                std::vector<HashGridPoint>* removedPoints = 0,
-                               std::vector<size_t>* removedSeq = 0);
+                               std::vector<size_t>* removedSeq = 0,
+                               CompactionPolicy policy = CompactionPolicy::Stable);
 
   /**
    * Performs coarsening on grid. It's possible to remove a certain number
@@ -76,12 +78,14 @@ class HashCoarsening {
    * this vector
    * @param removedPoints pointer to vector to append coarsened (removed) grid points to
    * @param removedSeq pointer to vector to append the seq numbers of coarsened grid points to.
+   * @param policy how the remaining grid points are moved into the holes of the removed ones
    */
   void free_coarsen(GridStorage& storage,
                     CoarseningFunctor& functor,
                     DataVector& alpha,
                     std::vector<HashGridPoint>* removedPoints = 0,
-                    std::vector<size_t>* removedSeq = 0);
+                    std::vector<size_t>* removedSeq = 0,
+                    CompactionPolicy policy = CompactionPolicy::Stable);
 
   /**
    * Calculates the number of points, which can be refined
@@ -16,82 +16,26 @@
 namespace sgpp {
 namespace base {
 
-void HashRefinement::addElementToCollection(
-  const GridStorage::grid_map_iterator& iter,
-  AbstractRefinement::refinement_list_type current_value_list,
-  size_t refinements_num,
-  AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
-         current_value_list.begin();
-       it != current_value_list.end(); it++) {
-    collection.push_back(*it);
-    std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
-
-
-    if (collection.size() > refinements_num) {
-      // remove the top (smallest) element
-      std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
-      collection.pop_back();
-    }
-  }
-}
-
-
 void HashRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinements_num = functor.getRefinementsNum();
-
-  // max value equals min value
-
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
-    }
+  // check for each grid point whether it can be refined
+  // (i.e., whether not all kids exist yet)
+  // if yes, check whether it belongs to the refinements_num largest ones
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [&storage, &functor](GridPoint& point, size_t seq,
+                           AbstractRefinement::refinement_candidate_heap_type& heap) {
+        if (hasMissingChild(storage, point)) {
+          heap.push(seq, 0, functor(storage, seq));
+        }
+      });
+
+  // keys are only created for the selected grid points
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(std::make_shared<AbstractRefinement::refinement_key_type>(
+                              storage.getPoint(candidate.seq), candidate.seq),
+                            candidate.value);
   }
 }
 
@@ -147,50 +91,26 @@ void HashRefinement::free_refine(GridStorage& storage,
 }
 
 size_t HashRefinement::getNumberOfRefinablePoints(GridStorage& storage) {
-  size_t counter = 0;
-
   if (storage.getSize() == 0) {
     throw generation_exception("storage empty");
   }
 
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all children exist yet)
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
+  const size_t size = storage.getSize();
+  size_t counter = 0;
 
-      // test existence of the left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
+  // check for each grid point whether it can be refined
+  // (i.e., whether not all children exist yet)
+  #pragma omp parallel reduction(+ : counter)
+  {
+    GridPoint point(storage.getDimension());
 
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        counter++;
-        break;
-      }
+    #pragma omp for schedule(dynamic, 256)
+    for (size_t seq = 0; seq < size; seq++) {
+      point = storage.getPoint(seq);
 
-      // test existence of the right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
+      if (hasMissingChild(storage, point)) {
         counter++;
-        break;
       }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
     }
   }
 
@@ -16,29 +16,49 @@
 namespace sgpp {
 namespace base {
 
+namespace {
+
+/**
+ * Checks whether at least one child of a grid point is missing, where points on level 0 only
+ * have the child on level 1.
+ *
+ * @param storage hashmap that stores the grid points
+ * @param point grid point (restored before returning)
+ * @return whether a child is missing
+ */
+bool hasMissingBoundaryChild(GridStorage& storage, GridPoint& point) {
+  for (size_t d = 0; d < storage.getDimension(); d++) {
+    index_t source_index;
+    level_t source_level;
+    point.get(d, source_level, source_index);
+    bool missing;
 
-void HashRefinementBoundaries::addElementToCollection(
-  const GridStorage::grid_map_iterator& iter,
-  AbstractRefinement::refinement_list_type current_value_list,
-  size_t refinements_num,
-  AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
-         current_value_list.begin();
-       it != current_value_list.end(); it++) {
-    collection.push_back(*it);
-    std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
-
-
-    if (collection.size() > refinements_num) {
-      // remove the top (smallest) element
-      std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
-      collection.pop_back();
+    if (source_level == 0) {
+      // we only have one child on level 1
+      point.set(d, 1, 1);
+      missing = !storage.isContaining(point);
+    } else {
+      // left and right child
+      point.set(d, source_level + 1, 2 * source_index - 1);
+      missing = !storage.isContaining(point);
+
+      if (!missing) {
+        point.set(d, source_level + 1, 2 * source_index + 1);
+        missing = !storage.isContaining(point);
+      }
+    }
+
+    point.set(d, source_level, source_index);
+
+    if (missing) {
+      return true;
     }
   }
+
+  return false;
 }
 
+}  // namespace
 
 AbstractRefinement::refinement_list_type HashRefinementBoundaries::getIndicator(
   GridStorage& storage,
@@ -56,65 +76,21 @@ AbstractRefinement::refinement_list_type HashRefinementBoundaries::getIndicator(
 void HashRefinementBoundaries::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-
-  size_t refinements_num = functor.getRefinementsNum();
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
   // I think this may be dependent on local support
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      if (source_level == 0) {
-        // we only have one child on level 1
-        point.set(d, 1, 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-      } else {
-        // left child
-        point.set(d, source_level + 1, 2 * source_index - 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [&storage, &functor](GridPoint& point, size_t seq,
+                           AbstractRefinement::refinement_candidate_heap_type& heap) {
+        if (hasMissingBoundaryChild(storage, point)) {
+          heap.push(seq, 0, functor(storage, seq));
         }
+      });
 
-        // right child
-        point.set(d, source_level + 1, 2 * source_index + 1);
-        child_iter = storage.find(&point);
-
-        if (child_iter == end_iter) {
-          AbstractRefinement::refinement_list_type current_value_list =
-            getIndicator(storage, iter, functor);
-          addElementToCollection(iter, current_value_list, refinements_num,
-                                 collection);
-          break;
-        }
-      }
-
-      point.set(d, source_level, source_index);
-    }
+  // keys are only created for the selected grid points
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(std::make_shared<AbstractRefinement::refinement_key_type>(
+                              storage.getPoint(candidate.seq), candidate.seq),
+                            candidate.value);
   }
 }
 
@@ -160,59 +136,25 @@ void HashRefinementBoundaries::free_refine(GridStorage& storage,
 
 size_t HashRefinementBoundaries::getNumberOfRefinablePoints(
   GridStorage& storage) {
-  size_t counter = 0;
-
   if (storage.getSize() == 0) {
     throw generation_exception("storage empty");
   }
 
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
+  const size_t size = storage.getSize();
+  size_t counter = 0;
 
   // I think this may be dependent on local support
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    GridStorage::grid_map_iterator child_iter;
-
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      if (source_level == 0) {
-        // level 1
-        point.set(d, 1, 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          counter++;
-          break;
-        }
-      } else {
-        // left child
-        point.set(d, source_level + 1, 2 * source_index - 1);
-        child_iter = storage.find(&point);
-
-        // if there no more grid points --> test if we should refine the grid
-        if (child_iter == end_iter) {
-          counter++;
-          break;
-        }
+  #pragma omp parallel reduction(+ : counter)
+  {
+    GridPoint point(storage.getDimension());
 
-        // right child
-        point.set(d, source_level + 1, 2 * source_index + 1);
-        child_iter = storage.find(&point);
+    #pragma omp for schedule(dynamic, 256)
+    for (size_t seq = 0; seq < size; seq++) {
+      point = storage.getPoint(seq);
 
-        if (child_iter == end_iter) {
-          counter++;
-          break;
-        }
+      if (hasMissingBoundaryChild(storage, point)) {
+        counter++;
       }
-
-      point.set(d, source_level, source_index);
     }
   }
 
@@ -124,23 +124,8 @@ class HashRefinementBoundaries: public AbstractRefinement {
     AbstractRefinement::refinement_container_type& collection) override;
 
   /**
-  * Adds elements to the collection. This method is responsible for selection
-  * the elements with most important indicators and to limit the size of collection
-  * to refinements_num elements.
-  *
-  * @param iter storage iterator
-  * @param current_value_list list with elements that contain keys and values that specify refinement
-  * @param refinements_num number of elements to refine
-  * @param collection container where element pairs for refinement need to be stored
-  */
-  virtual void addElementToCollection(
-    const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
-    size_t refinements_num,
-    AbstractRefinement::refinement_container_type& collection);
-
-  /**
-  * Generates a list with indicator elements
+  * Generates a list with indicator elements (the value of the functor), which is used by
+  * decorators like SubspaceRefinement
   *
   * @param storage grid storage
   * @param iter iterator
@@ -46,69 +46,56 @@ void HashRefinementInteraction::createGridpoint(GridStorage& storage, GridPoint&
 void HashRefinementInteraction::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinements_num = functor.getRefinementsNum();
-
-  // max value equals min value
-
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-
-    // get the boolean interactions of current point
-    auto coordsIndex = std::vector<bool>(storage.getDimension());
-    for (size_t i = 0; i < storage.getDimension(); ++i) {
-      coordsIndex[i] = point.getStandardCoordinate(i) != 0.5;
-    }
-
-    GridStorage::grid_map_iterator child_iter;
-
-    // check for each grid point whether it can be refined
-    // (i.e., whether not all kids exist yet)
-    // if yes, check whether it belongs to the refinements_num largest ones
-    for (size_t d = 0; d < storage.getDimension(); d++) {
-      auto tmpCoord = coordsIndex[d];
-      coordsIndex[d] = 1;
-      // point isnt included in interactionterms
-      if (interactions.find(coordsIndex) == interactions.end()) {
-        coordsIndex[d] = tmpCoord;
-        break;
-      }
-      index_t source_index;
-      level_t source_level;
-      point.get(d, source_level, source_index);
-
-      // test existence of left child
-      point.set(d, source_level + 1, 2 * source_index - 1);
-      child_iter = storage.find(&point);
-
-      // if there no more grid points --> test if we should refine the grid
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // test existence of right child
-      point.set(d, source_level + 1, 2 * source_index + 1);
-      child_iter = storage.find(&point);
-
-      if (child_iter == end_iter) {
-        AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-        addElementToCollection(iter, current_value_list, refinements_num,
-                               collection);
-        break;
-      }
-
-      // reset current grid point in dimension d
-      point.set(d, source_level, source_index);
-    }
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [this, &storage, &functor](GridPoint& point, size_t seq,
+                                 AbstractRefinement::refinement_candidate_heap_type& heap) {
+        // get the boolean interactions of current point
+        auto coordsIndex = std::vector<bool>(storage.getDimension());
+        for (size_t i = 0; i < storage.getDimension(); ++i) {
+          coordsIndex[i] = point.getStandardCoordinate(i) != 0.5;
+        }
+
+        // check for each grid point whether it can be refined
+        // (i.e., whether not all kids exist yet)
+        // if yes, check whether it belongs to the refinements_num largest ones
+        for (size_t d = 0; d < storage.getDimension(); d++) {
+          auto tmpCoord = coordsIndex[d];
+          coordsIndex[d] = 1;
+          // point isnt included in interactionterms
+          if (interactions.find(coordsIndex) == interactions.end()) {
+            coordsIndex[d] = tmpCoord;
+            break;
+          }
+          index_t source_index;
+          level_t source_level;
+          point.get(d, source_level, source_index);
+
+          // test existence of left and right child
+          point.set(d, source_level + 1, 2 * source_index - 1);
+          bool missing = !storage.isContaining(point);
+
+          if (!missing) {
+            point.set(d, source_level + 1, 2 * source_index + 1);
+            missing = !storage.isContaining(point);
+          }
+
+          // if there no more grid points --> test if we should refine the grid
+          if (missing) {
+            heap.push(seq, 0, functor(storage, seq));
+            break;
+          }
+
+          // reset current grid point in dimension d
+          point.set(d, source_level, source_index);
+        }
+      });
+
+  // keys are only created for the selected grid points
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(std::make_shared<AbstractRefinement::refinement_key_type>(
+                              storage.getPoint(candidate.seq), candidate.seq),
+                            candidate.value);
   }
 }
 }  // namespace base
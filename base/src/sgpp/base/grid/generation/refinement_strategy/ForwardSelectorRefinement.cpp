@@ -10,119 +10,70 @@
 
 #include <iterator>
 #include <list>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
 namespace base {
 
+void ForwardSelectorRefinement::pushCandidates(
+    GridStorage& storage, const ForwardSelectorRefinementIndicator& svmIndicator,
+    GridPoint& point, size_t seq,
+    AbstractRefinement::refinement_candidate_heap_type& heap) const {
+  // leaves and points with missing children are refinable
+  if (point.isLeaf() || hasMissingChild(storage, point)) {
+    double measure = 1.0 / svmIndicator(storage, seq);
+
+    if (measure > svmIndicator.getRefinementThreshold()) {
+      heap.push(seq, 0, measure);
+    }
+  }
+}
+
 void ForwardSelectorRefinement::collectRefinablePoints(
     GridStorage& storage, RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinementsNum = functor.getRefinementsNum();
-
-  GridStorage::grid_map_iterator end_iter = storage.end();
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    AbstractRefinement::refinement_list_type current_value_list =
-        getIndicator(storage, iter, functor);
-    addElementToCollection(iter, current_value_list, refinementsNum,
-                           collection);
+  const ForwardSelectorRefinementIndicator& svmIndicator =
+      dynamic_cast<const ForwardSelectorRefinementIndicator&>(functor);
+
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [this, &storage, &svmIndicator](
+          GridPoint& point, size_t seq,
+          AbstractRefinement::refinement_candidate_heap_type& heap) {
+        pushCandidates(storage, svmIndicator, point, seq, heap);
+      });
+
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(
+        std::make_shared<refinement_key_type>(storage.getPoint(candidate.seq), candidate.seq,
+                                              candidate.dim),
+        candidate.value);
   }
 }
 
-AbstractRefinement::refinement_list_type
-ForwardSelectorRefinement::getIndicator(
+AbstractRefinement::refinement_list_type ForwardSelectorRefinement::getIndicator(
     GridStorage& storage, const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const {
-  AbstractRefinement::refinement_list_type list;
-
   // this refinement algorithm uses the forward selector refinement indicator
   // (combined-measure, according to König BA)
   const ForwardSelectorRefinementIndicator& svmIndicator =
       dynamic_cast<const ForwardSelectorRefinementIndicator&>(functor);
-  refinement_key_type* key;
-
-  GridPoint& point = *(iter->first);
-  GridStorage::grid_map_iterator child_iter;
-
-  double threshold = svmIndicator.getRefinementThreshold();
-  bool isRefinablePoint = false;
-
-  if (point.isLeaf()) {
-    isRefinablePoint = true;
-  }
 
-  for (size_t d = 0; d < storage.getDimension(); d++) {
-    index_t source_index;
-    level_t source_level;
-    point.get(d, source_level, source_index);
+  GridPoint point(*(iter->first));
+  AbstractRefinement::refinement_candidate_heap_type heap(1);
+  pushCandidates(storage, svmIndicator, point, iter->second, heap);
 
-    // test existence of left child
-    point.set(d, source_level + 1, 2 * source_index - 1);
-    child_iter = storage.find(&point);
-
-    // if child does not exist -> check indicator
-    if (child_iter == storage.end()) {
-      isRefinablePoint = true;
-      point.set(d, source_level, source_index);
-      break;
-    }
-
-    // test existance of right child
-    point.set(d, source_level + 1, 2 * source_index + 1);
-    child_iter = storage.find(&point);
-
-    // if child does not exist -> check indicator
-    if (child_iter == storage.end()) {
-      isRefinablePoint = true;
-      point.set(d, source_level, source_index);
-      break;
-    }
-
-    // reset current grid point in dimension d
-    point.set(d, source_level, source_index);
-  }
+  AbstractRefinement::refinement_list_type list;
 
-  if (isRefinablePoint) {
-    // std::cout << "refinable point: " << storage.getSequenceNumber(point) <<
-    // std::endl;
-    double measure =
-        1.0 / svmIndicator(storage, storage.getSequenceNumber(point));
-
-    if (measure > threshold) {
-      size_t d = 0;
-      key = new refinement_key_type(point, storage.getSequenceNumber(point), d);
-      list.emplace_front(
-          std::shared_ptr<AbstractRefinement::refinement_key_type>(key),
-          measure);
-    }
+  for (const AbstractRefinement::refinement_candidate_type& candidate : heap.sort()) {
+    list.emplace_front(std::make_shared<refinement_key_type>(point, candidate.seq, candidate.dim),
+                       candidate.value);
   }
 
   return list;
 }
 
-void ForwardSelectorRefinement::addElementToCollection(
-    const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
-    size_t refinementsNum,
-    AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
-           current_value_list.begin();
-       it != current_value_list.end(); it++) {
-    collection.push_back(*it);
-    std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
-
-    if (collection.size() > refinementsNum) {
-      // remove the top (biggest) element
-      std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
-      collection.pop_back();
-    }
-  }
-}
-
 void ForwardSelectorRefinement::refineGridpointsCollection(
     GridStorage& storage, RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
@@ -10,117 +10,70 @@
 
 #include <iterator>
 #include <list>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
 namespace base {
 
+void ImpurityRefinement::pushCandidates(
+    GridStorage& storage, const ImpurityRefinementIndicator& impurityIndicator,
+    GridPoint& point, size_t seq,
+    AbstractRefinement::refinement_candidate_heap_type& heap) const {
+  // leaves and points with missing children are refinable
+  if (point.isLeaf() || hasMissingChild(storage, point)) {
+    // evaluate indicator
+    double impurity = impurityIndicator(point);
+
+    if (impurity > impurityIndicator.getRefinementThreshold()) {
+      heap.push(seq, 0, impurity);
+    }
+  }
+}
+
 void ImpurityRefinement::collectRefinablePoints(
     GridStorage& storage, RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinementsNum = functor.getRefinementsNum();
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    AbstractRefinement::refinement_list_type current_value_list =
-        getIndicator(storage, iter, functor);
-    addElementToCollection(iter, current_value_list, refinementsNum,
-                           collection);
+  const ImpurityRefinementIndicator& impurityIndicator =
+      dynamic_cast<const ImpurityRefinementIndicator&>(functor);
+
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [this, &storage, &impurityIndicator](
+          GridPoint& point, size_t seq,
+          AbstractRefinement::refinement_candidate_heap_type& heap) {
+        pushCandidates(storage, impurityIndicator, point, seq, heap);
+      });
+
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(
+        std::make_shared<refinement_key_type>(storage.getPoint(candidate.seq), candidate.seq,
+                                              candidate.dim),
+        candidate.value);
   }
 }
 
 AbstractRefinement::refinement_list_type ImpurityRefinement::getIndicator(
     GridStorage& storage, const GridStorage::grid_map_iterator& iter,
     const RefinementFunctor& functor) const {
-  AbstractRefinement::refinement_list_type list;
-
   // this refinement algorithm uses the impurity refinement indicator
   const ImpurityRefinementIndicator& impurityIndicator =
       dynamic_cast<const ImpurityRefinementIndicator&>(functor);
-  refinement_key_type* key;
-
-  GridPoint& point = *(iter->first);
-  GridStorage::grid_map_iterator child_iter;
-
-  double threshold = impurityIndicator.getRefinementThreshold();
-  bool isRefinablePoint = false;
-
-  if (point.isLeaf()) {
-    isRefinablePoint = true;
-  }
-
-  for (size_t d = 0; d < storage.getDimension(); d++) {
-    index_t source_index;
-    level_t source_level;
-    point.get(d, source_level, source_index);
-
-    // test existence of left child
-    point.set(d, source_level + 1, 2 * source_index - 1);
-    child_iter = storage.find(&point);
-
-    // if child is missing,
-    // test if we should refine the grid
-    if (child_iter == storage.end()) {
-      isRefinablePoint = true;
-      point.set(d, source_level, source_index);
-      break;
-    }
-
-    // test existance of right child
-    point.set(d, source_level + 1, 2 * source_index + 1);
-    child_iter = storage.find(&point);
 
-    // if child is missing,
-    // test if we should refine the grid
-    if (child_iter == storage.end()) {
-      isRefinablePoint = true;
-      point.set(d, source_level, source_index);
-      break;
-    }
-
-    // reset current grid point in dimension d
-    point.set(d, source_level, source_index);
-  }
+  GridPoint point(*(iter->first));
+  AbstractRefinement::refinement_candidate_heap_type heap(1);
+  pushCandidates(storage, impurityIndicator, point, iter->second, heap);
 
-  if (isRefinablePoint) {
-    // evaluate indicator
-    double impurity = impurityIndicator(point);
+  AbstractRefinement::refinement_list_type list;
 
-    if (impurity > threshold) {
-      size_t d = 0;
-      key = new refinement_key_type(point, storage.getSequenceNumber(point), d);
-      list.emplace_front(
-          std::shared_ptr<AbstractRefinement::refinement_key_type>(key),
-          impurity);
-    }
+  for (const AbstractRefinement::refinement_candidate_type& candidate : heap.sort()) {
+    list.emplace_front(std::make_shared<refinement_key_type>(point, candidate.seq, candidate.dim),
+                       candidate.value);
   }
 
   return list;
 }
 
-void ImpurityRefinement::addElementToCollection(
-    const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
-    size_t refinementsNum,
-    AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
-           current_value_list.begin();
-       it != current_value_list.end(); it++) {
-    collection.push_back(*it);
-    std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
-
-    if (collection.size() > refinementsNum) {
-      // remove the top (smallest) element
-      std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
-      collection.pop_back();
-    }
-  }
-}
-
 void ImpurityRefinement::refineGridpointsCollection(
     GridStorage& storage, RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
@@ -106,26 +106,21 @@ class ImpurityRefinement : public virtual RefinementDecorator {
       GridStorage& storage, const GridStorage::grid_map_iterator& iter,
       const RefinementFunctor& functor) const override;
 
+ private:
   /**
-  * Adds elements to the collection. This method is responsible for selection of
-  * the elements with largest indicator values and to limit the size of
-  * collection
-  * to refinementsNum elements.
-  *
-  * @param iter Storage iterator
-  * @param current_value_list List with elements that contain keys and values
-  * that specify refinement
-  * @param refinementsNum Number of grid points to refine
-  * @param collection Container where element pairs for refinement need to be
-  * stored
-  */
-  virtual void addElementToCollection(
-      const GridStorage::grid_map_iterator& iter,
-      AbstractRefinement::refinement_list_type current_value_list,
-      size_t refinementsNum,
-      AbstractRefinement::refinement_container_type& collection);
+   * Computes the refinement candidate of a grid point, if it is refinable and its indicator
+   * exceeds the threshold. Used by collectRefinablePoints and getIndicator.
+   *
+   * @param storage Grid storage
+   * @param impurityIndicator Refinement indicator
+   * @param point Grid point (restored before returning)
+   * @param seq Sequential number of the grid point
+   * @param heap Heap the candidate is pushed to
+   */
+  void pushCandidates(GridStorage& storage, const ImpurityRefinementIndicator& impurityIndicator,
+                      GridPoint& point, size_t seq,
+                      AbstractRefinement::refinement_candidate_heap_type& heap) const;
 
- private:
   double iThreshold_;
 };
 
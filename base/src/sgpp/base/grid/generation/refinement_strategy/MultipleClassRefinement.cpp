@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/tools/MultipleClassPoint.hpp>
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <algorithm>
@@ -126,23 +127,18 @@ void MultipleClassRefinement::addGridpoint(GridStorage& storage, GridPoint& poin
 void MultipleClassRefinement::collectRefinablePoints(GridStorage& storage,
     RefinementFunctor& functor,
     AbstractRefinement::refinement_container_type& collection) {
-  size_t refinements_num = functor.getRefinementsNum();
-
-  // Max value equals min value
-  GridPoint point;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // Start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter;
-       iter++) {
-    point = *(iter->first);
-    GridStorage::grid_map_iterator child_iter;
-
-    // All points can be refined
-    AbstractRefinement::refinement_list_type current_value_list =
-        getIndicator(storage, iter, functor);
-    addElementToCollection(iter, current_value_list, refinements_num,
-        collection);
+  // All points can be refined
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [&storage, &functor](GridPoint& /*point*/, size_t seq,
+                           AbstractRefinement::refinement_candidate_heap_type& heap) {
+        heap.push(seq, 0, functor(storage, seq));
+      });
+
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(std::make_shared<AbstractRefinement::refinement_key_type>(
+                              storage.getPoint(candidate.seq), candidate.seq),
+                            candidate.value);
   }
 }
 
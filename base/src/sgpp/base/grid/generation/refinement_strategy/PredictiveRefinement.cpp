@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <limits>
 #include <list>
+#include <memory>
 #include <vector>
 #include <utility>
 #include <iterator>
@@ -24,69 +25,27 @@ bool doubleReverseCompare(const double firstEl, const double secondEl) {
 }
 
 
-void PredictiveRefinement::addElementToCollection(
-  const GridStorage::grid_map_iterator& iter,
-  AbstractRefinement::refinement_list_type current_value_list,
-  size_t refinements_num,
-  AbstractRefinement::refinement_container_type& collection) {
-  for (AbstractRefinement::refinement_list_type::iterator it =
-         current_value_list.begin();
-       it != current_value_list.end(); it++) {
-    collection.push_back(*it);
-    std::push_heap(collection.begin(), collection.end(),
-                   AbstractRefinement::compare_pairs);
-
-
-    if (collection.size() > refinements_num) {
-      // remove the top (smallest) element
-      std::pop_heap(collection.begin(), collection.end(),
-                    AbstractRefinement::compare_pairs);
-      collection.pop_back();
-    }
-  }
-}
-
-
-AbstractRefinement::refinement_list_type PredictiveRefinement::getIndicator(
-  GridStorage& storage,
-  const GridStorage::grid_map_iterator& iter,
-  const RefinementFunctor& functor) const {
-  AbstractRefinement::refinement_list_type list;
-
-  // this refinement algorithm uses the predictive refinement indicator.
-  // dynamic casting is used to maintain the signature of the algorithm,
-  // but still be able to use the
-  // predictive refinement indicator with it.
-  const PredictiveRefinementIndicator& errorIndicator =
-    dynamic_cast<const PredictiveRefinementIndicator&>(functor);
-  refinement_key_type* key;
-
-  GridPoint& point = *(iter->first);
-  GridStorage::grid_map_iterator child_iter;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
+void PredictiveRefinement::pushCandidates(
+  GridStorage& storage, const PredictiveRefinementIndicator& errorIndicator, GridPoint& point,
+  size_t seq, AbstractRefinement::refinement_candidate_heap_type& heap) const {
   for (size_t d = 0; d < storage.getDimension(); d++) {
     index_t source_index;
     level_t source_level;
     point.get(d, source_level, source_index);
     double error = errorIndicator.start();
-    // errorIndicator->setActiveDim(d);
 
     // test existence of left child
     point.set(d, source_level + 1, 2 * source_index - 1);
-    child_iter = storage.find(&point);
 
-    if (child_iter == end_iter) {
+    if (!storage.isContaining(point)) {
       // use the predictive error indicator
       error += errorIndicator(point);
     }
 
     // test existance of right child
     point.set(d, source_level + 1, 2 * source_index + 1);
-    child_iter = storage.find(&point);
 
-    if (child_iter == end_iter) {
-      // use predictive refinement indicator
+    if (!storage.isContaining(point)) {
       // use the predictive error indicator
       error += errorIndicator(point);
     }
@@ -95,13 +54,33 @@ AbstractRefinement::refinement_list_type PredictiveRefinement::getIndicator(
     point.set(d, source_level, source_index);
 
     if (error > iThreshold_) {
-      key = new refinement_key_type(*(iter->first),
-                                    storage.getSequenceNumber(*iter->first), d);
-      list.emplace_front(
-        std::shared_ptr<AbstractRefinement::refinement_key_type>(key),
-        error);
+      heap.push(seq, d, error);
     }
   }
+}
+
+
+AbstractRefinement::refinement_list_type PredictiveRefinement::getIndicator(
+  GridStorage& storage,
+  const GridStorage::grid_map_iterator& iter,
+  const RefinementFunctor& functor) const {
+  // this refinement algorithm uses the predictive refinement indicator.
+  // dynamic casting is used to maintain the signature of the algorithm,
+  // but still be able to use the
+  // predictive refinement indicator with it.
+  const PredictiveRefinementIndicator& errorIndicator =
+    dynamic_cast<const PredictiveRefinementIndicator&>(functor);
+
+  GridPoint point(*(iter->first));
+  AbstractRefinement::refinement_candidate_heap_type heap(storage.getDimension());
+  pushCandidates(storage, errorIndicator, point, iter->second, heap);
+
+  AbstractRefinement::refinement_list_type list;
+
+  for (const AbstractRefinement::refinement_candidate_type& candidate : heap.sort()) {
+    list.emplace_front(std::make_shared<refinement_key_type>(point, candidate.seq, candidate.dim),
+                       candidate.value);
+  }
 
   return list;
 }
@@ -110,19 +89,23 @@ AbstractRefinement::refinement_list_type PredictiveRefinement::getIndicator(
 void PredictiveRefinement::collectRefinablePoints(
   GridStorage& storage, RefinementFunctor& functor,
   AbstractRefinement::refinement_container_type& collection) {
-  size_t refinements_num = functor.getRefinementsNum();
-
-  GridPoint index;
-  GridStorage::grid_map_iterator end_iter = storage.end();
-
-  // start iterating over whole grid
-  for (GridStorage::grid_map_iterator iter = storage.begin();
-       iter != end_iter; iter++) {
-    index = *(iter->first);
-    AbstractRefinement::refinement_list_type current_value_list = getIndicator(
-          storage, iter, functor);
-    addElementToCollection(iter, current_value_list, refinements_num,
-                           collection);
+  const PredictiveRefinementIndicator& errorIndicator =
+    dynamic_cast<const PredictiveRefinementIndicator&>(functor);
+
+  // candidates for the refinement along each direction
+  std::vector<AbstractRefinement::refinement_candidate_type> candidates = collectCandidates(
+      storage, functor, functor.getRefinementsNum(),
+      [this, &storage, &errorIndicator](
+          GridPoint& point, size_t seq,
+          AbstractRefinement::refinement_candidate_heap_type& heap) {
+        pushCandidates(storage, errorIndicator, point, seq, heap);
+      });
+
+  for (const AbstractRefinement::refinement_candidate_type& candidate : candidates) {
+    collection.emplace_back(
+      std::make_shared<refinement_key_type>(storage.getPoint(candidate.seq), candidate.seq,
+                                            candidate.dim),
+      candidate.value);
   }
 }
 
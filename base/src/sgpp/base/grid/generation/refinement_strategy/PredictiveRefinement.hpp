@@ -141,23 +141,21 @@ class PredictiveRefinement: public virtual RefinementDecorator {
     const RefinementFunctor& functor) const override;
 
 
+ private:
   /**
-  * Adds elements to the collection. This method is responsible for selection
-  * the elements with most important indicators and to limit the size of collection
-  * to refinements_num elements.
-  *
-  * @param iter storage iterator
-  * @param current_value_list list with elements that contain keys and values that specify refinement
-  * @param refinements_num number of elements to refine
-  * @param collection container where element pairs for refinement need to be stored
-  */
-  virtual void addElementToCollection(
-    const GridStorage::grid_map_iterator& iter,
-    AbstractRefinement::refinement_list_type current_value_list,
-    size_t refinements_num,
-    AbstractRefinement::refinement_container_type& collection);
+   * Computes the refinement candidates of a grid point, one per direction whose indicator
+   * exceeds the threshold. Used by collectRefinablePoints and getIndicator.
+   *
+   * @param storage grid storage
+   * @param errorIndicator predictive refinement indicator
+   * @param point grid point (restored before returning)
+   * @param seq sequential number of the grid point
+   * @param heap heap the candidates are pushed to
+   */
+  void pushCandidates(GridStorage& storage, const PredictiveRefinementIndicator& errorIndicator,
+                      GridPoint& point, size_t seq,
+                      AbstractRefinement::refinement_candidate_heap_type& heap) const;
 
- private:
   double iThreshold_;
   DataVector alpha_;
 };
@@ -7,6 +7,7 @@
 
 #include <sgpp/base/exception/generation_exception.hpp>
 
+#include <algorithm>
 #include <exception>
 #include <list>
 #include <memory>
@@ -156,52 +157,167 @@ void HashGridStorage::clear() {
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
-  point_pointer curPoint;
-  std::vector<size_t> remainingPoints;
-  size_t delCounter = 0;
-
   // sort list
   removePoints.sort();
 
-  // DEBUG : print list points to delete, sorted
-  // std::cout << std::endl << "List of points to delete, sorted" << std::endl;
-  // for(std::list<size_t>::iterator iter = removePoints.begin();
-  // iter != removePoints.end(); iter++)
-  // {
-  //   std::cout << " " << *iter << " ";
-  // }
-  // std::cout << std::endl;
+  return compact(std::vector<size_t>(removePoints.begin(), removePoints.end()),
+                 CompactionPolicy::Stable);
+}
 
-  // Remove points with given indices for index vector and hashmap
-  for (std::list<size_t>::iterator iter = removePoints.begin(); iter != removePoints.end();
-       iter++) {
-    size_t tmpIndex = *iter;
-    size_t curPos = tmpIndex - delCounter;
+std::vector<size_t> HashGridStorage::compact(const std::vector<size_t>& removePoints,
+                                             CompactionPolicy policy) {
+  const size_t oldSize = list.size();
+  std::vector<bool> isRemoved(oldSize, false);
+  std::vector<size_t> holes;
+  holes.reserve(removePoints.size());
 
-    // GridPoint
-    curPoint = list[curPos];
+  for (size_t seq : removePoints) {
+    if (seq >= oldSize) {
+      throw generation_exception("HashGridStorage::compact : sequence number out of range");
+    }
 
-    // erase point
-    delCounter++;
-    map.erase(curPoint);
-    list.erase(list.begin() + curPos);
+    if (!isRemoved[seq]) {
+      isRemoved[seq] = true;
+      holes.push_back(seq);
+    }
   }
 
-  // reset all entries in hash map and build list of remaining
-  for (size_t i = 0; i < list.size(); i++) {
-    curPoint = list[i];
-    remainingPoints.push_back(map[curPoint]);
-    map[curPoint] = i;
+  std::sort(holes.begin(), holes.end());
+
+  for (size_t seq : holes) {
+    map.erase(list[seq]);
+  }
+
+  // remaining parents of the removed points, whose leaf property may change
+  std::vector<point_pointer> parents;
+  HashGridPoint parent(dimension);
+
+  for (size_t seq : holes) {
+    point_pointer point = list[seq];
+    parent = *point;
+
+    for (size_t d = 0; d < dimension; d++) {
+      point_type::level_type l;
+      point_type::index_type i;
+      point->get(d, l, i);
+
+      if (l == 1) {
+        // boundary points on level 0 have the child on level 1
+        for (point_type::index_type boundaryIndex = 0; boundaryIndex <= 1; boundaryIndex++) {
+          parent.set(d, 0, boundaryIndex);
+          grid_map_iterator iter = map.find(&parent);
+
+          if (iter != map.end()) {
+            parents.push_back(iter->first);
+          }
+        }
+      } else if (l > 1) {
+        parent.set(d, l - 1, (i >> 1) | 1);
+        grid_map_iterator iter = map.find(&parent);
+
+        if (iter != map.end()) {
+          parents.push_back(iter->first);
+        }
+      }
+
+      parent.set(d, l, i);
+    }
+  }
+
+  for (size_t seq : holes) {
+    destroy(list[seq]);
+    list[seq] = nullptr;
   }
 
-  // reset the whole grid's leaf property in order
-  // to guarantee a consistent grid
-  recalcLeafProperty();
+  const size_t newSize = oldSize - holes.size();
+  std::vector<size_t> remainingPoints;
+
+  if (policy == CompactionPolicy::Stable) {
+    // shift the points behind the first hole to the front
+    remainingPoints.reserve(newSize);
+    size_t newSeq = 0;
+
+    for (size_t seq = 0; seq < oldSize; seq++) {
+      if (isRemoved[seq]) {
+        continue;
+      }
+
+      if (newSeq != seq) {
+        list[newSeq] = list[seq];
+        map.find(list[newSeq])->second = newSeq;
+      }
+
+      remainingPoints.push_back(seq);
+      newSeq++;
+    }
+  } else {
+    // fill the holes in front of newSize with the last remaining points
+    remainingPoints.resize(newSize);
+
+    for (size_t seq = 0; seq < newSize; seq++) {
+      remainingPoints[seq] = seq;
+    }
+
+    size_t last = oldSize;
+
+    for (size_t hole : holes) {
+      if (hole >= newSize) {
+        break;
+      }
+
+      do {
+        last--;
+      } while (isRemoved[last]);
+
+      list[hole] = list[last];
+      map.find(list[hole])->second = hole;
+      remainingPoints[hole] = last;
+    }
+  }
+
+  list.resize(newSize);
+
+  // only parents of removed points can become leaves
+  for (point_pointer point : parents) {
+    if (!point->isLeaf()) {
+      parent = *point;
+      point->setLeaf(hasNoChildren(parent));
+    }
+  }
 
-  // return indices of "surviver"
   return remainingPoints;
 }
 
+bool HashGridStorage::hasNoChildren(HashGridPoint& point) const {
+  for (size_t d = 0; d < dimension; d++) {
+    point_type::level_type l;
+    point_type::index_type i;
+    point.get(d, l, i);
+    bool hasChild;
+
+    if (l > 0) {
+      point.set(d, l + 1, 2 * i - 1);
+      hasChild = isContaining(point);
+
+      if (!hasChild) {
+        point.set(d, l + 1, 2 * i + 1);
+        hasChild = isContaining(point);
+      }
+    } else {
+      point.set(d, 1, 1);
+      hasChild = isContaining(point);
+    }
+
+    point.set(d, l, i);
+
+    if (hasChild) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void HashGridStorage::unserializeNoAlgoDims(std::string& istr) {
   std::istringstream istream;
   istream.str(istr);
@@ -283,6 +399,17 @@ size_t HashGridStorage::getNumberOfInnerPoints() const {
   return innerPoints;
 }
 
+size_t HashGridStorage::computeHash() const {
+  size_t hash = list.size();
+
+  for (size_t p = 0; p < list.size(); p++) {
+    // combine hashes as in boost::hash_combine
+    hash ^= list[p]->getHash() + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  }
+
+  return hash;
+}
+
 size_t HashGridStorage::getDimension() const { return dimension; }
 
 size_t HashGridStorage::insert(const point_type& index) {
@@ -36,6 +36,16 @@ namespace base {
 
 class HashGridIterator;
 
+/**
+ * How HashGridStorage::compact fills the sequence numbers of removed grid points.
+ */
+enum class CompactionPolicy {
+  /// the remaining points keep their order (all points behind the first removed one move)
+  Stable,
+  /// each hole is filled with the last remaining point (as many points move as are removed)
+  SwapWithLast
+};
+
 /**
  * Generic hash table based storage of grid points.
  */
@@ -138,6 +148,22 @@ class HashGridStorage {
    */
   std::vector<size_t> deletePoints(std::list<size_t>& removePoints);
 
+  /**
+   * Removes several points in place: the remaining points are moved into the holes according to
+   * the policy, only the moved points are updated in the hash map, and only the parents of the
+   * removed points are checked for their leaf property.
+   *
+   * The returned vector maps each new sequence number i to the old one, which is at least i.
+   * Hence coefficient vectors and matrices can be compacted in place with the same mapping,
+   * see DataVector::restructure and DataMatrix::restructureRows.
+   *
+   * @param removePoints sequence numbers of the points to remove (duplicates are ignored)
+   * @param policy how the holes are filled
+   * @return old sequence numbers of the remaining points, ordered by their new sequence numbers
+   */
+  std::vector<size_t> compact(const std::vector<size_t>& removePoints,
+                              CompactionPolicy policy = CompactionPolicy::Stable);
+
   /**
    * unserializes the grid from a string, algorithmic dimensions are not reseted
    *
@@ -189,6 +215,14 @@ class HashGridStorage {
    */
   size_t getNumberOfInnerPoints() const;
 
+  /**
+   * computes a hash value of all grid points in the order of their sequence numbers,
+   * e.g. to detect whether a grid has changed since a grid-dependent object was set up
+   *
+   * @return hash value of the grid points (in order)
+   */
+  size_t computeHash() const;
+
   /**
    * gets the dimension of the grid
    *
@@ -540,6 +574,14 @@ class HashGridStorage {
    * @param istream the string stream that contains the information
    */
   void parseGridDescription(std::istream& istream);
+
+  /**
+   * Checks whether a grid point has no children in the storage.
+   *
+   * @param point grid point (restored before returning)
+   * @return whether the point is a leaf
+   */
+  bool hasNoChildren(HashGridPoint& point) const;
 };
 
 HashGridStorage::point_pointer inline HashGridStorage::create(point_type& index) {
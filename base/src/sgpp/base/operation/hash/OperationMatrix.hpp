@@ -6,6 +6,7 @@
 #ifndef OPERATIONMATRIX_HPP
 #define OPERATIONMATRIX_HPP
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -38,6 +39,27 @@ class OperationMatrix {
    * @param result DataVector into which the result of the Laplace operation is stored
    */
   virtual void mult(DataVector& alpha, DataVector& result) = 0;
+
+  /**
+   * Multiplication with several vectors at once. Each column of alpha is one coefficient vector,
+   * i.e., row i holds the coefficients of all vectors belonging to grid point i.
+   * The default implementation calls mult() for each column; operators that stream large data
+   * structures (grid, data set) should override it to do so only once for all columns.
+   *
+   * @param alpha DataMatrix whose columns are the vectors the matrix is applied to
+   * @param result DataMatrix into which the results are stored column by column, has to have the
+   * same number of columns as alpha
+   */
+  virtual void multBlock(DataMatrix& alpha, DataMatrix& result) {
+    DataVector column(alpha.getNrows());
+    DataVector resultColumn(result.getNrows());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, column);
+      mult(column, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
 };
 
 }  // namespace base
@@ -101,6 +101,48 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with several coefficient vectors at once
+   *
+   * The default implementation calls mult() for each column. Implementations that can evaluate
+   * all columns while streaming the grid and the data set once override this method.
+   *
+   * @param alpha matrix whose columns are the vectors @f$B^T@f$ is applied to (one row per grid
+   * point)
+   * @param result matrix with one row per data point and as many columns as alpha
+   */
+  virtual void multBlock(DataMatrix& alpha, DataMatrix& result) {
+    DataVector column(alpha.getNrows());
+    DataVector resultColumn(result.getNrows());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, column);
+      this->mult(column, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
+  /**
+   * Multiplication of @f$B@f$ with several vectors at once
+   *
+   * The default implementation calls multTranspose() for each column. Implementations that can
+   * handle all columns while streaming the grid and the data set once override this method.
+   *
+   * @param source matrix whose columns are the vectors @f$B@f$ is applied to (one row per data
+   * point)
+   * @param result matrix with one row per grid point and as many columns as source
+   */
+  virtual void multTransposeBlock(DataMatrix& source, DataMatrix& result) {
+    DataVector column(source.getNrows());
+    DataVector resultColumn(result.getNrows());
+
+    for (size_t j = 0; j < source.getNcols(); j++) {
+      source.getColumn(j, column);
+      this->multTranspose(column, resultColumn);
+      result.setColumn(j, resultColumn);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
@@ -26,6 +26,20 @@ void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& r
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult_block(storage, base, alpha, this->dataset, result);
+}
+
+void OperationMultipleEvalLinear::multTransposeBlock(DataMatrix& source, DataMatrix& result) {
+  AlgorithmMultipleEvaluation<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult_transpose_block(storage, base, source, this->dataset, result);
+}
+
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
 }  // namespace base
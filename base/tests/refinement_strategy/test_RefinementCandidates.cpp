@@ -0,0 +1,185 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/generation/functors/RefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/grid/generation/hashmap/AbstractRefinement.hpp>
+#include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using sgpp::base::AbstractRefinement;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
+using sgpp::base::HashRefinement;
+using sgpp::base::RefinementFunctor;
+using sgpp::base::SurplusRefinementFunctor;
+
+namespace {
+
+/**
+ * Exposes the collection of the refinement candidates.
+ */
+class CollectingHashRefinement : public HashRefinement {
+ public:
+  using HashRefinement::collectRefinablePoints;
+};
+
+/**
+ * Functor which doesn't declare whether it is thread safe.
+ */
+class SequenceNumberFunctor : public RefinementFunctor {
+ public:
+  double operator()(GridStorage& /*storage*/, size_t seq) const override {
+    return static_cast<double>(seq);
+  }
+
+  double start() const override { return 0.0; }
+
+  double getRefinementThreshold() const override { return 0.0; }
+};
+
+/**
+ * Thread safe surplus functor which throws for one grid point.
+ */
+class ThrowingFunctor : public SurplusRefinementFunctor {
+ public:
+  ThrowingFunctor(DataVector& alpha, size_t throwingSeq)
+      : SurplusRefinementFunctor(alpha, 5), throwingSeq(throwingSeq) {}
+
+  double operator()(GridStorage& storage, size_t seq) const override {
+    if (seq == throwingSeq) {
+      throw std::runtime_error("ThrowingFunctor");
+    }
+
+    return SurplusRefinementFunctor::operator()(storage, seq);
+  }
+
+ private:
+  size_t throwingSeq;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestRefinementCandidates)
+
+BOOST_AUTO_TEST_CASE(testCandidateHeap) {
+  const size_t capacity = 10;
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(0, 20);
+  AbstractRefinement::refinement_candidate_heap_type heap1(capacity);
+  AbstractRefinement::refinement_candidate_heap_type heap2(capacity);
+  std::vector<std::pair<double, size_t>> reference;
+
+  // many equal values, so the order of the ties matters
+  for (size_t seq = 0; seq < 500; seq++) {
+    const double value = static_cast<double>(distribution(generator));
+    ((seq % 3 == 0) ? heap1 : heap2).push(seq, 0, value);
+    reference.push_back(std::make_pair(-value, seq));
+  }
+
+  heap1.merge(heap2);
+  std::vector<AbstractRefinement::refinement_candidate_type>& candidates = heap1.sort();
+  std::sort(reference.begin(), reference.end());
+
+  BOOST_CHECK_EQUAL(candidates.size(), capacity);
+
+  for (size_t i = 0; i < candidates.size(); i++) {
+    BOOST_CHECK_EQUAL(candidates[i].value, -reference[i].first);
+    BOOST_CHECK_EQUAL(candidates[i].seq, reference[i].second);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testCollectRefinablePoints) {
+  const size_t dim = 3;
+  const size_t refinementsNum = 25;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  GridStorage& storage = grid->getStorage();
+
+  // surpluses with many ties
+  DataVector alpha(storage.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>((i * 7) % 13);
+  }
+
+  SurplusRefinementFunctor functor(alpha, refinementsNum);
+  CollectingHashRefinement refinement;
+
+  // serial reference: points with a missing child, ordered by value and sequence number
+  std::vector<std::pair<double, size_t>> reference;
+
+  for (size_t seq = 0; seq < storage.getSize(); seq++) {
+    GridPoint point(storage.getPoint(seq));
+    bool refinable = false;
+
+    for (size_t d = 0; d < dim; d++) {
+      GridPoint child(point);
+      child.set(d, point.getLevel(d) + 1, 2 * point.getIndex(d) - 1);
+      refinable = refinable || !storage.isContaining(child);
+      child.set(d, point.getLevel(d) + 1, 2 * point.getIndex(d) + 1);
+      refinable = refinable || !storage.isContaining(child);
+    }
+
+    if (refinable) {
+      reference.push_back(std::make_pair(-functor(storage, seq), seq));
+    }
+  }
+
+  std::sort(reference.begin(), reference.end());
+  BOOST_CHECK_EQUAL(refinement.getNumberOfRefinablePoints(storage), reference.size());
+
+  AbstractRefinement::refinement_container_type collection;
+  refinement.collectRefinablePoints(storage, functor, collection);
+  BOOST_CHECK_EQUAL(collection.size(), refinementsNum);
+
+  for (size_t i = 0; i < collection.size(); i++) {
+    BOOST_CHECK_EQUAL(collection[i].first->getSeq(), reference[i].second);
+    BOOST_CHECK_EQUAL(collection[i].second, -reference[i].first);
+    BOOST_CHECK(collection[i].first->getPoint().equals(storage.getPoint(reference[i].second)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testThreadSafetyAndExceptions) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(5);
+  GridStorage& storage = grid->getStorage();
+  DataVector alpha(storage.getSize(), 1.0);
+  CollectingHashRefinement refinement;
+
+  // functors are only evaluated concurrently if they declare to be thread safe
+  SequenceNumberFunctor sequenceNumberFunctor;
+  SurplusRefinementFunctor surplusFunctor(alpha);
+  BOOST_CHECK(!sequenceNumberFunctor.isThreadSafe());
+  BOOST_CHECK(surplusFunctor.isThreadSafe());
+
+  AbstractRefinement::refinement_container_type collection;
+  refinement.collectRefinablePoints(storage, sequenceNumberFunctor, collection);
+  BOOST_CHECK_EQUAL(collection.size(), 1u);
+  BOOST_CHECK_EQUAL(collection[0].first->getSeq(), storage.getSize() - 1);
+
+  // an exception of the functor (for a refinable point) leaves the parallel scan and reaches
+  // the caller
+  ThrowingFunctor throwingFunctor(alpha, storage.getSize() - 1);
+  collection.clear();
+  BOOST_CHECK_THROW(refinement.collectRefinablePoints(storage, throwingFunctor, collection),
+                    std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -7,9 +7,11 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 using sgpp::base::DataVector;
 
@@ -245,4 +247,22 @@ BOOST_AUTO_TEST_CASE(testDotProduct) {
   BOOST_CHECK_EQUAL(d.dotProduct(d), x);
 }
 
+BOOST_AUTO_TEST_CASE(testRemove) {
+  DataVector d(d_rand);
+  // duplicates are removed once, the remaining entries keep their order
+  std::vector<size_t> indexesToRemove = {7, 2, 3, static_cast<size_t>(N - 1), 2};
+  d.remove(indexesToRemove);
+  BOOST_REQUIRE_EQUAL(d.getSize(), static_cast<size_t>(N - 4));
+
+  for (int i = 0, j = 0; i < N; ++i) {
+    if ((i != 2) && (i != 3) && (i != 7) && (i != N - 1)) {
+      BOOST_CHECK_EQUAL(d[j], d_rand[i]);
+      ++j;
+    }
+  }
+
+  std::vector<size_t> outOfRange = {static_cast<size_t>(N)};
+  BOOST_CHECK_THROW(d.remove(outOfRange), sgpp::base::data_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
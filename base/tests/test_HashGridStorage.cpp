@@ -9,13 +9,17 @@
 #include <sgpp/base/grid/storage/hashmap/HashGridPoint.hpp>
 #include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinementBoundaries.hpp>
 
 #include <string>
+#include <vector>
 
+using sgpp::base::CompactionPolicy;
+using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
@@ -193,6 +197,108 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testCompact) {
+  HashGridStorage original(2);
+  HashGenerator g;
+  g.regularWithBoundaries(original, 4);
+  original.recalcLeafProperty();
+
+  // remove every second leaf and a duplicate
+  std::vector<size_t> removePoints;
+
+  for (size_t seq = 0; seq < original.getSize(); seq++) {
+    if (original.getPoint(seq).isLeaf() && (seq % 2 == 0)) {
+      removePoints.push_back(seq);
+    }
+  }
+
+  removePoints.push_back(removePoints.front());
+  const size_t numRemoved = removePoints.size() - 1;
+
+  for (CompactionPolicy policy : {CompactionPolicy::Stable, CompactionPolicy::SwapWithLast}) {
+    HashGridStorage s(original);
+    std::vector<size_t> remaining = s.compact(removePoints, policy);
+
+    BOOST_CHECK_EQUAL(s.getSize(), original.getSize() - numRemoved);
+    BOOST_CHECK_EQUAL(remaining.size(), s.getSize());
+
+    // the leaf property has to match the one of a complete recalculation
+    HashGridStorage recalculated(s);
+    recalculated.recalcLeafProperty();
+
+    for (size_t seq = 0; seq < s.getSize(); seq++) {
+      BOOST_CHECK_GE(remaining[seq], seq);
+      BOOST_CHECK(s.getPoint(seq).equals(original.getPoint(remaining[seq])));
+      BOOST_CHECK_EQUAL(s.getSequenceNumber(s.getPoint(seq)), seq);
+      BOOST_CHECK_EQUAL(s.getPoint(seq).isLeaf(), recalculated.getPoint(seq).isLeaf());
+
+      if ((policy == CompactionPolicy::Stable) && (seq > 0)) {
+        BOOST_CHECK_LT(remaining[seq - 1], remaining[seq]);
+      }
+    }
+
+    // payloads are compacted with the same mapping
+    const size_t n = original.getSize();
+    DataVector v(n);
+    DataMatrix rows(n, 3);
+    DataMatrix quadratic(n, n);
+
+    for (size_t i = 0; i < n; i++) {
+      v[i] = static_cast<double>(i);
+
+      for (size_t j = 0; j < 3; j++) {
+        rows(i, j) = static_cast<double>(i * 3 + j);
+      }
+
+      for (size_t j = 0; j < n; j++) {
+        quadratic(i, j) = static_cast<double>(i * n + j);
+      }
+    }
+
+    v.restructure(remaining);
+    rows.restructureRows(remaining);
+    quadratic.restructureQuadratic(remaining);
+    BOOST_CHECK_EQUAL(v.getSize(), s.getSize());
+    BOOST_CHECK_EQUAL(rows.getNrows(), s.getSize());
+    BOOST_CHECK_EQUAL(quadratic.getNcols(), s.getSize());
+
+    for (size_t i = 0; i < s.getSize(); i++) {
+      BOOST_CHECK_EQUAL(v[i], static_cast<double>(remaining[i]));
+
+      for (size_t j = 0; j < 3; j++) {
+        BOOST_CHECK_EQUAL(rows(i, j), static_cast<double>(remaining[i] * 3 + j));
+      }
+
+      for (size_t j = 0; j < s.getSize(); j++) {
+        BOOST_CHECK_EQUAL(quadratic(i, j), static_cast<double>(remaining[i] * n + remaining[j]));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testComputeHash) {
+  HashGridStorage s(2);
+  HashGenerator g;
+  g.regular(s, 3);
+
+  // equal grids have equal hashes, the order of the points matters
+  HashGridStorage copy(s);
+  BOOST_CHECK_EQUAL(copy.computeHash(), s.computeHash());
+
+  const size_t hash = s.computeHash();
+  std::vector<size_t> removePoints = {0};
+  copy.compact(removePoints, CompactionPolicy::SwapWithLast);
+  BOOST_CHECK_NE(copy.computeHash(), hash);
+  copy.insert(s.getPoint(0));
+  BOOST_CHECK_EQUAL(copy.getSize(), s.getSize());
+  BOOST_CHECK_NE(copy.computeHash(), hash);
+
+  HashGridPoint point(s.getPoint(0));
+  point.set(0, 4, 1);
+  s.insert(point);
+  BOOST_CHECK_NE(s.computeHash(), hash);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -12,6 +12,9 @@
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <cmath>
+#include <memory>
+
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
@@ -78,4 +81,70 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBlock) {
+  const size_t dim = 2;
+  const size_t numColumns = 3;
+  const size_t numberDataPoints = 50;
+
+  for (int boundary = 0; boundary < 2; boundary++) {
+    std::unique_ptr<Grid> grid(boundary ? Grid::createLinearBoundaryGrid(dim)
+                                        : Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(3);
+    grid->getBoundingBox().setBoundary(0, BoundingBox1D(3.0, 5.0));
+    grid->getBoundingBox().setBoundary(1, BoundingBox1D(-2.0, 2.0));
+    const size_t N = grid->getSize();
+
+    // some points lie outside of the bounding box
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      dataset.set(i, 0, 2.9 + 2.2 * std::fmod(0.6180339887 * static_cast<double>(i), 1.0));
+      dataset.set(i, 1, -2.0 + 4.0 * std::fmod(0.7548776662 * static_cast<double>(i), 1.0));
+    }
+
+    DataMatrix alpha(N, numColumns);
+    DataMatrix source(numberDataPoints, numColumns);
+
+    for (size_t i = 0; i < N; i++) {
+      for (size_t j = 0; j < numColumns; j++) {
+        alpha.set(i, j, std::sin(static_cast<double>(i * numColumns + j)));
+      }
+    }
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      for (size_t j = 0; j < numColumns; j++) {
+        source.set(i, j, std::cos(static_cast<double>(i * numColumns + j)));
+      }
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    DataMatrix result(numberDataPoints, numColumns);
+    DataMatrix resultTranspose(N, numColumns);
+    op->multBlock(alpha, result);
+    op->multTransposeBlock(source, resultTranspose);
+
+    DataVector column(N);
+    DataVector sourceColumn(numberDataPoints);
+    DataVector resultColumn(numberDataPoints);
+    DataVector resultTransposeColumn(N);
+
+    for (size_t j = 0; j < numColumns; j++) {
+      alpha.getColumn(j, column);
+      op->mult(column, resultColumn);
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        BOOST_CHECK_SMALL(result.get(i, j) - resultColumn[i], 1e-12);
+      }
+
+      source.getColumn(j, sourceColumn);
+      op->multTranspose(sourceColumn, resultTransposeColumn);
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(resultTranspose.get(i, j) - resultTransposeColumn[i], 1e-12);
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/*
+ * This example compares the run time of multi-evaluation (evaluating a combination technique
+ * interpolant at many points simultaneously) for the two vector types FloatArrayVector and
+ * AlignedFloatArrayVector. Both are used as template parameter V of the combigrid evaluators and
+ * produce identical results; AlignedFloatArrayVector stores the values contiguously, such that
+ * the inner loops of the full grid summation can be vectorized.
+ */
+
+#include <sgpp/combigrid/algebraic/AlignedFloatArrayVector.hpp>
+#include <sgpp/combigrid/algebraic/FloatArrayVector.hpp>
+#include <sgpp/combigrid/operation/Configurations.hpp>
+#include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
+#include <sgpp/combigrid/operation/multidim/CombigridEvaluator.hpp>
+#include <sgpp/combigrid/operation/multidim/fullgrid/FullGridCallbackEvaluator.hpp>
+#include <sgpp/combigrid/operation/onedim/ArrayEvaluator.hpp>
+#include <sgpp/combigrid/operation/onedim/PolynomialInterpolationEvaluator.hpp>
+#include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
+#include <sgpp/combigrid/utils/Stopwatch.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+double f(sgpp::base::DataVector const &x) {
+  double prod = 1.0;
+  for (size_t dim = 0; dim < x.getSize(); ++dim) {
+    prod *= exp(-x[dim] * x[dim]);
+  }
+  return prod;
+}
+
+/**
+ * Evaluates the interpolant of level q at all points and returns the elapsed time in seconds.
+ * The function values are taken from the given storage, which is shared between all runs such
+ * that only the evaluation itself is measured once the storage has been filled.
+ */
+template <typename V>
+double runMultiEvaluation(
+    size_t q, std::vector<sgpp::base::DataVector> const &points,
+    std::shared_ptr<sgpp::combigrid::AbstractCombigridStorage> storage,
+    std::vector<std::shared_ptr<sgpp::combigrid::AbstractPointHierarchy>> const &hierarchies,
+    std::vector<double> &result) {
+  size_t d = hierarchies.size();
+  std::vector<std::shared_ptr<sgpp::combigrid::AbstractLinearEvaluator<V>>> evaluators(
+      d, std::make_shared<
+             sgpp::combigrid::ArrayEvaluator<sgpp::combigrid::PolynomialInterpolationEvaluator, V>>(
+             true));
+
+  sgpp::combigrid::Stopwatch stopwatch;
+  stopwatch.start();
+
+  auto fullGridEval = std::make_shared<sgpp::combigrid::FullGridCallbackEvaluator<V>>(
+      storage, evaluators, hierarchies);
+  auto combiEval = std::make_shared<sgpp::combigrid::CombigridEvaluator<V>>(d, fullGridEval);
+  auto levelManager = std::make_shared<sgpp::combigrid::AveragingLevelManager>();
+  levelManager->setLevelEvaluator(combiEval);
+
+  std::vector<V> params(d);
+  for (size_t i = 0; i < points.size(); ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      params[j].set(i, sgpp::combigrid::FloatScalarVector(points[i][j]));
+    }
+  }
+  fullGridEval->setParameters(params);
+  levelManager->addRegularLevels(q);
+
+  V value = combiEval->getValue();
+  double elapsed = stopwatch.elapsedSeconds();
+
+  result.resize(value.size());
+  for (size_t i = 0; i < value.size(); ++i) {
+    result[i] = value[i].getValue();
+  }
+
+  return elapsed;
+}
+
+int main() {
+  size_t d = 4;
+  size_t q = 5;
+  size_t numRepetitions = 3;
+
+  std::vector<std::shared_ptr<sgpp::combigrid::AbstractPointHierarchy>> hierarchies(
+      d, sgpp::combigrid::CombiHierarchies::expClenshawCurtis());
+  auto storage = std::make_shared<sgpp::combigrid::CombigridTreeStorage>(
+      hierarchies, sgpp::combigrid::MultiFunction(f));
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  std::cout << "d = " << d << ", q = " << q << "\n";
+  std::cout << "#points\tFloatArrayVector [s]\tAlignedFloatArrayVector [s]\tspeedup\tmax. diff\n";
+
+  for (size_t numPoints = 1; numPoints <= 10000; numPoints *= 10) {
+    std::vector<sgpp::base::DataVector> points(numPoints, sgpp::base::DataVector(d));
+    for (auto &point : points) {
+      for (size_t j = 0; j < d; ++j) {
+        point[j] = distribution(generator);
+      }
+    }
+
+    std::vector<double> arrayResult;
+    std::vector<double> alignedResult;
+
+    // the first run fills the storage with the function values
+    runMultiEvaluation<sgpp::combigrid::FloatArrayVector>(q, points, storage, hierarchies,
+                                                          arrayResult);
+
+    double arrayTime = 0.0;
+    double alignedTime = 0.0;
+
+    for (size_t r = 0; r < numRepetitions; ++r) {
+      arrayTime += runMultiEvaluation<sgpp::combigrid::FloatArrayVector>(q, points, storage,
+                                                                         hierarchies, arrayResult);
+      alignedTime += runMultiEvaluation<sgpp::combigrid::AlignedFloatArrayVector>(
+          q, points, storage, hierarchies, alignedResult);
+    }
+
+    double maxDiff = 0.0;
+    for (size_t i = 0; i < numPoints; ++i) {
+      maxDiff = std::max(maxDiff, std::abs(arrayResult[i] - alignedResult[i]));
+    }
+
+    arrayTime /= static_cast<double>(numRepetitions);
+    alignedTime /= static_cast<double>(numRepetitions);
+
+    std::cout << numPoints << "\t" << arrayTime << "\t" << alignedTime << "\t"
+              << arrayTime / alignedTime << "\t" << maxDiff << "\n";
+  }
+
+  return 0;
+}
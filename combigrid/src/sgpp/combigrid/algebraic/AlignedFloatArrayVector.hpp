@@ -0,0 +1,223 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_ALGEBRAIC_ALIGNEDFLOATARRAYVECTOR_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_ALGEBRAIC_ALIGNEDFLOATARRAYVECTOR_HPP_
+
+#include <sgpp/combigrid/algebraic/FloatScalarVector.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * This class has the same semantics as FloatArrayVector (including the repetition of the last
+ * element if two vectors of different size are combined), but stores the values in a contiguous
+ * array of doubles instead of a vector of FloatScalarVector objects. The memory is aligned to
+ * SGPPMEMALIGNMENT bytes via the global operator new of base/tools/AlignedMemory.cpp.
+ * All operations on vectors of equal size are written as plain loops over the arrays, such that
+ * the compiler can vectorize them (#pragma omp simd).
+ *
+ * It can be used as template parameter V for the summation strategies, e.g. for evaluating at
+ * many points simultaneously with ArrayEvaluator<ScalarEvaluator, AlignedFloatArrayVector>.
+ */
+class AlignedFloatArrayVector {
+  std::vector<double> values;
+
+  /**
+   * Ensures that the current vector has at least minSize elements.
+   * If it has less elements, the last element is repeated until minSize is reached.
+   */
+  void ensureMinimumSize(size_t minSize) {
+    if (values.size() == 0) {
+      values.push_back(0.0);
+    }
+    if (values.size() < minSize) {
+      values.resize(minSize, values.back());
+    }
+  }
+
+ public:
+  AlignedFloatArrayVector() : values() {}
+
+  explicit AlignedFloatArrayVector(std::vector<double> const &values) : values(values) {}
+
+  explicit AlignedFloatArrayVector(FloatScalarVector value) : values(1, value.value()) {}
+
+  explicit AlignedFloatArrayVector(std::shared_ptr<TreeStorage<FloatScalarVector>> storage)
+      : values(0) {
+    for (auto it = storage->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+      values.push_back(it->value().value());
+    }
+  }
+
+  AlignedFloatArrayVector(AlignedFloatArrayVector const &other) : values(other.values) {}
+
+  /**
+   * Copies the values of other. The memory of this vector is reused if it is large enough.
+   */
+  AlignedFloatArrayVector &operator=(AlignedFloatArrayVector const &other) {
+    values.assign(other.values.begin(), other.values.end());
+    return *this;
+  }
+
+  std::vector<double> const &getValues() const { return values; }
+
+  double *data() { return values.data(); }
+
+  double const *data() const { return values.data(); }
+
+  /**
+   * This function can be called from python because it does not return a reference.
+   * It does not do range checking
+   */
+  FloatScalarVector get(size_t i) const { return FloatScalarVector(values[i]); }
+
+  /**
+   * Returns a reference to the i-th value stored. If there are fewer elements stored,
+   * the number of elements is extended via ensureMinimumSize().
+   */
+  double &at(size_t i) {
+    ensureMinimumSize(i + 1);
+    return values[i];
+  }
+
+  /**
+   * Sets the i-th value. If there are fewer elements stored, the number of elements is extended
+   * via ensureMinimumSize().
+   */
+  void set(size_t i, FloatScalarVector const &value) { at(i) = value.value(); }
+
+  /**
+   * This operator is unsafe because it does no range checking
+   */
+  FloatScalarVector operator[](size_t i) const { return FloatScalarVector(values[i]); }
+
+  size_t size() const { return values.size(); }
+
+  void add(AlignedFloatArrayVector const &other) {
+    ensureMinimumSize(other.size());
+
+    size_t otherSize = other.size();
+    double *x = values.data();
+    double const *y = other.values.data();
+
+#pragma omp simd
+    for (size_t i = 0; i < otherSize; ++i) {
+      x[i] += y[i];
+    }
+
+    for (size_t i = otherSize; i < size(); ++i) {
+      x[i] += other.values.back();
+    }
+  }
+
+  void sub(AlignedFloatArrayVector const &other) {
+    ensureMinimumSize(other.size());
+
+    size_t otherSize = other.size();
+    double *x = values.data();
+    double const *y = other.values.data();
+
+#pragma omp simd
+    for (size_t i = 0; i < otherSize; ++i) {
+      x[i] -= y[i];
+    }
+
+    for (size_t i = otherSize; i < size(); ++i) {
+      x[i] -= other.values.back();
+    }
+  }
+
+  void componentwiseMult(AlignedFloatArrayVector const &other) {
+    ensureMinimumSize(other.size());
+
+    size_t otherSize = other.size();
+    double *x = values.data();
+    double const *y = other.values.data();
+
+#pragma omp simd
+    for (size_t i = 0; i < otherSize; ++i) {
+      x[i] *= y[i];
+    }
+
+    for (size_t i = otherSize; i < size(); ++i) {
+      x[i] *= other.values.back();
+    }
+  }
+
+  void scalarMult(double const &factor) {
+    double *x = values.data();
+    size_t n = values.size();
+
+#pragma omp simd
+    for (size_t i = 0; i < n; ++i) {
+      x[i] *= factor;
+    }
+  }
+
+  /**
+   * Adds the componentwise product of a and b, multiplied by factor, to this vector. This gives
+   * the same result as copying a, calling componentwiseMult(b) and scalarMult(factor) on the copy
+   * and adding it to this vector, but without creating a temporary vector.
+   */
+  void addScaledProduct(AlignedFloatArrayVector const &a, AlignedFloatArrayVector const &b,
+                        double const &factor) {
+    size_t aSize = a.size();
+    size_t bSize = b.size();
+
+    if (aSize == 0 || bSize == 0) {
+      AlignedFloatArrayVector product = a;
+      product.componentwiseMult(b);
+      product.scalarMult(factor);
+      add(product);
+      return;
+    }
+
+    ensureMinimumSize(std::max(aSize, bSize));
+
+    size_t n = size();
+    double *x = values.data();
+    double const *y = a.values.data();
+    double const *z = b.values.data();
+
+    if (aSize == n && bSize == n) {
+#pragma omp simd
+      for (size_t i = 0; i < n; ++i) {
+        x[i] += y[i] * z[i] * factor;
+      }
+    } else {
+      for (size_t i = 0; i < n; ++i) {
+        x[i] += y[std::min(i, aSize - 1)] * z[std::min(i, bSize - 1)] * factor;
+      }
+    }
+  }
+
+  double norm() const {
+    double result = 0.0;
+
+    for (auto &val : values) {
+      result += val * val;
+    }
+
+    return std::sqrt(result);
+  }
+
+  static AlignedFloatArrayVector zero() { return AlignedFloatArrayVector(FloatScalarVector(0.0)); }
+
+  static AlignedFloatArrayVector one() { return AlignedFloatArrayVector(FloatScalarVector(1.0)); }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_ALGEBRAIC_ALIGNEDFLOATARRAYVECTOR_HPP_ */
@@ -99,6 +99,12 @@ class FloatArrayVector {
    */
   FloatScalarVector const &operator[](size_t i) const { return values[i]; }
 
+  /**
+   * Sets the i-th value. If there are fewer elements stored, the number of elements is extended
+   * via ensureMinimumSize().
+   */
+  void set(size_t i, FloatScalarVector const &value) { at(i) = value; }
+
   size_t size() const { return values.size(); }
 
   void add(FloatArrayVector const &other) {
@@ -146,6 +152,32 @@ class FloatArrayVector {
     }
   }
 
+  /**
+   * Adds the componentwise product of a and b, multiplied by factor, to this vector. This gives
+   * the same result as copying a, calling componentwiseMult(b) and scalarMult(factor) on the copy
+   * and adding it to this vector, but without creating a temporary vector.
+   */
+  void addScaledProduct(FloatArrayVector const &a, FloatArrayVector const &b,
+                        double const &factor) {
+    size_t aSize = a.size();
+    size_t bSize = b.size();
+
+    if (aSize == 0 || bSize == 0) {
+      FloatArrayVector product = a;
+      product.componentwiseMult(b);
+      product.scalarMult(factor);
+      add(product);
+      return;
+    }
+
+    ensureMinimumSize(std::max(aSize, bSize));
+
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i].addScaledProduct(a.values[std::min(i, aSize - 1)],
+                                 b.values[std::min(i, bSize - 1)], factor);
+    }
+  }
+
   double norm() const {
     double result = 0.0;
 
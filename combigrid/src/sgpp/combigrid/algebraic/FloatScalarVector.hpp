@@ -65,6 +65,14 @@ class FloatScalarVector {
 
   void scalarMult(double const &factor) { val *= factor; }
 
+  /**
+   * Adds a * b * factor to this value without creating temporary objects.
+   */
+  void addScaledProduct(FloatScalarVector const &a, FloatScalarVector const &b,
+                        double const &factor) {
+    val += a.val * b.val * factor;
+  }
+
   double norm() const { return std::fabs(val); }
 
   static FloatScalarVector zero() { return FloatScalarVector(0.0); }
@@ -156,6 +156,14 @@ void FloatTensorVector::scalarMult(const double& factor) {
   }
 }
 
+void FloatTensorVector::addScaledProduct(const FloatTensorVector& a, const FloatTensorVector& b,
+                                         const double& factor) {
+  FloatTensorVector product = a;
+  product.componentwiseMult(b);
+  product.scalarMult(factor);
+  add(product);
+}
+
 double FloatTensorVector::norm() const {
   double sum = 0.0;
   for (auto it = values->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
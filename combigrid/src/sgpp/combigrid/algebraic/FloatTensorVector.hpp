@@ -67,6 +67,12 @@ class FloatTensorVector {
 
   void scalarMult(double const &factor);
 
+  /**
+   * Adds the product of a and b (see componentwiseMult()), multiplied by factor, to this vector.
+   */
+  void addScaledProduct(FloatTensorVector const &a, FloatTensorVector const &b,
+                        double const &factor);
+
   double norm() const;
 
   static FloatTensorVector zero() { return FloatTensorVector(FloatScalarVector(0.0)); }
@@ -5,6 +5,8 @@
 
 #include <sgpp/combigrid/functions/AbstractInfiniteFunctionBasis1D.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
@@ -12,5 +14,18 @@ sgpp::combigrid::AbstractInfiniteFunctionBasis1D::AbstractInfiniteFunctionBasis1
 
 sgpp::combigrid::AbstractInfiniteFunctionBasis1D::~AbstractInfiniteFunctionBasis1D() {}
 
+void AbstractInfiniteFunctionBasis1D::evaluateBatch(size_t maxBasisIndex,
+                                                    std::vector<double> const& xValues,
+                                                    std::vector<double>& result) {
+  size_t numValues = xValues.size();
+  result.resize((maxBasisIndex + 1) * numValues);
+
+  for (size_t j = 0; j <= maxBasisIndex; ++j) {
+    for (size_t i = 0; i < numValues; ++i) {
+      result[j * numValues + i] = evaluate(j, xValues[i]);
+    }
+  }
+}
+
 } /* namespace combigrid */
 } /* namespace sgpp */
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace combigrid {
@@ -16,6 +17,18 @@ class AbstractInfiniteFunctionBasis1D {
   virtual ~AbstractInfiniteFunctionBasis1D();
 
   virtual double evaluate(size_t basisIndex, double xValue) = 0;
+
+  /**
+   * Evaluates the basis functions 0, ..., maxBasisIndex at all given points. The default
+   * implementation calls evaluate() for each pair; subclasses can override this to share work
+   * between the basis functions (e.g. via a recurrence relation) and between the points.
+   * @param maxBasisIndex largest basis function index that should be evaluated
+   * @param xValues points at which the basis functions are evaluated
+   * @param result is resized to (maxBasisIndex + 1) * xValues.size(), the value of basis function
+   * j at xValues[i] is stored in result[j * xValues.size() + i]
+   */
+  virtual void evaluateBatch(size_t maxBasisIndex, std::vector<double> const& xValues,
+                             std::vector<double>& result);
 };
 
 } /* namespace combigrid */
@@ -6,6 +6,8 @@
 #include <sgpp/combigrid/functions/MonomialFunctionBasis1D.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
@@ -15,5 +17,29 @@ double MonomialFunctionBasis1D::evaluate(size_t basisIndex, double xValue) {
   return pow(xValue, basisIndex);
 }
 
+void MonomialFunctionBasis1D::evaluateBatch(size_t maxBasisIndex,
+                                            std::vector<double> const& xValues,
+                                            std::vector<double>& result) {
+  size_t numValues = xValues.size();
+  result.resize((maxBasisIndex + 1) * numValues);
+
+  double* values = result.data();
+  double const* x = xValues.data();
+
+#pragma omp simd
+  for (size_t i = 0; i < numValues; ++i) {
+    values[i] = 1.0;
+  }
+
+  for (size_t j = 1; j <= maxBasisIndex; ++j) {
+    double* current = values + j * numValues;
+    double const* previous = current - numValues;
+#pragma omp simd
+    for (size_t i = 0; i < numValues; ++i) {
+      current[i] = previous[i] * x[i];
+    }
+  }
+}
+
 } /* namespace combigrid */
 } /* namespace sgpp */
@@ -7,6 +7,8 @@
 
 #include <sgpp/combigrid/functions/AbstractInfiniteFunctionBasis1D.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace combigrid {
 
@@ -15,6 +17,12 @@ class MonomialFunctionBasis1D : public AbstractInfiniteFunctionBasis1D {
   ~MonomialFunctionBasis1D();
 
   virtual double evaluate(size_t basisIndex, double xValue);
+
+  /**
+   * Computes the monomials of increasing degree by repeated multiplication.
+   */
+  void evaluateBatch(size_t maxBasisIndex, std::vector<double> const& xValues,
+                     std::vector<double>& result) override;
 };
 
 } /* namespace combigrid */
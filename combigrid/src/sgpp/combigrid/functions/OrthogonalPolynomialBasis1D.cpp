@@ -27,6 +27,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace combigrid {
@@ -203,6 +204,83 @@ double OrthogonalPolynomialBasis1D::evaluate(size_t basisIndex, double xValue) {
 #endif
 }
 
+void OrthogonalPolynomialBasis1D::evaluateBatch(size_t maxBasisIndex,
+                                                std::vector<double> const& xValues,
+                                                std::vector<double>& result) {
+#ifdef USE_DAKOTA
+  size_t numValues = xValues.size();
+  result.resize((maxBasisIndex + 1) * numValues);
+
+  std::vector<double> invNorms(maxBasisIndex + 1);
+  for (size_t j = 0; j <= maxBasisIndex; ++j) {
+    invNorms[j] = 1. / std::sqrt(basisPoly->norm_squared(static_cast<uint16_t>(j)));
+  }
+
+  std::vector<double> normalizedValues(numValues);
+  for (size_t i = 0; i < numValues; ++i) {
+    normalizedValues[i] = normalizeInput(xValues[i]);
+  }
+
+  auto type = config.polyParameters.type_;
+  bool isLegendre = type == OrthogonalPolynomialBasisType::LEGENDRE;
+  bool isHermite = type == OrthogonalPolynomialBasisType::HERMITE ||
+                   type == OrthogonalPolynomialBasisType::BOUNDED_NORMAL;
+
+  if (!isLegendre && !isHermite) {
+    for (size_t j = 0; j <= maxBasisIndex; ++j) {
+      for (size_t i = 0; i < numValues; ++i) {
+        result[j * numValues + i] =
+            invNorms[j] * basisPoly->type1_value(normalizedValues[i], static_cast<uint16_t>(j));
+      }
+    }
+    return;
+  }
+
+  // unnormalized polynomials p_j via the three-term recurrence
+  //   Legendre:  (j + 1) p_{j+1}(x) = (2j + 1) x p_j(x) - j p_{j-1}(x)
+  //   Hermite:           p_{j+1}(x) = x p_j(x) - j p_{j-1}(x)
+  double* values = result.data();
+  double const* x = normalizedValues.data();
+
+#pragma omp simd
+  for (size_t i = 0; i < numValues; ++i) {
+    values[i] = 1.0;
+  }
+
+  if (maxBasisIndex >= 1) {
+    double* current = values + numValues;
+#pragma omp simd
+    for (size_t i = 0; i < numValues; ++i) {
+      current[i] = x[i];
+    }
+  }
+
+  for (size_t j = 1; j < maxBasisIndex; ++j) {
+    double const* previous = values + (j - 1) * numValues;
+    double const* current = values + j * numValues;
+    double* next = values + (j + 1) * numValues;
+    double jd = static_cast<double>(j);
+    double a = isLegendre ? (2.0 * jd + 1.0) / (jd + 1.0) : 1.0;
+    double b = isLegendre ? jd / (jd + 1.0) : jd;
+#pragma omp simd
+    for (size_t i = 0; i < numValues; ++i) {
+      next[i] = a * x[i] * current[i] - b * previous[i];
+    }
+  }
+
+  for (size_t j = 0; j <= maxBasisIndex; ++j) {
+    double* current = values + j * numValues;
+    double invNorm = invNorms[j];
+#pragma omp simd
+    for (size_t i = 0; i < numValues; ++i) {
+      current[i] *= invNorm;
+    }
+  }
+#else
+  AbstractInfiniteFunctionBasis1D::evaluateBatch(maxBasisIndex, xValues, result);
+#endif
+}
+
 double OrthogonalPolynomialBasis1D::pdf(double xValue) {
 #ifdef USE_DAKOTA
   return rv->pdf(xValue);
@@ -16,6 +16,7 @@
 #endif
 
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace combigrid {
@@ -74,6 +75,14 @@ class OrthogonalPolynomialBasis1D : public AbstractInfiniteFunctionBasis1D {
   virtual ~OrthogonalPolynomialBasis1D();
 
   double evaluate(size_t basisIndex, double xValue) override;
+
+  /**
+   * Evaluates the normalized basis polynomials 0, ..., maxBasisIndex at all given points. For
+   * Legendre and Hermite polynomials, the three-term recurrence is evaluated for all points at
+   * once; the other types evaluate the normalization constants only once per degree.
+   */
+  void evaluateBatch(size_t maxBasisIndex, std::vector<double> const& xValues,
+                     std::vector<double>& result) override;
   double pdf(double xValue);
   double mean();
   double variance();
@@ -29,6 +29,39 @@ class KahanAdder {
   double value() const { return sum; }
 };
 
+/**
+ * Kahan adder for the vector types that are used as template parameter V in the combigrid module
+ * (FloatScalarVector, FloatArrayVector, ...). It applies the same compensation as KahanAdder
+ * componentwise, using only the add() and sub() operations of V. The sum is updated in place and
+ * the temporary is a member, so an addition copies a vector twice without allocating (for vectors
+ * of the same size).
+ */
+template <typename V>
+class VectorKahanAdder {
+  V sum = V::zero();
+  // negative of the compensation c of KahanAdder, so that the sum can be updated in place
+  V negC = V::zero();
+  // y of KahanAdder
+  V y = V::zero();
+
+ public:
+  void add(V const &x) {
+    y = x;
+    y.add(negC);
+    negC = sum;
+    sum.add(y);
+    negC.sub(sum);
+    negC.add(y);
+  }
+
+  V const &value() const { return sum; }
+
+  void reset() {
+    sum = V::zero();
+    negC = V::zero();
+  }
+};
+
 } /* namespace combigrid */
 } /* namespace sgpp*/
 
@@ -194,6 +194,15 @@ base::DataVector CombigridMultiOperation::evaluate(size_t q, base::DataMatrix co
   return getResult();
 }
 
+base::DataVector CombigridMultiOperation::evaluateParallel(size_t q, base::DataMatrix const &params,
+                                                           size_t numThreads) {
+  setParameters(params);
+
+  impl->levelManager->addRegularLevelsParallel(q, numThreads);
+
+  return getResult();
+}
+
 std::shared_ptr<AbstractMultiStorage<FloatArrayVector>> CombigridMultiOperation::getDifferences() {
   return impl->combiEval->differences();
 }
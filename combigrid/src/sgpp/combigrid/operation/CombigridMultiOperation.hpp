@@ -119,6 +119,13 @@ class CombigridMultiOperation {
    */
   base::DataVector evaluate(size_t q, base::DataMatrix const &params = base::DataMatrix(0, 0));
 
+  /**
+   * Does the same as evaluate(), but computes the function values and evaluates the full grids of
+   * the different levels with numThreads threads (see LevelManager::addRegularLevelsParallel()).
+   * The result does not depend on numThreads.
+   */
+  base::DataVector evaluateParallel(size_t q, base::DataMatrix const &params, size_t numThreads);
+
   /**
    * @return the storage containing the computed coefficients.
    * For the basic operations these are the function values at evaluation points.
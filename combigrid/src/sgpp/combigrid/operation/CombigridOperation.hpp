@@ -86,6 +86,13 @@ class CombigridOperation {
   double getResult();
 
   double evaluate(size_t q, base::DataVector const &param = base::DataVector(0));
+
+  /**
+   * Does the same as evaluate(), but computes the function values and evaluates the full grids of
+   * the different levels with numThreads threads (see LevelManager::addRegularLevelsParallel()).
+   * The result does not depend on numThreads.
+   */
+  double evaluateParallel(size_t q, base::DataVector const &param, size_t numThreads);
   std::shared_ptr<LevelManager> getLevelManager();
   void setLevelManager(std::shared_ptr<LevelManager> levelManager);
 
@@ -32,6 +32,7 @@ class AbstractLevelEvaluator {
   virtual ~AbstractLevelEvaluator();
 
   virtual bool addLevel(MultiIndex const &level) = 0;
+  virtual void addLevelsParallel(std::vector<MultiIndex> const &levels, size_t numThreads) = 0;
   /**
    * @return An upper bound for the number of points (function evaluations) used for the current
    * computation. This bound is exact if nesting is used or if otherwise each grid point only occurs
@@ -16,12 +16,16 @@
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 #include <sgpp/combigrid/utils/DataVectorHashing.hpp>
 #include <sgpp/combigrid/algebraic/NormStrategy.hpp>
+#include <sgpp/combigrid/numeric/KahanAdder.hpp>
+#include <sgpp/combigrid/threading/ThreadPool.hpp>
 
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <memory>
 #include <queue>
+#include <set>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -35,10 +39,15 @@ namespace combigrid {
  * AbstractFullGridEvaluator.
  * The template parameter V determines whether this does single or multi evaluation, confer also the
  * description in algebraic/FloatArrayVector.hpp
+ *
+ * The differences of all levels are accumulated with Kahan summation in the order in which the
+ * levels are added. Since addLevelsParallel() only distributes the full grid evaluations and keeps
+ * this order, its result is bitwise identical to adding the same levels via addLevel(), regardless
+ * of the number of threads.
  */
 template <typename V>
 class CombigridEvaluator : public AbstractLevelEvaluator {
-  V sum;
+  VectorKahanAdder<V> sum;
   size_t numDimensions;
 
   /**
@@ -81,7 +90,7 @@ class CombigridEvaluator : public AbstractLevelEvaluator {
    */
   CombigridEvaluator(size_t numDimensions, std::shared_ptr<AbstractFullGridEvaluator<V>> multiEval,
                      std::shared_ptr<NormStrategy<V>> normStrategy = nullptr)
-      : sum(V::zero()),
+      : sum(),
         numDimensions(numDimensions),
         partialDifferences(),
         multiEval(multiEval),
@@ -112,7 +121,14 @@ class CombigridEvaluator : public AbstractLevelEvaluator {
    * @return Returns true if the level was already there or (if it was computed and the difference
    * was not nan or +-inf).
    */
-  bool addLevel(MultiIndex const &level) {
+  bool addLevel(MultiIndex const &level) { return addLevel(level, nullptr); }
+
+ private:
+  /**
+   * Implementation of addLevel(). If precomputedValues is not nullptr and contains a value for a
+   * level, this value is used instead of calling eval() on the full grid evaluator.
+   */
+  bool addLevel(MultiIndex const &level, std::map<MultiIndex, V> const *precomputedValues) {
     CGLOG("addLevel(): start");
     if (containsLevel(level)) {
       return true;
@@ -127,14 +143,19 @@ class CombigridEvaluator : public AbstractLevelEvaluator {
 
         // should not affect performance because nothing is computed if the storage
         // already contains a value
-        bool success = addLevel(l);
+        bool success = addLevel(l, precomputedValues);
         if (!success) {
           return false;
         }
       }
     }
     CGLOG("addLevel(): eval level");
-    V value = multiEval->eval(level);
+    V value = V::zero();
+    if (precomputedValues != nullptr && precomputedValues->count(level) > 0) {
+      value = precomputedValues->at(level);
+    } else {
+      value = multiEval->eval(level);
+    }
 
     CGLOG("addLevel(): evaluate partial differences");
     partialDifferences[0]->set(level, value);
@@ -157,6 +178,107 @@ class CombigridEvaluator : public AbstractLevelEvaluator {
     }
   }
 
+  /**
+   * Appends level and all of its predecessors that have not been added yet to pendingLevels (in
+   * the order in which addLevel() would evaluate them).
+   */
+  void collectPendingLevels(MultiIndex const &level, std::vector<MultiIndex> &pendingLevels,
+                            std::set<MultiIndex> &visitedLevels) {
+    if (containsLevel(level) || visitedLevels.count(level) > 0) {
+      return;
+    }
+
+    visitedLevels.insert(level);
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      if (level[d] > 0) {
+        MultiIndex l = level;
+        --l[d];
+        collectPendingLevels(l, pendingLevels, visitedLevels);
+      }
+    }
+
+    pendingLevels.push_back(level);
+  }
+
+ public:
+  /**
+   * Does the same as calling addLevel() for each of the given levels, but distributes the full grid
+   * evaluations of all levels that have to be computed over numThreads threads. Each thread uses
+   * its own clone of the full grid evaluator (see AbstractFullGridEvaluator::clone()). The
+   * differences are combined afterwards in the same order as in the sequential case, thus the
+   * result does not depend on numThreads.
+   * Missing function values are computed in parallel first (via getLevelTasks()), because the
+   * storage may only be read concurrently.
+   */
+  void addLevelsParallel(std::vector<MultiIndex> const &levels, size_t numThreads) {
+    std::vector<MultiIndex> pendingLevels;
+    std::set<MultiIndex> visitedLevels;
+
+    for (auto &level : levels) {
+      collectPendingLevels(level, pendingLevels, visitedLevels);
+    }
+
+    numThreads = std::min(numThreads, pendingLevels.size());
+    std::vector<std::shared_ptr<AbstractFullGridEvaluator<V>>> threadEvals;
+
+    if (numThreads > 1) {
+      for (size_t t = 0; t < numThreads; ++t) {
+        threadEvals.push_back(multiEval->clone());
+      }
+    }
+
+    if (threadEvals.empty()) {
+      for (auto &level : levels) {
+        addLevel(level);
+      }
+
+      return;
+    }
+
+    auto precomputationPool =
+        std::make_shared<ThreadPool>(numThreads, ThreadPool::terminateWhenIdle);
+    multiEval->setMutex(std::make_shared<std::recursive_mutex>());
+
+    for (auto &level : pendingLevels) {
+      precomputationPool->addTasks(multiEval->getLevelTasks(level, ThreadPool::Task([]() {})));
+    }
+
+    precomputationPool->start();
+    precomputationPool->join();
+    multiEval->setMutex(nullptr);
+
+    // fill all lazily initialized data of the point hierarchies before the threads start
+    for (auto &level : pendingLevels) {
+      multiEval->prepareLevel(level);
+    }
+
+    std::vector<V> values(pendingLevels.size(), V::zero());
+    auto threadPool = std::make_shared<ThreadPool>(numThreads, ThreadPool::terminateWhenIdle);
+
+    for (size_t t = 0; t < numThreads; ++t) {
+      auto threadEval = threadEvals[t];
+      threadPool->addTask(ThreadPool::Task([t, numThreads, threadEval, &pendingLevels, &values]() {
+        for (size_t i = t; i < pendingLevels.size(); i += numThreads) {
+          values[i] = threadEval->eval(pendingLevels[i]);
+        }
+      }));
+    }
+
+    threadPool->start();
+    threadPool->join();
+
+    std::map<MultiIndex, V> precomputedValues;
+
+    for (size_t i = 0; i < pendingLevels.size(); ++i) {
+      precomputedValues[pendingLevels[i]] = values[i];
+    }
+
+    for (auto &level : levels) {
+      addLevel(level, &precomputedValues);
+    }
+  }
+
   /**
    * @return An upper bound for the number of points (function evaluations) used for the current
    * computation. This bound is exact if nesting is used or if otherwise each grid point only occurs
@@ -273,13 +395,13 @@ class CombigridEvaluator : public AbstractLevelEvaluator {
    * @return the numerical approximation value computed by the combination technique. No computation
    * is done here.
    */
-  V getValue() const { return sum; }
+  V getValue() const { return sum.value(); }
 
   /**
    * Clears the already computed values. This method has to be called if a parameter changed etc.
    */
   void clear() {
-    sum = V::zero();
+    sum.reset();
     upperPointBound = 0;
     initPartialDifferences();
   }
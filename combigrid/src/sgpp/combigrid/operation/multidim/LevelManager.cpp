@@ -294,12 +294,29 @@ void LevelManager::addLevels(const std::vector<MultiIndex> &levels) {
   }
 }
 
+void LevelManager::addLevelsParallel(const std::vector<MultiIndex> &levels, size_t numThreads) {
+  std::vector<bool> isOldSubspace(levels.size());
+  for (size_t i = 0; i < levels.size(); ++i) {
+    isOldSubspace[i] = combiEval->containsLevel(levels[i]);
+  }
+
+  combiEval->addLevelsParallel(levels, numThreads);
+
+  if (collectStats) {
+    for (size_t i = 0; i < levels.size(); ++i) {
+      if (!isOldSubspace[i] && combiEval->containsLevel(levels[i])) {
+        addStats(levels[i]);
+      }
+    }
+  }
+}
+
 void LevelManager::addRegularLevelsParallel(size_t q, size_t numThreads) {
   auto levels = getRegularLevels(q);
   precomputeLevelsParallel(levels, numThreads);
   // update stats vector
   infoOnAddedLevels->incrementCounter();
-  addLevels(levels);
+  addLevelsParallel(levels, numThreads);
 }
 
 void LevelManager::addRegularLevelsByNumPointsParallel(size_t maxNumPoints, size_t numThreads) {
@@ -307,7 +324,7 @@ void LevelManager::addRegularLevelsByNumPointsParallel(size_t maxNumPoints, size
   precomputeLevelsParallel(levels, numThreads);
   // update stats
   infoOnAddedLevels->incrementCounter();
-  addLevels(levels);
+  addLevelsParallel(levels, numThreads);
 }
 
 void LevelManager::addRegularLevels(size_t q) {
@@ -334,6 +351,12 @@ std::string LevelManager::getSerializedLevelStructure() const {
   return TreeStorageSerializationStrategy<uint8_t>(numDimensions).serialize(getLevelStructure());
 }
 
+void LevelManager::serializeLevelStructureBinary(std::ostream &stream) const {
+  BinaryTreeStorageSerializationStrategy<uint8_t>(
+      numDimensions, std::make_shared<RawBinarySerializationStrategy<uint8_t>>())
+      .serialize(getLevelStructure(), stream);
+}
+
 void LevelManager::addLevelsFromStructure(std::shared_ptr<TreeStorage<uint8_t>> storage) {
   if (storage != nullptr) {
     auto it = storage->getStoredDataIterator();
@@ -358,7 +381,7 @@ void LevelManager::addLevelsFromStructureParallel(std::shared_ptr<TreeStorage<ui
     }
     precomputeLevelsParallel(levels, numThreads);
     infoOnAddedLevels->incrementCounter();
-    addLevels(levels);
+    addLevelsParallel(levels, numThreads);
   }
 }
 
@@ -374,6 +397,21 @@ void LevelManager::addLevelsFromSerializedStructureParallel(std::string serializ
       numThreads);
 }
 
+void LevelManager::addLevelsFromBinaryStructure(std::istream &stream) {
+  addLevelsFromStructure(
+      BinaryTreeStorageSerializationStrategy<uint8_t>(
+          numDimensions, std::make_shared<RawBinarySerializationStrategy<uint8_t>>())
+          .deserialize(stream));
+}
+
+void LevelManager::addLevelsFromBinaryStructureParallel(std::istream &stream, size_t numThreads) {
+  addLevelsFromStructureParallel(
+      BinaryTreeStorageSerializationStrategy<uint8_t>(
+          numDimensions, std::make_shared<RawBinarySerializationStrategy<uint8_t>>())
+          .deserialize(stream),
+      numThreads);
+}
+
 void LevelManager::addLevelsAdaptive(size_t maxNumPoints) {
   initAdaption();
 
@@ -12,15 +12,19 @@
 #include <sgpp/combigrid/operation/multidim/AbstractLevelEvaluator.hpp>
 #include <sgpp/combigrid/operation/multidim/AdaptiveRefinementStrategy.hpp>
 #include <sgpp/combigrid/operation/multidim/LevelHelpers.hpp>
+#include <sgpp/combigrid/serialization/BinaryTreeStorageSerializationStrategy.hpp>
+#include <sgpp/combigrid/serialization/RawBinarySerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/AbstractMultiStorage.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 
 #include <cmath>
+#include <istream>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <queue>
 #include <string>
 #include <unordered_set>
@@ -186,6 +190,12 @@ class LevelManager {
    */
   void addLevels(std::vector<MultiIndex> const &levels);
 
+  /**
+   * Adds all the given levels, evaluating the full grids in parallel with the specified number of
+   * threads (see CombigridEvaluator::addLevelsParallel()).
+   */
+  void addLevelsParallel(std::vector<MultiIndex> const &levels, size_t numThreads);
+
   /**
    * Adds the level to the combigrid evaluator
    * @param level level
@@ -251,7 +261,9 @@ class LevelManager {
   void addRegularLevelsByNumPoints(size_t maxNumPoints);
 
   /**
-   * Does the same as addRegularLevels(), but with parallel precomputation of function values.
+   * Does the same as addRegularLevels(), but with parallel precomputation of function values and
+   * parallel evaluation of the full grids. The result is bitwise identical for all numbers of
+   * threads.
    * @param q  Maximum 1-norm of the level-multi-index, where the levels start from 0 (not from 1 as
    * in most papers).
    * @param numThreads number of threads that should be used for computation
@@ -261,7 +273,7 @@ class LevelManager {
 
   /**
    * Does the same as addRegularLevelsByNumPoints(), but with parallel precomputation of function
-   * values.
+   * values and parallel evaluation of the full grids.
    */
   void addRegularLevelsByNumPointsParallel(size_t maxNumPoints, size_t numThreads);
 
@@ -288,6 +300,12 @@ class LevelManager {
    */
   std::string getSerializedLevelStructure() const;
 
+  /**
+   * Writes getLevelStructure() to the given stream in a compact binary format. The stream should
+   * be opened in binary mode.
+   */
+  void serializeLevelStructureBinary(std::ostream &stream) const;
+
   /**
    * Adds all levels for which an entry is contained in storage. "Inverse" operation to
    * getLevelStructure().
@@ -296,7 +314,7 @@ class LevelManager {
 
   /**
    * Does the same as addLevelsFromStructure(), but with parallel precomputation of function values
-   * using numThreads threads.
+   * and parallel evaluation of the full grids using numThreads threads.
    */
   void addLevelsFromStructureParallel(std::shared_ptr<TreeStorage<uint8_t>> storage,
                                       size_t numThreads = 4);
@@ -313,6 +331,18 @@ class LevelManager {
    */
   void addLevelsFromSerializedStructureParallel(std::string serializedStructure, size_t numThreads);
 
+  /**
+   * Equivalent to reading a level structure from the stream and then calling
+   * addLevelsFromStructure(). "Inverse" operation to serializeLevelStructureBinary().
+   */
+  void addLevelsFromBinaryStructure(std::istream &stream);
+
+  /**
+   * Does the same as addLevelsFromBinaryStructure(), but with parallel precomputation of function
+   * values and parallel evaluation of the full grids using numThreads threads.
+   */
+  void addLevelsFromBinaryStructureParallel(std::istream &stream, size_t numThreads);
+
   /**
    * Adds levels in an adaptive manner, such that the given maximum number of function evaluations
    * (grid points) is not exceeded. The adaption strategy depends on the particular implementation
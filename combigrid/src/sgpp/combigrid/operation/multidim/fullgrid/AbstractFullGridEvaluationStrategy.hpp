@@ -88,7 +88,10 @@ class AbstractFullGridEvaluationStrategy : public AbstractFullGridEvaluator<V> {
    * So if only the evaluators at dimensions 1 and 3 need a parameter, params.size() should be 2 (or
    * at least 2)
    */
-  void setParameters(std::vector<V> const &params) { summationStrategy->setParameters(params); }
+  void setParameters(std::vector<V> const &params) {
+    parameters = params;
+    summationStrategy->setParameters(params);
+  }
 
   std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> getEvaluatorPrototypes() {
     return evaluatorPrototypes;
@@ -100,6 +103,8 @@ class AbstractFullGridEvaluationStrategy : public AbstractFullGridEvaluator<V> {
   std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> evaluatorPrototypes;
   FullGridSummationStrategyType summationStrategyType;
   std::shared_ptr<AbstractFullGridSummationStrategy<V>> summationStrategy;
+  // parameters of the last call to setParameters(), needed for clone()
+  std::vector<V> parameters;
 };
 
 } /* namespace combigrid */
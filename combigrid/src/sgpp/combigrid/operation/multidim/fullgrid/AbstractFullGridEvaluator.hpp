@@ -79,6 +79,26 @@ class AbstractFullGridEvaluator {
    */
   virtual V eval(MultiIndex const &level) = 0;
 
+  /**
+   * @return an independent copy of this evaluator (with the same storage, point hierarchies and
+   * parameters) that can be used to call eval() concurrently to this evaluator. Concurrent calls to
+   * eval() require that the function values of the levels are already contained in the storage
+   * and that prepareLevel() has been called for the levels.
+   */
+  virtual std::shared_ptr<AbstractFullGridEvaluator<V>> clone() = 0;
+
+  /**
+   * Initializes the lazily computed data of the point hierarchies (points, number of points and
+   * sorting permutations) that is needed to evaluate the given level. Afterwards, eval() only reads
+   * from the point hierarchies for this level.
+   */
+  virtual void prepareLevel(MultiIndex const &level) {
+    for (size_t d = 0; d < pointHierarchies.size(); ++d) {
+      pointHierarchies[d]->getPoints(level[d], false);
+      pointHierarchies[d]->getPoints(level[d], true);
+    }
+  }
+
   /**
    * @return Returns the function value storage.
    */
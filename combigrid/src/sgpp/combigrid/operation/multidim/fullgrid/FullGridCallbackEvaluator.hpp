@@ -108,6 +108,16 @@ class FullGridCallbackEvaluator : public AbstractFullGridEvaluationStrategy<V> {
   }
 
   V eval(MultiIndex const &level) override { return this->summationStrategy->eval(level); }
+
+  std::shared_ptr<AbstractFullGridEvaluator<V>> clone() override {
+    auto result = std::make_shared<FullGridCallbackEvaluator<V>>(
+        this->storage, this->evaluatorPrototypes, this->pointHierarchies,
+        this->summationStrategyType);
+    if (!this->parameters.empty()) {
+      result->setParameters(this->parameters);
+    }
+    return result;
+  }
 };
 
 } /* namespace combigrid */
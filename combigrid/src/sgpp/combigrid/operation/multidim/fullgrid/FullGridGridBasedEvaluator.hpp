@@ -103,6 +103,16 @@ class FullGridGridBasedEvaluator : public AbstractFullGridEvaluationStrategy<V>
     std::vector<ThreadPool::Task> tasks;
 
     tasks.push_back(ThreadPool::Task([grid, level, this, callback]() {
+      {
+        // the level may already have been computed, e.g. by a precomputation of the level manager
+        PtrGuard guard(this->mutexPtr);
+
+        if (precomputedLevels->containsIndex(level)) {
+          callback();
+          return;
+        }
+      }
+
       auto results = gridFunction(grid);
 
       // now we need locking
@@ -132,6 +142,18 @@ class FullGridGridBasedEvaluator : public AbstractFullGridEvaluationStrategy<V>
     // call the base eval
     return this->summationStrategy->eval(level);
   }
+
+  std::shared_ptr<AbstractFullGridEvaluator<V>> clone() override {
+    auto result = std::make_shared<FullGridGridBasedEvaluator<V>>(
+        this->storage, this->evaluatorPrototypes, this->pointHierarchies, gridFunction,
+        this->summationStrategyType);
+    // the levels precomputed by this evaluator are in the shared storage
+    result->precomputedLevels = precomputedLevels;
+    if (!this->parameters.empty()) {
+      result->setParameters(this->parameters);
+    }
+    return result;
+  }
 };
 
 } /* namespace combigrid */
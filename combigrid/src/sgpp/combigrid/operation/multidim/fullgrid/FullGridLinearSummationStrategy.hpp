@@ -72,7 +72,11 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
       bool needsOrdered = this->evaluatorPrototypes[d]->needsOrderedPoints();
 
       for (size_t l = currentEvaluators.size(); l <= currentLevel; ++l) {
-        auto eval = this->evaluatorPrototypes[d]->cloneLinear();
+        // evaluators that support it are cloned from the previous level to reuse data that has
+        // been computed for its points (e.g. for nested point hierarchies)
+        auto eval = (l > 0 && currentEvaluators[l - 1]->canCloneForNextLevel())
+                        ? currentEvaluators[l - 1]->cloneLinear()
+                        : this->evaluatorPrototypes[d]->cloneLinear();
 
         eval->setGridPoints(this->pointHierarchies[d]->getPoints(l, needsOrdered));
         eval->setLevel(l);
@@ -122,10 +126,8 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
       // coefficient, then add the resulting value to the total sum
       double value = funcIter->value();
       //      std::cout << std::defaultfloat << value << " ";
-      V vec = this->partialProducts[lastDim];
-      vec.componentwiseMult(this->basisValues[lastDim][it.indexAt(lastDim)]);
-      vec.scalarMult(value);
-      sum.add(vec);
+      sum.addScaledProduct(this->partialProducts[lastDim],
+                           this->basisValues[lastDim][it.indexAt(lastDim)], value);
 
       // increment iterator
       int h = funcIter->moveToNext();
@@ -139,9 +141,8 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
         } else {
           // more than the last index have changed, thus update partialProducts
           for (size_t d = lastDim - h; d < lastDim; ++d) {
-            auto pp = this->partialProducts[d];  // TODO(holzmudd): could probably be optimized...
-            pp.componentwiseMult(this->basisValues[d][it.indexAt(d)]);
-            this->partialProducts[d + 1] = pp;
+            this->partialProducts[d + 1] = this->partialProducts[d];
+            this->partialProducts[d + 1].componentwiseMult(this->basisValues[d][it.indexAt(d)]);
           }
         }
       }
@@ -91,7 +91,11 @@ class FullGridQuadraticSummationStrategy : public AbstractFullGridSummationStrat
       bool needsOrdered = this->evaluatorPrototypes[d]->needsOrderedPoints();
 
       for (size_t l = currentEvaluators.size(); l <= currentLevel; ++l) {
-        auto eval = this->evaluatorPrototypes[d]->cloneLinear();
+        // evaluators that support it are cloned from the previous level to reuse data that has
+        // been computed for its points (e.g. for nested point hierarchies)
+        auto eval = (l > 0 && currentEvaluators[l - 1]->canCloneForNextLevel())
+                        ? currentEvaluators[l - 1]->cloneLinear()
+                        : this->evaluatorPrototypes[d]->cloneLinear();
 
         eval->setGridPoints(this->pointHierarchies[d]->getPoints(l, needsOrdered));
         eval->setLevel(l);
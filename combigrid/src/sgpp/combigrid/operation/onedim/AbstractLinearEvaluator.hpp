@@ -49,10 +49,34 @@ class AbstractLinearEvaluator : public AbstractEvaluator<V> {
    */
   virtual std::shared_ptr<AbstractLinearEvaluator<V>> cloneLinear() = 0;
   virtual std::shared_ptr<AbstractEvaluator<V>> clone() { return cloneLinear(); }
+
+  /**
+   * Returns whether the evaluator for the next level of a point hierarchy may be created by
+   * cloning this evaluator instead of the prototype (followed by setGridPoints() and setLevel()).
+   * This allows evaluators to reuse data computed for the grid points of this level. Only
+   * evaluators whose state is fully updated by setGridPoints() and setLevel() may return true.
+   */
+  virtual bool canCloneForNextLevel() { return false; }
   virtual bool needsOrderedPoints() = 0;
   virtual bool needsParameter() = 0;
   virtual void setParameter(V const& param) = 0;
 
+  /**
+   * Computes the basis values for several parameters at once, basisValues[i] are the basis values
+   * for params[i]. The default implementation sets the parameters one after another, evaluators
+   * may override it with a batched computation. The parameter of the evaluator is unspecified
+   * afterwards.
+   */
+  virtual void getBasisValuesForParameters(std::vector<V> const& params,
+                                           std::vector<std::vector<V>>& basisValues) {
+    basisValues.resize(params.size());
+
+    for (size_t i = 0; i < params.size(); ++i) {
+      setParameter(params[i]);
+      basisValues[i] = getBasisValues();
+    }
+  }
+
   virtual bool hasCustomWeightFunction() { return false; }
   virtual void setWeightFunction(sgpp::combigrid::SingleFunction weight_function) {}
   virtual void getWeightFunction(sgpp::combigrid::SingleFunction& weight_function) {}
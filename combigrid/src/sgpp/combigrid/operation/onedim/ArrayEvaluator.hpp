@@ -6,6 +6,7 @@
 #ifndef COMBIGRID_SRC_SGPP_COMBIGRID_OPERATION_ONEDIM_ARRAYEVALUATOR_HPP_
 #define COMBIGRID_SRC_SGPP_COMBIGRID_OPERATION_ONEDIM_ARRAYEVALUATOR_HPP_
 
+#include <sgpp/combigrid/algebraic/AlignedFloatArrayVector.hpp>
 #include <sgpp/combigrid/algebraic/FloatArrayVector.hpp>
 #include <sgpp/combigrid/algebraic/FloatScalarVector.hpp>
 #include <sgpp/combigrid/definitions.hpp>
@@ -23,31 +24,38 @@ namespace combigrid {
  * This class takes a 1D linear evaluator operating on scalars (which is given through the template
  * type ScalarEvaluator) and uses multiple instances of it for doing multi-evaluation.
  * It is optimized to perform operations common to all of the evaluators only once.
+ * The vector type used for multi-evaluation is given through the template type ArrayVector, which
+ * can be FloatArrayVector or AlignedFloatArrayVector.
  */
-template <typename ScalarEvaluator>
-class ArrayEvaluator : public AbstractLinearEvaluator<FloatArrayVector> {
+template <typename ScalarEvaluator, typename ArrayVector = FloatArrayVector>
+class ArrayEvaluator : public AbstractLinearEvaluator<ArrayVector> {
   ScalarEvaluator evaluator;
-  FloatArrayVector params;
-  std::vector<FloatArrayVector> basisValues;
+  ArrayVector params;
+  std::vector<ArrayVector> basisValues;
   std::vector<double> basisCoefficients;
   bool valuesComputed = false;
   std::vector<double> xValues;
   bool doesNeedParameter;
 
   void computeBasisValues() {
-    basisValues = std::vector<FloatArrayVector>(xValues.size(), FloatArrayVector::zero());
+    basisValues = std::vector<ArrayVector>(xValues.size(), ArrayVector::zero());
 
     if (params.size() == 0) {
       auto coeff = evaluator.getBasisValues();
       for (size_t j = 0; j < coeff.size(); ++j) {
-        basisValues[j].at(0) = coeff[j];
+        basisValues[j].set(0, coeff[j]);
       }
     } else {
+      std::vector<FloatScalarVector> scalarParams(params.size());
       for (size_t i = 0; i < params.size(); ++i) {
-        evaluator.setParameter(params[i]);
-        auto coeff = evaluator.getBasisValues();
-        for (size_t j = 0; j < coeff.size(); ++j) {
-          basisValues[j].at(i) = coeff[j];
+        scalarParams[i] = params[i];
+      }
+
+      std::vector<std::vector<FloatScalarVector>> coeffs;
+      evaluator.getBasisValuesForParameters(scalarParams, coeffs);
+      for (size_t i = 0; i < coeffs.size(); ++i) {
+        for (size_t j = 0; j < coeffs[i].size(); ++j) {
+          basisValues[j].set(i, coeffs[i][j]);
         }
       }
     }
@@ -71,7 +79,7 @@ class ArrayEvaluator : public AbstractLinearEvaluator<FloatArrayVector> {
         xValues(),
         doesNeedParameter(doesNeedParameter) {}
 
-  ArrayEvaluator(ArrayEvaluator<ScalarEvaluator> const &other)
+  ArrayEvaluator(ArrayEvaluator<ScalarEvaluator, ArrayVector> const &other)
       : evaluator(other.evaluator),
         params(other.params),
         basisValues(other.basisValues),
@@ -81,7 +89,7 @@ class ArrayEvaluator : public AbstractLinearEvaluator<FloatArrayVector> {
 
   ~ArrayEvaluator() {}
 
-  std::vector<FloatArrayVector> getBasisValues() override {
+  std::vector<ArrayVector> getBasisValues() override {
     if (!valuesComputed) {
       computeBasisValues();
     }
@@ -101,16 +109,18 @@ class ArrayEvaluator : public AbstractLinearEvaluator<FloatArrayVector> {
     evaluator.setBasisCoefficientsAtGridPoints(newBasisCoefficients);
   }
 
-  std::shared_ptr<AbstractLinearEvaluator<FloatArrayVector>> cloneLinear() override {
-    return std::shared_ptr<AbstractLinearEvaluator<FloatArrayVector>>(
-        new ArrayEvaluator<ScalarEvaluator>(*this));
+  std::shared_ptr<AbstractLinearEvaluator<ArrayVector>> cloneLinear() override {
+    return std::shared_ptr<AbstractLinearEvaluator<ArrayVector>>(
+        new ArrayEvaluator<ScalarEvaluator, ArrayVector>(*this));
   }
 
+  bool canCloneForNextLevel() override { return evaluator.canCloneForNextLevel(); }
+
   bool needsOrderedPoints() override { return evaluator.needsOrderedPoints(); }
 
   bool needsParameter() override { return doesNeedParameter; }
 
-  void setParameter(FloatArrayVector const &param) override {
+  void setParameter(ArrayVector const &param) override {
     this->params = param;
     valuesComputed = false;
   }
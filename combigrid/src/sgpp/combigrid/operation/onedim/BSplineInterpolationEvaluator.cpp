@@ -13,13 +13,17 @@ namespace sgpp {
 namespace combigrid {
 
 BSplineInterpolationEvaluator::BSplineInterpolationEvaluator()
-    : evaluationPoint(0.0), basisValues(), xValues(), degree(3) {
+    : evaluationPoint(0.0), basisValues(), xValues(), degree(3), basisValuesComputed(false) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_BSplineInterpolation;
   evalConfig.degree = 3;
 }
 
 BSplineInterpolationEvaluator::BSplineInterpolationEvaluator(size_t degree)
-    : evaluationPoint(0.0), basisValues(), xValues(), degree(degree) {
+    : evaluationPoint(0.0),
+      basisValues(),
+      xValues(),
+      degree(degree),
+      basisValuesComputed(false) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_BSplineInterpolation;
   evalConfig.degree = degree;
 }
@@ -31,7 +35,8 @@ BSplineInterpolationEvaluator::BSplineInterpolationEvaluator(
     : evaluationPoint(other.evaluationPoint),
       basisValues(other.basisValues),
       xValues(other.xValues),
-      degree(other.degree) {
+      degree(other.degree),
+      basisValuesComputed(other.basisValuesComputed) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_BSplineInterpolation;
   evalConfig.degree = other.degree;
 }
@@ -46,20 +51,34 @@ bool BSplineInterpolationEvaluator::needsOrderedPoints() { return true; }
 
 bool BSplineInterpolationEvaluator::needsParameter() { return true; }
 
-void BSplineInterpolationEvaluator::setDegree(size_t const& deg) { degree = deg; }
+void BSplineInterpolationEvaluator::setDegree(size_t const& deg) {
+  degree = deg;
+  basisValuesComputed = false;
+}
 
 void BSplineInterpolationEvaluator::setParameter(const FloatScalarVector& param) {
+  if (basisValuesComputed && param.value() == evaluationPoint) {
+    return;
+  }
   evaluationPoint = param.value();
-  computeBasisValues();
+  basisValuesComputed = false;
 }
 
 void BSplineInterpolationEvaluator::setGridPoints(std::vector<double> const& x) {
   xValues = x;
-  computeBasisValues();
+  basisValuesComputed = false;
+}
+
+std::vector<FloatScalarVector> BSplineInterpolationEvaluator::getBasisValues() {
+  if (!basisValuesComputed) {
+    computeBasisValues();
+  }
+  return basisValues;
 }
 
 void BSplineInterpolationEvaluator::computeBasisValues() {
   basisValues.resize(xValues.size(), sgpp::combigrid::FloatScalarVector(0));
+  basisValuesComputed = true;
   // ToDo (rehmemk) slows down on laptop, test on neon if this is useful
   // #pragma omp parallel for
   for (size_t i = 0; i < xValues.size(); i++) {
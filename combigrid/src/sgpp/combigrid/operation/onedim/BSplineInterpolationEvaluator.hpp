@@ -16,6 +16,8 @@ namespace combigrid {
 /**
  * This evaluator calculates the B spline evaluations b_i(evaluatioinPoint) for B splines b_i of
  * degree 'degree' and saves these in basisValues
+ * The basis values are computed lazily in getBasisValues() and are reused as long as neither the
+ * grid points nor the parameter change.
  */
 
 class BSplineInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalarVector> {
@@ -25,7 +27,7 @@ class BSplineInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalar
   virtual ~BSplineInterpolationEvaluator();
   BSplineInterpolationEvaluator(BSplineInterpolationEvaluator const &other);
 
-  std::vector<FloatScalarVector> getBasisValues() override { return basisValues; }
+  std::vector<FloatScalarVector> getBasisValues() override;
   std::vector<double> getBasisCoefficients() override { return basisCoefficients; }
 
   void setDegree(size_t const &deg);
@@ -48,6 +50,7 @@ class BSplineInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalar
   std::vector<double> xValues;
 
   size_t degree;
+  bool basisValuesComputed;
 };
 
 } /* namespace combigrid */
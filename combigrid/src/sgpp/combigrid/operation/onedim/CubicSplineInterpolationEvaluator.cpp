@@ -5,13 +5,18 @@
 
 #include <sgpp/combigrid/operation/onedim/CubicSplineInterpolationEvaluator.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
 namespace combigrid {
 
 CubicSplineInterpolationEvaluator::CubicSplineInterpolationEvaluator()
-    : evaluationPoint(0.0), basisValues(), xValues(), gridCoefficients() {
+    : evaluationPoint(0.0),
+      basisValues(),
+      xValues(),
+      gridCoefficients(),
+      basisValuesComputed(false) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_CubicSplineInterpolation;
 }
 
@@ -22,7 +27,8 @@ CubicSplineInterpolationEvaluator::CubicSplineInterpolationEvaluator(
     : evaluationPoint(other.evaluationPoint),
       basisValues(other.basisValues),
       xValues(other.xValues),
-      gridCoefficients(other.gridCoefficients) {
+      gridCoefficients(other.gridCoefficients),
+      basisValuesComputed(other.basisValuesComputed) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_CubicSplineInterpolation;
 }
 
@@ -37,12 +43,23 @@ bool CubicSplineInterpolationEvaluator::needsOrderedPoints() { return true; }
 bool CubicSplineInterpolationEvaluator::needsParameter() { return true; }
 
 void CubicSplineInterpolationEvaluator::setParameter(const FloatScalarVector& param) {
+  if (basisValuesComputed && param.value() == evaluationPoint) {
+    return;
+  }
   evaluationPoint = param.value();
-  computeBasisValues();
+  basisValuesComputed = false;
+}
+
+std::vector<FloatScalarVector> CubicSplineInterpolationEvaluator::getBasisValues() {
+  if (!basisValuesComputed) {
+    computeBasisValues();
+  }
+  return basisValues;
 }
 
 void CubicSplineInterpolationEvaluator::setGridPoints(std::vector<double> const& x) {
   xValues = x;
+  basisValuesComputed = false;
 
   if (xValues.size() < 2) {
     if (xValues.size() == 1) {
@@ -100,11 +117,11 @@ void CubicSplineInterpolationEvaluator::setGridPoints(std::vector<double> const&
       gridCoefficients[j][i].d = d[i];
     }
   }
-
-  computeBasisValues();
 }
 
 void CubicSplineInterpolationEvaluator::computeBasisValues() {
+  basisValuesComputed = true;
+
   if (xValues.size() < 2) {
     if (xValues.size() == 1) {
       basisValues.resize(1);
@@ -113,14 +130,12 @@ void CubicSplineInterpolationEvaluator::computeBasisValues() {
     return;
   }
 
-  size_t j;
-  for (j = 0; j < xValues.size(); j++) {
-    if (xValues[j] > evaluationPoint) {
-      if (j == 0) j++;
-      break;
-    }
-  }
-  j--;
+  // find the spline segment j with xValues[j] <= evaluationPoint < xValues[j + 1] by binary
+  // search; points outside of the grid are extrapolated using the first or last segment
+  size_t numSegments = xValues.size() - 1;
+  size_t j = static_cast<size_t>(std::upper_bound(xValues.begin(), xValues.end(), evaluationPoint) -
+                                 xValues.begin());
+  j = std::min(std::max(j, static_cast<size_t>(1)), numSegments) - 1;
 
   double dx = evaluationPoint - xValues[j];
 
@@ -14,13 +14,19 @@
 namespace sgpp {
 namespace combigrid {
 
+/**
+ * This evaluator does cubic spline interpolation with natural boundary conditions on the given
+ * grid points. The spline coefficients of the Lagrange basis only depend on the grid points and are
+ * computed in setGridPoints(). The basis values are computed lazily in getBasisValues() and are
+ * reused as long as neither the grid points nor the parameter change.
+ */
 class CubicSplineInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalarVector> {
  public:
   CubicSplineInterpolationEvaluator();
   virtual ~CubicSplineInterpolationEvaluator();
   CubicSplineInterpolationEvaluator(CubicSplineInterpolationEvaluator const &other);
 
-  std::vector<FloatScalarVector> getBasisValues() override { return basisValues; }
+  std::vector<FloatScalarVector> getBasisValues() override;
   std::vector<double> getBasisCoefficients() override { return basisCoefficients; }
 
   void setGridPoints(std::vector<double> const &newXValues) override;
@@ -46,6 +52,8 @@ class CubicSplineInterpolationEvaluator : public AbstractLinearEvaluator<FloatSc
   };
 
   std::vector<std::vector<SplineSet>> gridCoefficients;
+
+  bool basisValuesComputed;
 };
 
 } /* namespace combigrid */
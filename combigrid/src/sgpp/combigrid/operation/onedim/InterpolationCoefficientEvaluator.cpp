@@ -54,9 +54,11 @@ void InterpolationCoefficientEvaluator::setGridPoints(const std::vector<double>&
   Eigen::MatrixXd mat(n, n);
 
   // compute the interpolation matrix
+  std::vector<double> values;
+  functionBasis->evaluateBatch(n - 1, xValues, values);
   for (size_t i = 0; i < n; ++i) {
     for (size_t j = 0; j < n; ++j) {
-      mat(i, j) = functionBasis->evaluate(j, xValues[i]);
+      mat(i, j) = values[j * n + i];
     }
   }
 
@@ -6,15 +6,16 @@
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
 #include <sgpp/combigrid/operation/onedim/LinearInterpolationEvaluator.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <vector>
-#include <cmath>
 
 namespace sgpp {
 namespace combigrid {
 
 LinearInterpolationEvaluator::LinearInterpolationEvaluator()
-    : evaluationPoint(0.0), basisValues(), xValues() {
+    : evaluationPoint(0.0), basisValues(), xValues(), basisValuesComputed(false) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_LinearInterpolation;
 }
 
@@ -24,7 +25,8 @@ LinearInterpolationEvaluator::LinearInterpolationEvaluator(
     const LinearInterpolationEvaluator& other)
     : evaluationPoint(other.evaluationPoint),
       basisValues(other.basisValues),
-      xValues(other.xValues) {
+      xValues(other.xValues),
+      basisValuesComputed(other.basisValuesComputed) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_LinearInterpolation;
 }
 
@@ -32,6 +34,7 @@ void LinearInterpolationEvaluator::computeBasisValues() {
   size_t numPoints = xValues.size();
 
   basisValues = std::vector<FloatScalarVector>(numPoints, FloatScalarVector(0.0));
+  basisValuesComputed = true;
 
   if (numPoints == 0) {
     return;
@@ -47,18 +50,20 @@ void LinearInterpolationEvaluator::computeBasisValues() {
     return;
   }
 
-  // TODO(holzmudd): could be optimized by using binary search
-  for (size_t i = 1; i < numPoints; ++i) {
-    if (evaluationPoint <= xValues[i]) {
-      double x0 = xValues[i - 1];
-      double x1 = xValues[i];
+  // the grid points are sorted, so the first grid point that is not smaller than the evaluation
+  // point can be found by binary search
+  auto upper = std::lower_bound(xValues.begin() + 1, xValues.end(), evaluationPoint);
 
-      double weight = (x1 - evaluationPoint) / (x1 - x0);
-      basisValues[i - 1] = FloatScalarVector(weight);
-      basisValues[i] = FloatScalarVector(1 - weight);
+  if (upper != xValues.end()) {
+    size_t i = static_cast<size_t>(upper - xValues.begin());
+    double x0 = xValues[i - 1];
+    double x1 = xValues[i];
 
-      return;
-    }
+    double weight = (x1 - evaluationPoint) / (x1 - x0);
+    basisValues[i - 1] = FloatScalarVector(weight);
+    basisValues[i] = FloatScalarVector(1 - weight);
+
+    return;
   }
 
   // if we did not return in the loop, then evaluationPoint > all xValues...
@@ -68,9 +73,16 @@ void LinearInterpolationEvaluator::computeBasisValues() {
   }
 }
 
+std::vector<FloatScalarVector> LinearInterpolationEvaluator::getBasisValues() {
+  if (!basisValuesComputed) {
+    computeBasisValues();
+  }
+  return basisValues;
+}
+
 void LinearInterpolationEvaluator::setGridPoints(const std::vector<double>& newXValues) {
   xValues = newXValues;
-  computeBasisValues();
+  basisValuesComputed = false;
 }
 
 void LinearInterpolationEvaluator::setBasisCoefficientsAtGridPoints(
@@ -89,8 +101,11 @@ bool LinearInterpolationEvaluator::needsOrderedPoints() { return true; }
 bool LinearInterpolationEvaluator::needsParameter() { return true; }
 
 void LinearInterpolationEvaluator::setParameter(const FloatScalarVector& param) {
+  if (basisValuesComputed && param.value() == evaluationPoint) {
+    return;
+  }
   evaluationPoint = param.value();
-  computeBasisValues();
+  basisValuesComputed = false;
 }
 
 } /* namespace combigrid */
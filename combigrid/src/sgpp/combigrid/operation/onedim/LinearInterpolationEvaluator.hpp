@@ -18,12 +18,15 @@ namespace combigrid {
 /**
  * This evaluator does linear interpolation on the given grid points. If the evaluation point is
  * outside the grid points, it will just use the function value of the nearest grid point.
+ * The basis values are computed lazily in getBasisValues() and are reused as long as neither the
+ * grid points nor the parameter change.
  */
 class LinearInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalarVector> {
   double evaluationPoint;
   std::vector<FloatScalarVector> basisValues;
   std::vector<double> basisCoefficients;
   std::vector<double> xValues;
+  bool basisValuesComputed;
 
   void computeBasisValues();
 
@@ -32,7 +35,7 @@ class LinearInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalarV
   virtual ~LinearInterpolationEvaluator();
   LinearInterpolationEvaluator(LinearInterpolationEvaluator const &other);
 
-  virtual std::vector<FloatScalarVector> getBasisValues() { return basisValues; }
+  virtual std::vector<FloatScalarVector> getBasisValues();
   virtual std::vector<double> getBasisCoefficients() { return basisCoefficients; }
 
   void setGridPoints(std::vector<double> const &newXValues) override;
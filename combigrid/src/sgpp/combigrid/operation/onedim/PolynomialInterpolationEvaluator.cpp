@@ -5,6 +5,7 @@
 
 #include <sgpp/combigrid/operation/onedim/PolynomialInterpolationEvaluator.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <vector>
@@ -17,23 +18,48 @@ PolynomialInterpolationEvaluator::PolynomialInterpolationEvaluator(
     : evaluationPoint(other.evaluationPoint),
       basisValues(other.basisValues),
       wValues(other.wValues),
-      xValues(other.xValues) {
+      wInvValues(other.wInvValues),
+      xValues(other.xValues),
+      basisValuesComputed(other.basisValuesComputed) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_PolynomialInterpolation;
 }
 
 PolynomialInterpolationEvaluator::PolynomialInterpolationEvaluator()
-    : evaluationPoint(0.0), basisValues(), wValues(), xValues() {
+    : evaluationPoint(0.0),
+      basisValues(),
+      wValues(),
+      wInvValues(),
+      xValues(),
+      basisValuesComputed(false) {
   evalConfig.type = CombiEvaluatorTypes::Scalar_PolynomialInterpolation;
 }
 
 PolynomialInterpolationEvaluator::~PolynomialInterpolationEvaluator() {}
 
 void PolynomialInterpolationEvaluator::setGridPoints(std::vector<double> const &newXValues) {
+  // if the old grid points are a prefix of the new ones, the products over the old grid points
+  // can be reused. The factors are multiplied in the same order as in a full recomputation, so the
+  // weights are identical.
+  size_t numOldPoints = 0;
+  if (newXValues.size() >= xValues.size() &&
+      std::equal(xValues.begin(), xValues.end(), newXValues.begin())) {
+    numOldPoints = xValues.size();
+  }
+
   this->xValues = newXValues;
   size_t numPoints = xValues.size();
   wValues.resize(numPoints);
+  wInvValues.resize(numPoints);
 
-  for (size_t i = 0; i < numPoints; ++i) {
+  for (size_t i = 0; i < numOldPoints; ++i) {
+    auto x = xValues[i];
+
+    for (size_t j = numOldPoints; j < numPoints; ++j) {
+      wInvValues[i] *= x - xValues[j];
+    }
+  }
+
+  for (size_t i = numOldPoints; i < numPoints; ++i) {
     auto x = xValues[i];
     double wInv = 1.0;
 
@@ -45,10 +71,23 @@ void PolynomialInterpolationEvaluator::setGridPoints(std::vector<double> const &
       wInv *= x - xValues[j];
     }
 
-    wValues[i] = 1.0 / wInv;
+    wInvValues[i] = wInv;
   }
 
-  computeBasisValues();
+  for (size_t i = 0; i < numPoints; ++i) {
+    wValues[i] = 1.0 / wInvValues[i];
+  }
+
+  basisValuesComputed = false;
+}
+
+std::vector<FloatScalarVector> PolynomialInterpolationEvaluator::getBasisValues() {
+  if (!basisValuesComputed) {
+    basisValues.resize(xValues.size());
+    computeBasisValues(evaluationPoint, basisValues.data());
+    basisValuesComputed = true;
+  }
+  return basisValues;
 }
 
 std::shared_ptr<AbstractLinearEvaluator<FloatScalarVector> >
@@ -61,20 +100,20 @@ bool PolynomialInterpolationEvaluator::needsOrderedPoints() { return false; }
 
 bool PolynomialInterpolationEvaluator::needsParameter() { return true; }
 
-void PolynomialInterpolationEvaluator::computeBasisValues() {
+void PolynomialInterpolationEvaluator::computeBasisValues(double x,
+                                                          FloatScalarVector *values) const {
   double sum = 0.0;
   const double minDeviation =
       std::numeric_limits<double>::min() / std::numeric_limits<double>::epsilon();
   size_t numPoints = xValues.size();
-  basisValues.resize(numPoints);
 
   for (size_t i = 0; i < numPoints; ++i) {
-    double diff = evaluationPoint - xValues[i];
+    double diff = x - xValues[i];
 
     // very near to a interpolation value, must not divide by zero
     if (std::fabs(diff) < minDeviation) {
       for (size_t j = 0; j < numPoints; ++j) {
-        basisValues[j] = (i == j) ? 1.0 : 0.0;
+        values[j] = (i == j) ? 1.0 : 0.0;
       }
       return;
     }
@@ -82,17 +121,32 @@ void PolynomialInterpolationEvaluator::computeBasisValues() {
     double unweightedTerm = wValues[i] / diff;
 
     sum += unweightedTerm;
-    basisValues[i] = unweightedTerm;
+    values[i] = unweightedTerm;
   }
 
   for (size_t i = 0; i < numPoints; ++i) {
-    basisValues[i].value() /= sum;
+    values[i].value() /= sum;
+  }
+}
+
+void PolynomialInterpolationEvaluator::getBasisValuesForParameters(
+    std::vector<FloatScalarVector> const &params,
+    std::vector<std::vector<FloatScalarVector>> &basisValues) {
+  // the weights are shared by all parameters, so there is no need to go through setParameter()
+  basisValues.resize(params.size());
+
+  for (size_t i = 0; i < params.size(); ++i) {
+    basisValues[i].resize(xValues.size());
+    computeBasisValues(params[i].value(), basisValues[i].data());
   }
 }
 
 void PolynomialInterpolationEvaluator::setParameter(const FloatScalarVector &param) {
+  if (basisValuesComputed && param.value() == evaluationPoint) {
+    return;
+  }
   evaluationPoint = param.value();
-  computeBasisValues();
+  basisValuesComputed = false;
 }
 
 void PolynomialInterpolationEvaluator::setBasisCoefficientsAtGridPoints(
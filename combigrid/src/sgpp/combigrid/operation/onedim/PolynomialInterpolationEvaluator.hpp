@@ -18,6 +18,11 @@ namespace combigrid {
 /**
  * This evaluator does polynomial interpolation (using the barycentric approach) on the given grid
  * points.
+ * The barycentric weights only depend on the grid points. If the grid points of the previous call
+ * to setGridPoints() are a prefix of the new grid points (as it is the case for nested point
+ * hierarchies when the evaluator of the previous level is cloned, see canCloneForNextLevel()), the
+ * weights are updated instead of being recomputed. The basis values are computed lazily in
+ * getBasisValues() and are reused as long as neither the grid points nor the parameter change.
  */
 class PolynomialInterpolationEvaluator : public AbstractLinearEvaluator<FloatScalarVector> {
   double evaluationPoint;
@@ -25,26 +30,30 @@ class PolynomialInterpolationEvaluator : public AbstractLinearEvaluator<FloatSca
   std::vector<double> basisCoefficients;
 
   std::vector<double> wValues;
+  std::vector<double> wInvValues;
   std::vector<double> xValues;
+  bool basisValuesComputed;
 
-  void computeBasisValues();
+  void computeBasisValues(double x, FloatScalarVector *values) const;
 
  public:
   PolynomialInterpolationEvaluator();
   virtual ~PolynomialInterpolationEvaluator();
   PolynomialInterpolationEvaluator(PolynomialInterpolationEvaluator const &other);
 
-  std::vector<FloatScalarVector> getBasisValues() override { return basisValues; }
+  std::vector<FloatScalarVector> getBasisValues() override;
   std::vector<double> getBasisCoefficients() override { return basisCoefficients; }
 
   void setGridPoints(std::vector<double> const &newXValues) override;
   void setBasisCoefficientsAtGridPoints(std::vector<double> &functionValues) override;
   std::shared_ptr<AbstractLinearEvaluator<FloatScalarVector>> cloneLinear() override;
+  bool canCloneForNextLevel() override { return true; }
   bool needsOrderedPoints() override;
   bool needsParameter() override;
   void setParameter(FloatScalarVector const &param) override;
-
-  // TODO(holzmudd): eval could be optimized...
+  void getBasisValuesForParameters(
+      std::vector<FloatScalarVector> const &params,
+      std::vector<std::vector<FloatScalarVector>> &basisValues) override;
 };
 
 } /* namespace combigrid */
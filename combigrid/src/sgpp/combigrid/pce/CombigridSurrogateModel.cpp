@@ -24,7 +24,8 @@ CombigridSurrogateModelConfiguration::CombigridSurrogateModelConfiguration()
       coefficientStorage(nullptr),
       weightFunctions(0),
       enableLevelManagerStatsCollection(false),
-      numDimensions(0) {}
+      numDimensions(0),
+      numThreads(1) {}
 
 CombigridSurrogateModelConfiguration::~CombigridSurrogateModelConfiguration() {}
 
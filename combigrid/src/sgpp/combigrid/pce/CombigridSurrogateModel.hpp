@@ -65,6 +65,9 @@ class CombigridSurrogateModelConfiguration {
   bool enableLevelManagerStatsCollection;
   size_t numDimensions;
 
+  // number of threads used to compute the full grid contributions of the levels in levelStructure
+  size_t numThreads;
+
   void loadFromCombigridOperation(std::shared_ptr<CombigridOperation> op,
                                   bool loadLevelStructure = true);
   void loadFromCombigridOperation(std::shared_ptr<CombigridMultiOperation> op,
@@ -20,6 +20,7 @@
 #include <pecos_data_types.hpp>
 #endif
 
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
@@ -48,18 +49,24 @@ PolynomialChaosExpansion::PolynomialChaosExpansion(
 PolynomialChaosExpansion::~PolynomialChaosExpansion() {}
 
 double PolynomialChaosExpansion::eval(sgpp::base::DataVector& x) {
+  // 1D basis values of all degrees that occur in the expansion
+  std::vector<std::vector<double>> basisValues(numDims);
+  std::vector<double> xk(1);
+  for (size_t k = 0; k < numDims; k++) {
+    xk[0] = x[k];
+    basisFunctions[k]->evaluateBatch(maxDegrees[k], xk, basisValues[k]);
+  }
+
   double ans = 0.0;
-  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
-       it->moveToNext()) {
-    MultiIndex ix = it->getMultiIndex();
-    double coeff = it->value().value();
+  for (size_t c = 0; c < coefficients.size(); c++) {
+    size_t const* ix = &multiIndices[c * numDims];
 
     // evaluate tensor product
     double poly = 1.0;
-    for (size_t k = 0; k < ix.size(); k++) {
-      poly *= basisFunctions[k]->evaluate(ix[k], x[k]);
+    for (size_t k = 0; k < numDims; k++) {
+      poly *= basisValues[k][ix[k]];
     }
-    ans += coeff * poly;
+    ans += coefficients[c] * poly;
   }
   return ans;
 }
@@ -68,19 +75,77 @@ void PolynomialChaosExpansion::eval(sgpp::base::DataMatrix& xs, sgpp::base::Data
   size_t numSamples = xs.getNrows();
   res.resize(numSamples);
   res.setAll(0.0);
-  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
-       it->moveToNext()) {
-    MultiIndex ix = it->getMultiIndex();
-    double coeff = it->value().value();
 
-    for (size_t i = 0; i < numSamples; i++) {
+  size_t numCoefficients = coefficients.size();
+  if (numSamples == 0 || numCoefficients == 0) {
+    return;
+  }
+
+  // The samples are processed in blocks such that the 1D basis values of a block stay in the
+  // cache. The first block is evaluated sequentially, which initializes lazily computed data of
+  // the basis functions before the remaining blocks are evaluated in parallel.
+  const size_t blockSize = 256;
+  size_t numBlocks = (numSamples + blockSize - 1) / blockSize;
+  double* result = res.getPointer();
+
+  auto evalBlock = [&](size_t block, std::vector<double>& x,
+                       std::vector<std::vector<double>>& basisValues, std::vector<double>& poly) {
+    size_t offset = block * blockSize;
+    size_t n = std::min(blockSize, numSamples - offset);
+
+    x.resize(n);
+    for (size_t k = 0; k < numDims; k++) {
+      for (size_t i = 0; i < n; i++) {
+        x[i] = xs.get(offset + i, k);
+      }
+      basisFunctions[k]->evaluateBatch(maxDegrees[k], x, basisValues[k]);
+    }
+
+    poly.resize(n);
+    double* polyValues = poly.data();
+    double* blockResult = result + offset;
+
+    for (size_t c = 0; c < numCoefficients; c++) {
+      double coeff = coefficients[c];
+      size_t const* ix = &multiIndices[c * numDims];
+
+#pragma omp simd
+      for (size_t i = 0; i < n; i++) {
+        polyValues[i] = 1.0;
+      }
+
       // evaluate tensor product
-      double poly = 1.0;
-      for (size_t k = 0; k < ix.size(); k++) {
-        poly *= basisFunctions[k]->evaluate(ix[k], xs.get(i, k));
+      for (size_t k = 0; k < numDims; k++) {
+        double const* values = basisValues[k].data() + ix[k] * n;
+#pragma omp simd
+        for (size_t i = 0; i < n; i++) {
+          polyValues[i] *= values[i];
+        }
+      }
+
+#pragma omp simd
+      for (size_t i = 0; i < n; i++) {
+        blockResult[i] += coeff * polyValues[i];
       }
+    }
+  };
+
+  {
+    std::vector<double> x;
+    std::vector<std::vector<double>> basisValues(numDims);
+    std::vector<double> poly;
+    evalBlock(0, x, basisValues, poly);
+  }
+
+#pragma omp parallel if (numBlocks > 2)
+  {
+    std::vector<double> x;
+    std::vector<std::vector<double>> basisValues(numDims);
+    std::vector<double> poly;
 
-      res[i] += coeff * poly;
+#pragma omp for schedule(static)
+    for (size_t block = 1; block < numBlocks; block++) {
+      evalBlock(block, x, basisValues, poly);
     }
   }
 }
@@ -223,7 +288,12 @@ void PolynomialChaosExpansion::updateConfig(
   }
 
   if (config.levelStructure) {
-    combigridTensorOperation->getLevelManager()->addLevelsFromStructure(config.levelStructure);
+    if (config.numThreads > 1) {
+      combigridTensorOperation->getLevelManager()->addLevelsFromStructureParallel(
+          config.levelStructure, config.numThreads);
+    } else {
+      combigridTensorOperation->getLevelManager()->addLevelsFromStructure(config.levelStructure);
+    }
     computedSobolIndicesFlag = false;
   }
 
@@ -232,6 +302,22 @@ void PolynomialChaosExpansion::updateConfig(
   }
 
   expansionCoefficients = combigridTensorOperation->getResult();
+  flattenExpansionCoefficients();
+}
+
+void PolynomialChaosExpansion::flattenExpansionCoefficients() {
+  multiIndices.clear();
+  coefficients.clear();
+  maxDegrees.assign(numDims, 0);
+  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
+       it->moveToNext()) {
+    MultiIndex ix = it->getMultiIndex();
+    for (size_t k = 0; k < numDims; k++) {
+      multiIndices.push_back(ix[k]);
+      maxDegrees[k] = std::max(maxDegrees[k], ix[k]);
+    }
+    coefficients.push_back(it->value().value());
+  }
 }
 
 size_t PolynomialChaosExpansion::numGridPoints() {
@@ -30,6 +30,11 @@ class PolynomialChaosExpansion : public CombigridSurrogateModel {
   virtual ~PolynomialChaosExpansion();
 
   double eval(sgpp::base::DataVector& x) override;
+  /**
+   * Evaluates the expansion at all rows of xs. The 1D basis values are computed once per block of
+   * samples and dimension (see AbstractInfiniteFunctionBasis1D::evaluateBatch()) and the blocks are
+   * processed in parallel using OpenMP.
+   */
   void eval(sgpp::base::DataMatrix& xs, sgpp::base::DataVector& res) override;
 
   double mean() override;
@@ -48,6 +53,7 @@ class PolynomialChaosExpansion : public CombigridSurrogateModel {
  private:
   bool updateStatus();
   void computeComponentSobolIndices();
+  void flattenExpansionCoefficients();
 
 #ifdef USE_DAKOTA
   std::shared_ptr<Pecos::OrthogPolyApproximation> orthogPoly;
@@ -60,6 +66,12 @@ class PolynomialChaosExpansion : public CombigridSurrogateModel {
   std::shared_ptr<sgpp::combigrid::CombigridTensorOperation> combigridTensorOperation;
   sgpp::combigrid::FloatTensorVector expansionCoefficients;
 
+  // flattened expansion coefficients for the evaluation: the multi-indices (numDims entries per
+  // coefficient), the coefficients and the maximal degree in each dimension
+  std::vector<size_t> multiIndices;
+  std::vector<double> coefficients;
+  std::vector<size_t> maxDegrees;
+
   size_t currentNumGridPoints;
   bool computedSobolIndicesFlag;
   sgpp::base::DataVector sobolIndices;
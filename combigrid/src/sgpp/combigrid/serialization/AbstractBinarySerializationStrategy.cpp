@@ -0,0 +1,47 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include "AbstractBinarySerializationStrategy.hpp"
+
+#include <stdexcept>
+
+namespace sgpp {
+namespace combigrid {
+
+void writeVarint(std::ostream &stream, uint64_t value) {
+  char buffer[10];
+  size_t length = 0;
+
+  while (value >= 0x80) {
+    buffer[length++] = static_cast<char>((value & 0x7F) | 0x80);
+    value >>= 7;
+  }
+  buffer[length++] = static_cast<char>(value);
+
+  stream.write(buffer, static_cast<std::streamsize>(length));
+}
+
+uint64_t readVarint(std::istream &stream) {
+  uint64_t value = 0;
+
+  for (size_t shift = 0; shift < 64; shift += 7) {
+    int byte = stream.get();
+
+    if (byte == std::istream::traits_type::eof()) {
+      throw std::runtime_error("readVarint(): unexpected end of stream");
+    }
+
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+
+    if ((byte & 0x80) == 0) {
+      return value;
+    }
+  }
+
+  throw std::runtime_error("readVarint(): invalid varint");
+}
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
@@ -0,0 +1,71 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_ABSTRACTBINARYSERIALIZATIONSTRATEGY_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_ABSTRACTBINARYSERIALIZATIONSTRATEGY_HPP_
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * This is an abstract base class for strategies writing objects of type T (template parameter) to
+ * a binary stream and reading them back. In contrast to AbstractSerializationStrategy, no
+ * intermediate strings are created, such that large amounts of data (e.g. all function values of
+ * a CombigridTreeStorage) can be written to and read from files directly.
+ * Streams should be opened in binary mode (std::ios::binary).
+ */
+template <typename T>
+class AbstractBinarySerializationStrategy {
+ public:
+  virtual ~AbstractBinarySerializationStrategy() {}
+
+  virtual void serialize(T const &value, std::ostream &stream) = 0;
+  virtual T deserialize(std::istream &stream) = 0;
+
+  /**
+   * Writes a block of values. Subclasses may override this to write the whole block at once.
+   */
+  virtual void serializeBlock(std::vector<T> const &values, std::ostream &stream) {
+    for (auto &value : values) {
+      serialize(value, stream);
+    }
+  }
+
+  /**
+   * Reads a block of numValues values that has been written by serializeBlock().
+   */
+  virtual std::vector<T> deserializeBlock(size_t numValues, std::istream &stream) {
+    std::vector<T> values;
+    values.reserve(numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+      values.push_back(deserialize(stream));
+    }
+    return values;
+  }
+};
+
+/**
+ * Writes an unsigned integer in LEB128 format (7 bits per byte, the highest bit indicates whether
+ * more bytes follow), i.e. values below 128 only need one byte.
+ */
+void writeVarint(std::ostream &stream, uint64_t value);
+
+/**
+ * Reads an unsigned integer written by writeVarint(). Throws std::runtime_error if the stream ends
+ * prematurely.
+ */
+uint64_t readVarint(std::istream &stream);
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_ABSTRACTBINARYSERIALIZATIONSTRATEGY_HPP_ */
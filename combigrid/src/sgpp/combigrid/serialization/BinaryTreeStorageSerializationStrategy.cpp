@@ -0,0 +1,10 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include "BinaryTreeStorageSerializationStrategy.hpp"
+
+namespace sgpp {
+namespace combigrid {} /* namespace combigrid */
+} /* namespace sgpp*/
@@ -0,0 +1,110 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYTREESTORAGESERIALIZATIONSTRATEGY_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYTREESTORAGESERIALIZATIONSTRATEGY_HPP_
+
+#include <sgpp/combigrid/definitions.hpp>
+#include <sgpp/combigrid/serialization/AbstractBinarySerializationStrategy.hpp>
+#include <sgpp/combigrid/serialization/RawBinarySerializationStrategy.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * This class provides a binary serialization strategy for TreeStorage<T>-objects. It is the
+ * compact counterpart of TreeStorageSerializationStrategy and writes directly to a stream.
+ * The format of a serialized storage is
+ *   numDimensions, numEntries (varints),
+ *   numEntries * numDimensions multi-index entries (varints),
+ *   the block of numEntries values (written by the inner strategy).
+ * Since the values are grouped in one block, nesting this strategy (e.g. for the
+ * TreeStorage<std::shared_ptr<TreeStorage<double>>> of CombigridTreeStorage) yields one block of
+ * raw doubles per level.
+ */
+template <typename T>
+class BinaryTreeStorageSerializationStrategy
+    : public AbstractBinarySerializationStrategy<std::shared_ptr<TreeStorage<T>>> {
+  std::shared_ptr<AbstractBinarySerializationStrategy<T>> innerStrategy;
+  size_t numDimensions;
+
+ public:
+  /**
+   * Constructor.
+   * @param numDimensions Dimension of the tree storage.
+   * @param innerStrategy Strategy that should be used to serialize the contained objects of the
+   * TreeStorage. For arithmetic types, a RawBinarySerializationStrategy<T> can be used.
+   */
+  BinaryTreeStorageSerializationStrategy(
+      size_t numDimensions, std::shared_ptr<AbstractBinarySerializationStrategy<T>> innerStrategy)
+      : innerStrategy(innerStrategy), numDimensions(numDimensions) {}
+
+  virtual ~BinaryTreeStorageSerializationStrategy() {}
+
+  virtual void serialize(std::shared_ptr<TreeStorage<T>> const &storage, std::ostream &stream) {
+    std::vector<T> values;
+
+    if (storage != nullptr) {
+      for (auto it = storage->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+        values.push_back(it->value());
+      }
+    }
+
+    writeVarint(stream, numDimensions);
+    writeVarint(stream, values.size());
+
+    if (storage != nullptr) {
+      for (auto it = storage->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+        MultiIndex multiIndex = it->getMultiIndex();
+        for (size_t d = 0; d < numDimensions; ++d) {
+          writeVarint(stream, multiIndex[d]);
+        }
+      }
+    }
+
+    innerStrategy->serializeBlock(values, stream);
+  }
+
+  virtual std::shared_ptr<TreeStorage<T>> deserialize(std::istream &stream) {
+    size_t storedDimensions = static_cast<size_t>(readVarint(stream));
+
+    if (storedDimensions != numDimensions) {
+      throw std::runtime_error(
+          "BinaryTreeStorageSerializationStrategy::deserialize(): dimension mismatch");
+    }
+
+    size_t numEntries = static_cast<size_t>(readVarint(stream));
+
+    std::vector<MultiIndex> multiIndices(numEntries, MultiIndex(numDimensions));
+
+    for (size_t i = 0; i < numEntries; ++i) {
+      for (size_t d = 0; d < numDimensions; ++d) {
+        multiIndices[i][d] = static_cast<size_t>(readVarint(stream));
+      }
+    }
+
+    std::vector<T> values = innerStrategy->deserializeBlock(numEntries, stream);
+
+    auto storage = std::make_shared<TreeStorage<T>>(numDimensions);
+
+    for (size_t i = 0; i < numEntries; ++i) {
+      storage->set(multiIndices[i], values[i]);
+    }
+
+    return storage;
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_BINARYTREESTORAGESERIALIZATIONSTRATEGY_HPP_ */
@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_RAWBINARYSERIALIZATIONSTRATEGY_HPP_
+#define COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_RAWBINARYSERIALIZATIONSTRATEGY_HPP_
+
+#include <sgpp/combigrid/serialization/AbstractBinarySerializationStrategy.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * This class provides an exact binary serialization strategy for arithmetic types (e.g. double,
+ * uint8_t). The bytes of each value are written in little-endian order, independent of the
+ * platform. On little-endian platforms, blocks of values are written and read with a single call.
+ */
+template <typename T>
+class RawBinarySerializationStrategy : public AbstractBinarySerializationStrategy<T> {
+  static_assert(std::is_arithmetic<T>::value,
+                "RawBinarySerializationStrategy is only defined for arithmetic types");
+
+  static bool isLittleEndian() {
+    uint16_t one = 1;
+    unsigned char firstByte;
+    std::memcpy(&firstByte, &one, 1);
+    return firstByte == 1;
+  }
+
+  static void checkStream(std::istream &stream) {
+    if (!stream) {
+      throw std::runtime_error("RawBinarySerializationStrategy: unexpected end of stream");
+    }
+  }
+
+ public:
+  virtual ~RawBinarySerializationStrategy() {}
+
+  virtual void serialize(T const &value, std::ostream &stream) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (!isLittleEndian()) {
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+    stream.write(bytes, sizeof(T));
+  }
+
+  virtual T deserialize(std::istream &stream) {
+    char bytes[sizeof(T)];
+    stream.read(bytes, sizeof(T));
+    checkStream(stream);
+    if (!isLittleEndian()) {
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+  }
+
+  virtual void serializeBlock(std::vector<T> const &values, std::ostream &stream) {
+    if (!isLittleEndian()) {
+      AbstractBinarySerializationStrategy<T>::serializeBlock(values, stream);
+      return;
+    }
+    stream.write(reinterpret_cast<char const *>(values.data()),
+                 static_cast<std::streamsize>(values.size() * sizeof(T)));
+  }
+
+  virtual std::vector<T> deserializeBlock(size_t numValues, std::istream &stream) {
+    if (!isLittleEndian()) {
+      return AbstractBinarySerializationStrategy<T>::deserializeBlock(numValues, stream);
+    }
+    std::vector<T> values(numValues);
+    stream.read(reinterpret_cast<char *>(values.data()),
+                static_cast<std::streamsize>(numValues * sizeof(T)));
+    checkStream(stream);
+    return values;
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp*/
+
+#endif /* COMBIGRID_SRC_SGPP_COMBIGRID_SERIALIZATION_RAWBINARYSERIALIZATIONSTRATEGY_HPP_ */
@@ -10,8 +10,10 @@
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/storage/AbstractMultiStorageIterator.hpp>
 
+#include <istream>
 #include <memory>
 #include <mutex>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -59,6 +61,17 @@ class AbstractCombigridStorage {
    */
   virtual void deserialize(std::string const &str) = 0;
 
+  /**
+   * Writes all stored values to the given stream in a compact binary format. This is much faster
+   * and smaller than serialize() for large storages. The stream should be opened in binary mode.
+   */
+  virtual void serializeBinary(std::ostream &stream) = 0;
+
+  /**
+   * Re-loads storage values from a stream whose content has been generated by serializeBinary().
+   */
+  virtual void deserializeBinary(std::istream &stream) = 0;
+
   /**
    * Sets a value at the given level-index pair, creating a new entry if no value had been
    * previously stored at this level-index pair.
@@ -5,7 +5,9 @@
 
 #include "CombigridTreeStorage.hpp"
 
+#include <sgpp/combigrid/serialization/BinaryTreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
+#include <sgpp/combigrid/serialization/RawBinarySerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
 
@@ -176,6 +178,34 @@ void CombigridTreeStorage::deserialize(const std::string &str) {
   impl->setFunctions();
 }
 
+void CombigridTreeStorage::serializeBinary(std::ostream &stream) {
+  size_t numDimensions = impl->pointHierarchies.size();
+
+  std::shared_ptr<AbstractBinarySerializationStrategy<std::shared_ptr<TreeStorage<double>>>>
+      innerSerializationStrategy = std::make_shared<BinaryTreeStorageSerializationStrategy<double>>(
+          numDimensions, std::make_shared<RawBinarySerializationStrategy<double>>());
+
+  BinaryTreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>>
+      outerSerializationStrategy(numDimensions, innerSerializationStrategy);
+
+  outerSerializationStrategy.serialize(impl->storage, stream);
+}
+
+void CombigridTreeStorage::deserializeBinary(std::istream &stream) {
+  size_t numDimensions = impl->pointHierarchies.size();
+
+  std::shared_ptr<AbstractBinarySerializationStrategy<std::shared_ptr<TreeStorage<double>>>>
+      innerSerializationStrategy = std::make_shared<BinaryTreeStorageSerializationStrategy<double>>(
+          numDimensions, std::make_shared<RawBinarySerializationStrategy<double>>());
+
+  BinaryTreeStorageSerializationStrategy<std::shared_ptr<TreeStorage<double>>>
+      outerSerializationStrategy(numDimensions, innerSerializationStrategy);
+
+  impl->storage = outerSerializationStrategy.deserialize(stream);
+
+  impl->setFunctions();
+}
+
 void CombigridTreeStorage::set(const MultiIndex &level, const MultiIndex &index, double value) {
   MultiIndex reducedLevel = level;
   size_t numDimensions = impl->pointHierarchies.size();
@@ -68,6 +68,9 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
   virtual std::string serialize();
   virtual void deserialize(std::string const &str);
 
+  virtual void serializeBinary(std::ostream &stream);
+  virtual void deserializeBinary(std::istream &stream);
+
   virtual void set(MultiIndex const &level, MultiIndex const &index, double value);
   double get(MultiIndex const &level, MultiIndex const &index) override;
   virtual void setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr);
@@ -8,9 +8,17 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/combigrid/algebraic/AlignedFloatArrayVector.hpp>
 #include <sgpp/combigrid/integration/MCIntegrator.hpp>
 #include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/operation/Configurations.hpp>
+#include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
+#include <sgpp/combigrid/operation/multidim/CombigridEvaluator.hpp>
+#include <sgpp/combigrid/operation/multidim/fullgrid/FullGridCallbackEvaluator.hpp>
+#include <sgpp/combigrid/operation/onedim/ArrayEvaluator.hpp>
+#include <sgpp/combigrid/operation/onedim/CubicSplineInterpolationEvaluator.hpp>
+#include <sgpp/combigrid/operation/onedim/PolynomialInterpolationEvaluator.hpp>
 #include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
 #include <sgpp/combigrid/utils/Stopwatch.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
@@ -26,7 +34,9 @@
 
 using sgpp::base::DataVector;
 using sgpp::combigrid::AbstractMultiStorage;
+using sgpp::combigrid::AlignedFloatArrayVector;
 using sgpp::combigrid::FloatArrayVector;
+using sgpp::combigrid::FloatScalarVector;
 using sgpp::combigrid::CombigridMultiOperation;
 using sgpp::combigrid::MultiFunction;
 using sgpp::combigrid::Stopwatch;
@@ -205,8 +215,143 @@ void computeQuadratureError(size_t d, size_t q,
             << ": err_quad = " << std::abs(result - ctInterpolator->evaluate(q)[0]) << std::endl;
 }
 
+/**
+ * Interpolates func with a regular combination technique of level q at all given points
+ * simultaneously, using V as the vector type for the multi-evaluation.
+ */
+template <typename V>
+std::vector<double> multiEvaluate(size_t d, size_t q, MultiFunction func,
+                                  std::vector<DataVector> const &points) {
+  std::vector<std::shared_ptr<sgpp::combigrid::AbstractPointHierarchy>> hierarchies(
+      d, sgpp::combigrid::CombiHierarchies::expClenshawCurtis());
+  std::vector<std::shared_ptr<sgpp::combigrid::AbstractLinearEvaluator<V>>> evaluators(
+      d, std::make_shared<
+             sgpp::combigrid::ArrayEvaluator<sgpp::combigrid::PolynomialInterpolationEvaluator, V>>(
+             true));
+  auto storage = std::make_shared<sgpp::combigrid::CombigridTreeStorage>(hierarchies, func);
+  auto fullGridEval = std::make_shared<sgpp::combigrid::FullGridCallbackEvaluator<V>>(
+      storage, evaluators, hierarchies);
+  auto combiEval = std::make_shared<sgpp::combigrid::CombigridEvaluator<V>>(d, fullGridEval);
+  auto levelManager = std::make_shared<sgpp::combigrid::AveragingLevelManager>();
+  levelManager->setLevelEvaluator(combiEval);
+
+  std::vector<V> params(d);
+  for (size_t i = 0; i < points.size(); ++i) {
+    for (size_t j = 0; j < d; ++j) {
+      params[j].set(i, FloatScalarVector(points[i][j]));
+    }
+  }
+  fullGridEval->setParameters(params);
+  levelManager->addRegularLevels(q);
+
+  V value = combiEval->getValue();
+  std::vector<double> result(value.size());
+  for (size_t i = 0; i < value.size(); ++i) {
+    result[i] = value[i].getValue();
+  }
+  return result;
+}
+
 BOOST_AUTO_TEST_SUITE(testInterpolation)
 
+BOOST_AUTO_TEST_CASE(testNestedBasisEvaluatorReuse) {
+  // an evaluator cloned from the previous level must give the same basis values as a new one
+  auto points = sgpp::combigrid::CombiHierarchies::expClenshawCurtis();
+  auto evaluator = std::make_shared<sgpp::combigrid::PolynomialInterpolationEvaluator>();
+  evaluator->setGridPoints(points->getPoints(0, false));
+
+  for (size_t l = 1; l <= 5; ++l) {
+    auto nestedEvaluator = evaluator->cloneLinear();
+    nestedEvaluator->setGridPoints(points->getPoints(l, false));
+    sgpp::combigrid::PolynomialInterpolationEvaluator freshEvaluator;
+    freshEvaluator.setGridPoints(points->getPoints(l, false));
+
+    for (double x : std::vector<double>{0.0, 0.123, 0.5, 0.77, 1.0}) {
+      nestedEvaluator->setParameter(FloatScalarVector(x));
+      freshEvaluator.setParameter(FloatScalarVector(x));
+      auto nestedValues = nestedEvaluator->getBasisValues();
+      auto freshValues = freshEvaluator.getBasisValues();
+
+      BOOST_CHECK_EQUAL(nestedValues.size(), freshValues.size());
+      for (size_t i = 0; i < freshValues.size(); ++i) {
+        BOOST_CHECK_EQUAL(nestedValues[i].value(), freshValues[i].value());
+      }
+    }
+
+    evaluator = std::dynamic_pointer_cast<sgpp::combigrid::PolynomialInterpolationEvaluator>(
+        nestedEvaluator);
+  }
+
+  // cubic splines interpolate the grid points, including the right boundary
+  sgpp::combigrid::CubicSplineInterpolationEvaluator splineEvaluator;
+  std::vector<double> gridPoints{0.0, 0.25, 0.5, 0.75, 1.0};
+  splineEvaluator.setGridPoints(gridPoints);
+  for (size_t j = 0; j < gridPoints.size(); ++j) {
+    splineEvaluator.setParameter(FloatScalarVector(gridPoints[j]));
+    auto basisValues = splineEvaluator.getBasisValues();
+    for (size_t i = 0; i < gridPoints.size(); ++i) {
+      BOOST_CHECK_SMALL(basisValues[i].value() - (i == j ? 1.0 : 0.0), 1e-14);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testBatchedBasisValues) {
+  // the batched computation has to give the same basis values as setting each parameter
+  auto points = sgpp::combigrid::CombiHierarchies::expClenshawCurtis()->getPoints(4, false);
+  sgpp::combigrid::PolynomialInterpolationEvaluator evaluator;
+  evaluator.setGridPoints(points);
+
+  std::vector<FloatScalarVector> params;
+  for (double x : std::vector<double>{0.0, 0.123, 0.5, 0.77, 1.0}) {
+    params.push_back(FloatScalarVector(x));
+  }
+
+  std::vector<std::vector<FloatScalarVector>> batchValues;
+  evaluator.getBasisValuesForParameters(params, batchValues);
+
+  BOOST_CHECK_EQUAL(batchValues.size(), params.size());
+  for (size_t i = 0; i < params.size(); ++i) {
+    sgpp::combigrid::PolynomialInterpolationEvaluator singleEvaluator;
+    singleEvaluator.setGridPoints(points);
+    singleEvaluator.setParameter(params[i]);
+    auto singleValues = singleEvaluator.getBasisValues();
+
+    BOOST_CHECK_EQUAL(batchValues[i].size(), singleValues.size());
+    for (size_t j = 0; j < singleValues.size(); ++j) {
+      BOOST_CHECK_EQUAL(batchValues[i][j].value(), singleValues[j].value());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testAlignedMultiEvaluation) {
+  // the contiguous vector type has to give exactly the same results as FloatArrayVector
+  size_t d = 3;
+  size_t q = 4;
+  auto func = MultiFunction(testFunction3);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  for (size_t numPoints : std::vector<size_t>{1, 7, 64}) {
+    std::vector<DataVector> points(numPoints, DataVector(d));
+    for (auto &point : points) {
+      for (size_t j = 0; j < d; ++j) {
+        point[j] = distribution(generator);
+      }
+    }
+
+    auto expected = multiEvaluate<FloatArrayVector>(d, q, func, points);
+    auto actual = multiEvaluate<AlignedFloatArrayVector>(d, q, func, points);
+
+    BOOST_CHECK_EQUAL(expected.size(), numPoints);
+    BOOST_CHECK_EQUAL(actual.size(), numPoints);
+    for (size_t i = 0; i < numPoints; ++i) {
+      BOOST_CHECK_EQUAL(expected[i], actual[i]);
+    }
+  }
+}
+
+
 BOOST_AUTO_TEST_CASE(testLinearInterpolation) {
   std::cout << "-------------------------------------------" << std::endl;
   std::cout << "Linear Interpolation" << std::endl;
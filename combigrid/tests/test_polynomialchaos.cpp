@@ -8,6 +8,7 @@
 
 #include <sgpp/combigrid/operation/onedim/PolynomialQuadratureEvaluator.hpp>
 #include <sgpp/combigrid/operation/CombigridTensorOperation.hpp>
+#include <sgpp/combigrid/functions/MonomialFunctionBasis1D.hpp>
 #include <sgpp/combigrid/functions/OrthogonalPolynomialBasis1D.hpp>
 #include <sgpp/combigrid/functions/ProbabilityDensityFunction1D.hpp>
 #include <sgpp/combigrid/pce/CombigridSurrogateModel.hpp>
@@ -20,8 +21,25 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <cmath>
 #include <vector>
 
+BOOST_AUTO_TEST_CASE(testMonomialBasisBatchEvaluation) {
+  sgpp::combigrid::MonomialFunctionBasis1D basis;
+  std::vector<double> xValues{0.0, 0.25, 0.5, 1.0, 1.5, -0.75, 2.0};
+  std::vector<double> values;
+  size_t maxDegree = 7;
+  basis.evaluateBatch(maxDegree, xValues, values);
+
+  BOOST_CHECK_EQUAL(values.size(), (maxDegree + 1) * xValues.size());
+  for (size_t j = 0; j <= maxDegree; ++j) {
+    for (size_t i = 0; i < xValues.size(); ++i) {
+      BOOST_CHECK_CLOSE(values[j * xValues.size() + i] + 1.0, basis.evaluate(j, xValues[i]) + 1.0,
+                        1e-12);
+    }
+  }
+}
+
 #ifdef USE_DAKOTA
 
 BOOST_AUTO_TEST_SUITE(testPolynomialChaosExpansion)
@@ -73,6 +91,83 @@ BOOST_AUTO_TEST_CASE(testPCE) {
   testPCEIshigami(op, functionBasis);
 }
 
+void testPCEBatchEvaluation(sgpp::combigrid::OrthogonalPolynomialBasisType type) {
+  sgpp::combigrid::OrthogonalPolynomialBasis1DConfiguration basisConfig;
+  basisConfig.polyParameters.type_ = type;
+  auto functionBasis = std::make_shared<sgpp::combigrid::OrthogonalPolynomialBasis1D>(basisConfig);
+
+  // the batched evaluation uses the three-term recurrence
+  std::vector<double> xValues{0.05, 0.3, 0.5, 0.61, 0.97};
+  std::vector<double> values;
+  size_t maxDegree = 8;
+  functionBasis->evaluateBatch(maxDegree, xValues, values);
+  for (size_t j = 0; j <= maxDegree; ++j) {
+    for (size_t i = 0; i < xValues.size(); ++i) {
+      BOOST_CHECK_SMALL(values[j * xValues.size() + i] - functionBasis->evaluate(j, xValues[i]),
+                        1e-10);
+    }
+  }
+
+  sgpp::combigrid::Ishigami ishigamiModel;
+  sgpp::combigrid::MultiFunction func(ishigamiModel.eval);
+  auto op = sgpp::combigrid::CombigridOperation::createExpL2LejaPolynomialInterpolation(
+      ishigamiModel.numDims, func);
+  op->getLevelManager()->addRegularLevels(3);
+
+  sgpp::combigrid::CombigridSurrogateModelConfiguration config;
+  config.type = sgpp::combigrid::CombigridSurrogateModelsType::POLYNOMIAL_CHAOS_EXPANSION;
+  config.loadFromCombigridOperation(op);
+  config.basisFunction = functionBasis;
+  auto pce = sgpp::combigrid::createCombigridSurrogateModel(config);
+
+  // the coefficients computed in parallel are the same
+  config.numThreads = 4;
+  auto parallelPce = sgpp::combigrid::createCombigridSurrogateModel(config);
+  BOOST_CHECK_CLOSE(parallelPce->mean(), pce->mean(), 1e-10);
+  BOOST_CHECK_CLOSE(parallelPce->variance(), pce->variance(), 1e-10);
+
+  // enough samples for several blocks of the batched evaluation
+  size_t numSamples = 1000;
+  sgpp::quadrature::LatinHypercubeSampleGenerator generator(ishigamiModel.numDims, numSamples);
+  sgpp::base::DataMatrix samples(numSamples, ishigamiModel.numDims);
+  generator.getSamples(samples);
+
+  sgpp::base::DataVector res;
+  pce->eval(samples, res);
+  BOOST_CHECK_EQUAL(res.getSize(), numSamples);
+
+  // reference: explicit sum of the coefficients times the tensor products of the 1D basis
+  // functions, with the coefficients computed by a separate tensor operation
+  auto tensorOp =
+      sgpp::combigrid::CombigridTensorOperation::createOperationTensorPolynomialInterpolation(
+          config.pointHierarchies, config.storage, functionBasis);
+  tensorOp->getLevelManager()->addLevelsFromStructure(config.levelStructure);
+  auto coefficients = tensorOp->getResult();
+
+  sgpp::base::DataVector sample(ishigamiModel.numDims);
+  for (size_t i = 0; i < numSamples; i++) {
+    samples.getRow(i, sample);
+    double expected = 0.0;
+    for (auto it = coefficients.getValues()->getStoredDataIterator(); it->isValid();
+         it->moveToNext()) {
+      sgpp::combigrid::MultiIndex ix = it->getMultiIndex();
+      double poly = 1.0;
+      for (size_t k = 0; k < ix.size(); k++) {
+        poly *= functionBasis->evaluate(ix[k], sample[k]);
+      }
+      expected += it->value().value() * poly;
+    }
+
+    BOOST_CHECK_SMALL(res[i] - expected, 1e-10);
+    BOOST_CHECK_SMALL(pce->eval(sample) - expected, 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPCE_batchEvaluation) {
+  testPCEBatchEvaluation(sgpp::combigrid::OrthogonalPolynomialBasisType::LEGENDRE);
+  testPCEBatchEvaluation(sgpp::combigrid::OrthogonalPolynomialBasisType::HERMITE);
+}
+
 void testPCEParbola(std::shared_ptr<sgpp::combigrid::CombigridOperation> op,
                     sgpp::combigrid::OrthogonalBasisFunctionsCollection& basisFunctions) {
   // initialize the surrogate model
@@ -8,7 +8,10 @@
 #include <sgpp/combigrid/grid/distribution/ClenshawCurtisDistribution.hpp>
 #include <sgpp/combigrid/grid/hierarchy/NonNestedPointHierarchy.hpp>
 #include <sgpp/combigrid/grid/ordering/ExponentialLevelorderPointOrdering.hpp>
+#include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/serialization/AbstractBinarySerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
+#include <sgpp/combigrid/serialization/RawBinarySerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
 #include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
@@ -18,6 +21,7 @@
 #include <cmath>
 #include <iostream>
 #include <limits>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -31,6 +35,8 @@ using sgpp::combigrid::ExponentialLevelorderPointOrdering;
 using sgpp::combigrid::MultiIndexIterator;
 using sgpp::combigrid::MultiIndex;
 using sgpp::combigrid::CombigridTreeStorage;
+using sgpp::combigrid::CombigridOperation;
+using sgpp::combigrid::RawBinarySerializationStrategy;
 
 double testFunc1(sgpp::base::DataVector const &x) { return std::sqrt(x[0]) * std::exp(x[1]); }
 
@@ -140,3 +146,110 @@ BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
     std::cout << "\n";  // prevent optimizing away
   }
 }
+
+BOOST_AUTO_TEST_CASE(testBinarySerialization) {
+  std::vector<uint64_t> integers{0, 1, 127, 128, 300, 16383, 16384, 1234567890123456789ull,
+                                 std::numeric_limits<uint64_t>::max()};
+  std::vector<double> doubles{std::sqrt(2), -0.0, 1e-300, std::numeric_limits<double>::infinity(),
+                              -std::numeric_limits<double>::max()};
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  RawBinarySerializationStrategy<double> strategy;
+
+  for (auto x : integers) {
+    sgpp::combigrid::writeVarint(stream, x);
+  }
+  for (auto x : doubles) {
+    strategy.serialize(x, stream);
+  }
+  strategy.serializeBlock(doubles, stream);
+
+  // one byte for values below 128, two bytes for values below 2^14, ten bytes for 2^64 - 1
+  BOOST_CHECK_EQUAL(stream.str().size(), 1 + 1 + 1 + 2 + 2 + 2 + 3 + 9 + 10 + 2 * 5 * 8);
+
+  for (auto x : integers) {
+    BOOST_CHECK_EQUAL(sgpp::combigrid::readVarint(stream), x);
+  }
+  for (auto x : doubles) {
+    BOOST_CHECK_EQUAL(strategy.deserialize(stream), x);
+  }
+  auto block = strategy.deserializeBlock(doubles.size(), stream);
+  for (size_t i = 0; i < doubles.size(); ++i) {
+    BOOST_CHECK_EQUAL(block[i], doubles[i]);
+  }
+
+  BOOST_CHECK_THROW(strategy.deserialize(stream), std::runtime_error);
+  BOOST_CHECK_THROW(sgpp::combigrid::readVarint(stream), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(testCombigridTreeStorageBinarySerialization) {
+  std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
+      2, std::make_shared<NonNestedPointHierarchy>(
+             std::make_shared<ClenshawCurtisDistribution>(),
+             std::make_shared<ExponentialLevelorderPointOrdering>()));
+
+  MultiFunction testFunc1Multi(testFunc1);
+  CombigridTreeStorage storage(hierarchies, testFunc1Multi);
+
+  MultiIndex bounds(2, 3);
+  std::vector<bool> orderingConfiguration(2, false);
+
+  for (size_t l = 0; l < 3; ++l) {
+    MultiIndex level{2 + l / 2, 2 + l % 2};
+    MultiIndexIterator mIt(bounds);
+    for (auto it = storage.getGuidedIterator(level, mIt, orderingConfiguration); it->isValid();
+         it->moveToNext()) {
+      it->value();
+    }
+  }
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  storage.serializeBinary(stream);
+
+  MultiFunction testFunc2Multi(testFunc2);
+  CombigridTreeStorage otherStorage(hierarchies, testFunc2Multi);
+  otherStorage.deserializeBinary(stream);
+
+  BOOST_CHECK_EQUAL(otherStorage.getNumEntries(), storage.getNumEntries());
+
+  for (size_t l = 0; l < 3; ++l) {
+    MultiIndex level{2 + l / 2, 2 + l % 2};
+    MultiIndexIterator mIt(bounds);
+    MultiIndexIterator otherMIt(bounds);
+
+    auto otherIt = otherStorage.getGuidedIterator(level, otherMIt, orderingConfiguration);
+    for (auto it = storage.getGuidedIterator(level, mIt, orderingConfiguration); it->isValid();
+         it->moveToNext(), otherIt->moveToNext()) {
+      BOOST_CHECK(otherIt->isValid());
+      BOOST_CHECK_EQUAL(it->value(), otherIt->value());
+    }
+    BOOST_CHECK(!otherIt->isValid());
+  }
+
+  // values that have not been stored are still computed by the function of otherStorage
+  MultiIndex level{5, 0};
+  MultiIndexIterator otherMIt(bounds);
+  BOOST_CHECK_EQUAL(otherStorage.getGuidedIterator(level, otherMIt, orderingConfiguration)->value(),
+                    -1.0);
+}
+
+BOOST_AUTO_TEST_CASE(testLevelStructureBinarySerialization) {
+  size_t d = 3;
+  MultiFunction func(testFunc2);
+  auto op = CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(d, func);
+  op->getLevelManager()->addRegularLevels(4);
+
+  std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+  op->getLevelManager()->serializeLevelStructureBinary(stream);
+
+  // the binary representation is much smaller than the textual one
+  BOOST_CHECK_LT(stream.str().size(),
+                 op->getLevelManager()->getSerializedLevelStructure().size() / 2);
+
+  auto otherOp = CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(d, func);
+  otherOp->getLevelManager()->addLevelsFromBinaryStructure(stream);
+
+  BOOST_CHECK_EQUAL(otherOp->getLevelManager()->getSerializedLevelStructure(),
+                    op->getLevelManager()->getSerializedLevelStructure());
+  BOOST_CHECK_EQUAL(otherOp->numGridPoints(), op->numGridPoints());
+}
@@ -6,20 +6,40 @@
 #include <boost/test/unit_test.hpp>
 #include <sgpp/combigrid/integration/MCIntegrator.hpp>
 #include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
+#include <sgpp/combigrid/common/MultiIndexIterator.hpp>
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/operation/Configurations.hpp>
+#include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
+#include <sgpp/combigrid/operation/multidim/fullgrid/AbstractFullGridEvaluationStrategy.hpp>
 #include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
+#include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 #include <sgpp/combigrid/utils/Stopwatch.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
 #include <vector>
 
+using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
+using sgpp::combigrid::AbstractLinearEvaluator;
+using sgpp::combigrid::AbstractPointHierarchy;
+using sgpp::combigrid::AveragingLevelManager;
+using sgpp::combigrid::CombiEvaluators;
+using sgpp::combigrid::CombiHierarchies;
+using sgpp::combigrid::CombigridMultiOperation;
+using sgpp::combigrid::CombigridOperation;
+using sgpp::combigrid::FloatScalarVector;
+using sgpp::combigrid::GridFunction;
+using sgpp::combigrid::MultiFunction;
+using sgpp::combigrid::MultiIndexIterator;
+using sgpp::combigrid::TensorGrid;
+using sgpp::combigrid::TreeStorage;
 using sgpp::combigrid::ThreadPool;
 
 int counter = 0;
@@ -83,3 +103,94 @@ BOOST_AUTO_TEST_CASE(testThreadingWithCallback) {
 
   checkCorrectness();
 }
+
+double parallelTestFunction(DataVector const &coordinates) {
+  double prod = 1.0;
+
+  for (size_t i = 0; i < coordinates.getSize(); ++i) {
+    double x = coordinates[i];
+    prod *= std::exp(-x * x / static_cast<double>((i + 1) * (i + 1)));
+  }
+
+  return prod;
+}
+
+BOOST_AUTO_TEST_CASE(testParallelLevelEvaluation) {
+  size_t d = 4;
+  size_t q = 5;
+  DataVector param(d, 0.3);
+  DataMatrix params(d, 3);
+  for (size_t i = 0; i < d; ++i) {
+    params(i, 0) = 0.1;
+    params(i, 1) = 0.5 + 0.1 * static_cast<double>(i);
+    params(i, 2) = 0.9;
+  }
+
+  double expected = CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+                        d, MultiFunction(parallelTestFunction))
+                        ->evaluate(q, param);
+  DataVector expectedMulti =
+      CombigridMultiOperation::createExpClenshawCurtisPolynomialInterpolation(
+          d, MultiFunction(parallelTestFunction))
+          ->evaluate(q, params);
+
+  for (size_t numThreads = 1; numThreads <= 4; ++numThreads) {
+    // the results have to be bitwise identical to the sequential evaluation
+    double result = CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+                        d, MultiFunction(parallelTestFunction))
+                        ->evaluateParallel(q, param, numThreads);
+    BOOST_CHECK_EQUAL(result, expected);
+
+    DataVector multiResult =
+        CombigridMultiOperation::createExpClenshawCurtisPolynomialInterpolation(
+            d, MultiFunction(parallelTestFunction))
+            ->evaluateParallel(q, params, numThreads);
+    BOOST_CHECK_EQUAL(multiResult.getSize(), expectedMulti.getSize());
+    for (size_t i = 0; i < expectedMulti.getSize(); ++i) {
+      BOOST_CHECK_EQUAL(multiResult[i], expectedMulti[i]);
+    }
+  }
+
+  BOOST_CHECK_CLOSE(expected, parallelTestFunction(param), 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(testParallelLevelEvaluationGridBased) {
+  size_t d = 3;
+  size_t q = 5;
+  DataVector param(d, 0.3);
+  std::atomic<size_t> numGridFunctionCalls(0);
+
+  GridFunction gridFunction([&numGridFunctionCalls](std::shared_ptr<TensorGrid> grid) {
+    ++numGridFunctionCalls;
+    auto values = std::make_shared<TreeStorage<double>>(grid->getDimension());
+    MultiIndexIterator it(grid->numPoints());
+
+    while (it.isValid()) {
+      values->set(it.getMultiIndex(), parallelTestFunction(grid->getGridPoint(it.getMultiIndex())));
+      it.moveToNext();
+    }
+
+    return values;
+  });
+
+  auto createOperation = [d, &gridFunction]() {
+    return std::make_shared<CombigridOperation>(
+        std::vector<std::shared_ptr<AbstractPointHierarchy>>(d,
+                                                             CombiHierarchies::expClenshawCurtis()),
+        std::vector<std::shared_ptr<AbstractLinearEvaluator<FloatScalarVector>>>(
+            d, CombiEvaluators::polynomialInterpolation()),
+        std::make_shared<AveragingLevelManager>(), gridFunction);
+  };
+
+  double expected = createOperation()->evaluate(q, param);
+  size_t expectedGridFunctionCalls = numGridFunctionCalls;
+
+  for (size_t numThreads = 2; numThreads <= 4; ++numThreads) {
+    // the cloned evaluators use the levels precomputed by the original evaluator
+    numGridFunctionCalls = 0;
+    BOOST_CHECK_EQUAL(createOperation()->evaluateParallel(q, param, numThreads), expected);
+    BOOST_CHECK_EQUAL(numGridFunctionCalls, expectedGridFunctionCalls);
+  }
+
+  BOOST_CHECK_CLOSE(expected, parallelTestFunction(param), 1e-4);
+}
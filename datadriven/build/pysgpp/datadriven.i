@@ -62,6 +62,7 @@
 
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDatabase.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/GridFactory.hpp"
+%include "datadriven/src/sgpp/datadriven/algorithm/SparseSGDUpdater.hpp"
 
 #ifdef USE_GSL
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMSBackSub.hpp"
@@ -90,6 +91,7 @@
 %include "datadriven/src/sgpp/datadriven/application/KernelDensityEstimator.hpp"
 %newobject sgpp::datadriven::KernelDensityEstimator::margToDimX(size_t idim);
 %newobject sgpp::datadriven::KernelDensityEstimator::marginalize(size_t idim);
+%include "datadriven/src/sgpp/datadriven/algorithm/KernelDensityTree.hpp"
 %include "datadriven/src/sgpp/datadriven/application/SparseGridDensityEstimator.hpp"
 %newobject sgpp::datadriven::SparseGridDensityEstimator::margToDimX(size_t idim);
 %newobject sgpp::datadriven::SparseGridDensityEstimator::marginalize(size_t idim);
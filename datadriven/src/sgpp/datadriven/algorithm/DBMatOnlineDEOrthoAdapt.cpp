@@ -321,30 +321,22 @@ void DBMatOnlineDEOrthoAdapt::sherman_morrison_adapt(size_t newPoints, bool refi
   //##########################################################################
 
   // If points were coarsened the b_adapt_matrix will now have empty rows and columns
-  // on the indices of the coarsened points. In the following algorithm, the symmetry
-  // of b_adapt_matrix is used to fit the blocks together again.
+  // on the indices of the coarsened points. They are removed in place, the remaining rows and
+  // columns keep their order like the grid points after HashGridStorage::compact.
   if (!refine) {
     std::sort(coarsenIndices.begin(), coarsenIndices.end());
-    size_t vi = 1;  // skipps points
-    sgpp::base::DataVector copied_row(oldSize);
+    std::vector<size_t> remainingIndices;
+    remainingIndices.reserve(newSize);
 
-    for (size_t i = coarsenIndices[0]; i < oldSize - coarsenIndices.size(); i++) {
-      // find amount of successive indices, to skip a block of zeroes
-      while (i + vi == coarsenIndices[vi]) {
-        vi++;
+    for (size_t i = 0, k = 0; i < oldSize; i++) {
+      if ((k < coarsenIndices.size()) && (coarsenIndices[k] == i)) {
+        k++;
+      } else {
+        remainingIndices.push_back(i);
       }
-
-      // set current row and column to copied one
-      this->b_adapt_matrix_.getRow(i + vi, copied_row);
-      this->b_adapt_matrix_.setRow(i, copied_row);
-      this->b_adapt_matrix_.setColumn(i, copied_row);  // symmetry
-
-      // copy diagonal elements too
-      double value = this->b_adapt_matrix_.get(i + vi, i + vi);
-      this->b_adapt_matrix_.set(i, i, value);
     }
 
-    this->b_adapt_matrix_.resizeQuadratic(newSize);
+    this->b_adapt_matrix_.restructureQuadratic(remainingIndices);
     // size fitting ends here
 
     // remove coarsened points from online's refined_vectors
@@ -73,6 +73,21 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   result.axpy(static_cast<double>(M) * this->lambda_, temptwo);
 }
 
+void DMSystemMatrix::multBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) {
+  size_t M = this->dataset_.getNrows();
+  sgpp::base::DataMatrix temp(M, alpha.getNcols());
+
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  op->multBlock(alpha, temp);
+  op->multTransposeBlock(temp, result);
+
+  sgpp::base::DataMatrix temptwo(alpha.getNrows(), alpha.getNcols());
+  this->C->multBlock(alpha, temptwo);
+  temptwo.mult(static_cast<double>(M) * this->lambda_);
+  result.add(temptwo);
+}
+
 void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::DataVector& b) {
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
@@ -82,5 +97,11 @@ void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::Data
   op->multTranspose(classes, b);
 }
 
+void DMSystemMatrix::generatebBlock(sgpp::base::DataMatrix& classes, sgpp::base::DataMatrix& b) {
+  std::unique_ptr<base::OperationMultipleEval> op(
+      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  op->multTransposeBlock(classes, b);
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
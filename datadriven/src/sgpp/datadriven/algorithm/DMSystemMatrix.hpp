@@ -52,6 +52,15 @@ class DMSystemMatrix : public DMSystemMatrixBase {
 
   virtual void mult(base::DataVector& alpha, base::DataVector& result);
 
+  /**
+   * Applies the system matrix to all columns of alpha, streaming the grid and the training data
+   * only once for all columns (e.g. for solving with solver::BlockConjugateGradients).
+   *
+   * @param alpha matrix whose columns are coefficient vectors (one row per grid point)
+   * @param result matrix the results are stored in, same shape as alpha
+   */
+  void multBlock(base::DataMatrix& alpha, base::DataMatrix& result) override;
+
   /**
    * Generates the right hand side of the classification equation
    *
@@ -60,6 +69,14 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    *   multiplication on the rhs
    */
   virtual void generateb(base::DataVector& classes, base::DataVector& b);
+
+  /**
+   * Generates the right hand sides for several class (or target) vectors at once
+   *
+   * @param classes matrix with one row per training data point and one column per right hand side
+   * @param b matrix with one row per grid point that will contain the right hand sides
+   */
+  void generatebBlock(base::DataMatrix& classes, base::DataMatrix& b);
 };
 
 }  // namespace datadriven
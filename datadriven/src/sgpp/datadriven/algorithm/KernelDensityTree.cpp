@@ -0,0 +1,292 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/KernelDensityTree.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// number of samples whose kernels are evaluated at once
+const size_t BLOCK_SIZE = 64;
+
+}  // namespace
+
+KernelDensityTree::KernelDensityTree(
+    const std::vector<std::shared_ptr<base::DataVector>>& samplesVec, size_t leafSize)
+    : ndim(samplesVec.size()),
+      nsamples((samplesVec.size() > 0) ? samplesVec[0]->getSize() : 0),
+      leafSize(std::max(leafSize, static_cast<size_t>(1))),
+      points(ndim * nsamples),
+      pointPointers(ndim),
+      indices(nsamples),
+      weights(nsamples, 1.0),
+      nonNegativeWeights(true) {
+  for (size_t idim = 0; idim < ndim; idim++) {
+    std::copy(samplesVec[idim]->getPointer(), samplesVec[idim]->getPointer() + nsamples,
+              &points[idim * nsamples]);
+  }
+
+  for (size_t i = 0; i < nsamples; i++) {
+    indices[i] = i;
+  }
+
+  if (nsamples > 0) {
+    build(0, nsamples);
+  }
+
+  // store the samples in the order of the leaves
+  std::vector<double> sortedPoints(ndim * nsamples);
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    for (size_t i = 0; i < nsamples; i++) {
+      sortedPoints[idim * nsamples + i] = points[idim * nsamples + indices[i]];
+    }
+  }
+
+  points.swap(sortedPoints);
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    pointPointers[idim] = &points[idim * nsamples];
+  }
+
+  // weight sums of the nodes
+  setWeights(base::DataVector(nsamples, 1.0));
+}
+
+KernelDensityTree::~KernelDensityTree() {}
+
+size_t KernelDensityTree::build(size_t begin, size_t end) {
+  const size_t node = nodes.size();
+  nodes.push_back(Node{begin, end, 0, 0, 0.0});
+  boxMin.resize(boxMin.size() + ndim);
+  boxMax.resize(boxMax.size() + ndim);
+
+  // bounding box
+  size_t splitDim = 0;
+  double maxExtent = 0.0;
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    const double* p = &points[idim * nsamples];
+    double pmin = p[indices[begin]];
+    double pmax = pmin;
+
+    for (size_t i = begin + 1; i < end; i++) {
+      pmin = std::min(pmin, p[indices[i]]);
+      pmax = std::max(pmax, p[indices[i]]);
+    }
+
+    boxMin[node * ndim + idim] = pmin;
+    boxMax[node * ndim + idim] = pmax;
+
+    if (pmax - pmin > maxExtent) {
+      maxExtent = pmax - pmin;
+      splitDim = idim;
+    }
+  }
+
+  if ((end - begin <= leafSize) || (maxExtent == 0.0)) {
+    return node;
+  }
+
+  // split at the median of the dimension with the largest extent
+  const size_t mid = begin + (end - begin) / 2;
+  const double* p = &points[splitDim * nsamples];
+  std::nth_element(indices.begin() + begin, indices.begin() + mid, indices.begin() + end,
+                   [p](size_t i, size_t j) { return p[i] < p[j]; });
+
+  const size_t left = build(begin, mid);
+  const size_t right = build(mid, end);
+  nodes[node].left = left;
+  nodes[node].right = right;
+  return node;
+}
+
+void KernelDensityTree::setWeights(const base::DataVector& weights) {
+  nonNegativeWeights = true;
+
+  for (size_t i = 0; i < nsamples; i++) {
+    this->weights[i] = weights[indices[i]];
+    nonNegativeWeights = nonNegativeWeights && (this->weights[i] >= 0.0);
+  }
+
+  // children are stored after their parents
+  for (size_t k = nodes.size(); k-- > 0;) {
+    Node& node = nodes[k];
+
+    if (node.left == 0) {
+      node.weight = 0.0;
+
+      for (size_t i = node.begin; i < node.end; i++) {
+        node.weight += this->weights[i];
+      }
+    } else {
+      node.weight = nodes[node.left].weight + nodes[node.right].weight;
+    }
+  }
+}
+
+double KernelDensityTree::sumKernels(const double* const* samples, const double* weights,
+                                     size_t begin, size_t end, const double* x,
+                                     const double* invBandwidths, size_t ndim,
+                                     KernelType kernelType) {
+  double values[BLOCK_SIZE];
+  double res = 0.0;
+
+  for (size_t blockBegin = begin; blockBegin < end; blockBegin += BLOCK_SIZE) {
+    const size_t blockSize = std::min(BLOCK_SIZE, end - blockBegin);
+
+    if (kernelType == KernelType::GAUSSIAN) {
+      // accumulate the squared distances, the exponential is evaluated once per sample
+      for (size_t j = 0; j < blockSize; j++) {
+        values[j] = 0.0;
+      }
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        const double* p = samples[idim] + blockBegin;
+        const double xd = x[idim];
+        const double invh = invBandwidths[idim];
+
+        for (size_t j = 0; j < blockSize; j++) {
+          const double y = (xd - p[j]) * invh;
+          values[j] += y * y;
+        }
+      }
+
+      for (size_t j = 0; j < blockSize; j++) {
+        res += weights[blockBegin + j] * std::exp(-0.5 * values[j]);
+      }
+    } else {
+      for (size_t j = 0; j < blockSize; j++) {
+        values[j] = 1.0;
+      }
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        const double* p = samples[idim] + blockBegin;
+        const double xd = x[idim];
+        const double invh = invBandwidths[idim];
+
+        for (size_t j = 0; j < blockSize; j++) {
+          const double y = (xd - p[j]) * invh;
+          values[j] *= std::max(0.0, 1.0 - y * y);
+        }
+      }
+
+      for (size_t j = 0; j < blockSize; j++) {
+        res += weights[blockBegin + j] * values[j];
+      }
+    }
+  }
+
+  return res;
+}
+
+void KernelDensityTree::kernelBounds(size_t node, const double* x, const double* invBandwidths,
+                                     KernelType kernelType, double& kmin, double& kmax) const {
+  const double* bmin = &boxMin[node * ndim];
+  const double* bmax = &boxMax[node * ndim];
+  double nearSum = 0.0;
+  double farSum = 0.0;
+  kmin = 1.0;
+  kmax = 1.0;
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    // distances to the nearest and the farthest point of the box (in units of the bandwidth)
+    const double near = std::max(0.0, std::max(bmin[idim] - x[idim], x[idim] - bmax[idim])) *
+                        invBandwidths[idim];
+    const double far =
+        std::max(std::abs(x[idim] - bmin[idim]), std::abs(x[idim] - bmax[idim])) *
+        invBandwidths[idim];
+
+    if (kernelType == KernelType::GAUSSIAN) {
+      nearSum += near * near;
+      farSum += far * far;
+    } else {
+      kmax *= std::max(0.0, 1.0 - near * near);
+      kmin *= std::max(0.0, 1.0 - far * far);
+    }
+  }
+
+  if (kernelType == KernelType::GAUSSIAN) {
+    kmax = std::exp(-0.5 * nearSum);
+    kmin = std::exp(-0.5 * farSum);
+  }
+}
+
+double KernelDensityTree::eval(const double* x, const double* invBandwidths,
+                               KernelType kernelType, double relativeError) const {
+  if (nsamples == 0) {
+    return 0.0;
+  }
+
+  if (!nonNegativeWeights) {
+    return sumKernels(pointPointers.data(), weights.data(), 0, nsamples, x, invBandwidths, ndim,
+                      kernelType);
+  }
+
+  double kmin;
+  double kmax;
+  kernelBounds(0, x, invBandwidths, kernelType, kmin, kmax);
+
+  Query query;
+  query.x = x;
+  query.invBandwidths = invBandwidths;
+  query.kernelType = kernelType;
+  query.relativeErrorPerWeight =
+      (nodes[0].weight > 0.0) ? std::max(relativeError, 0.0) / nodes[0].weight : 0.0;
+  query.lowerBound = kmin * nodes[0].weight;
+  query.sum = 0.0;
+
+  evalNode(0, kmin, kmax, query);
+  return query.sum;
+}
+
+void KernelDensityTree::evalNode(size_t node, double kmin, double kmax, Query& query) const {
+  const Node& current = nodes[node];
+
+  // the midpoint of the bounds deviates by at most half of their difference
+  if ((kmax == kmin) || ((kmax - kmin) * 0.5 <= query.relativeErrorPerWeight * query.lowerBound)) {
+    query.sum += 0.5 * (kmin + kmax) * current.weight;
+    return;
+  }
+
+  if (current.left == 0) {
+    const double exact =
+        sumKernels(pointPointers.data(), weights.data(), current.begin, current.end, query.x,
+                   query.invBandwidths, ndim, query.kernelType);
+    query.sum += exact;
+    query.lowerBound += exact - kmin * current.weight;
+    return;
+  }
+
+  double kminLeft;
+  double kmaxLeft;
+  double kminRight;
+  double kmaxRight;
+  kernelBounds(current.left, query.x, query.invBandwidths, query.kernelType, kminLeft, kmaxLeft);
+  kernelBounds(current.right, query.x, query.invBandwidths, query.kernelType, kminRight,
+               kmaxRight);
+  query.lowerBound += kminLeft * nodes[current.left].weight +
+                      kminRight * nodes[current.right].weight - kmin * current.weight;
+
+  // descend into the nearer child first, which tightens the lower bound fastest
+  if (kmaxLeft >= kmaxRight) {
+    evalNode(current.left, kminLeft, kmaxLeft, query);
+    evalNode(current.right, kminRight, kmaxRight, query);
+  } else {
+    evalNode(current.right, kminRight, kmaxRight, query);
+    evalNode(current.left, kminLeft, kmaxLeft, query);
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
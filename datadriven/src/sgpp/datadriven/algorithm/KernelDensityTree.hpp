@@ -0,0 +1,167 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * kd-tree over the samples of a KernelDensityEstimator for the fast evaluation of weighted
+ * kernel sums
+ * \f$\sum_i w_i \prod_{d} K\left(\frac{x_d - s_{i,d}}{h_d}\right)\f$.
+ *
+ * The tree splits the samples at the median of the dimension with the largest extent until a
+ * leaf holds at most leafSize samples; each node stores the bounding box and the total weight
+ * of its samples. As both supported kernels decrease with the distance in each dimension, the
+ * kernel values of all samples of a node are bounded by the kernel values at the nearest and
+ * the farthest point of the box. The evaluation descends the tree (near nodes first) and
+ * replaces the contribution of a node by the midpoint of the bounds as soon as its error bound
+ * is below its share of the tolerated error relative to a running lower bound of the sum
+ * (A. G. Gray and A. W. Moore, "Nonparametric Density Estimation: Toward Computational
+ * Tractability", 2003). Hence the relative error of the sum is bounded by the given tolerance;
+ * tolerance zero gives the exact sum, which still skips the nodes outside of the support of
+ * compactly supported kernels.
+ *
+ * The tree doesn't depend on the bandwidths, which are passed to each evaluation, and the
+ * weights can be exchanged without rebuilding the tree. Weights have to be non-negative for the
+ * pruning; otherwise all samples are summed up.
+ */
+class KernelDensityTree {
+ public:
+  /**
+   * Constructor, builds the tree, all weights are one.
+   *
+   * @param samplesVec samples of the density estimator, one vector per dimension
+   * @param leafSize maximal number of samples per leaf
+   */
+  explicit KernelDensityTree(const std::vector<std::shared_ptr<base::DataVector>>& samplesVec,
+                             size_t leafSize = 64);
+
+  /**
+   * Destructor.
+   */
+  ~KernelDensityTree();
+
+  /**
+   * Sets the weights of the samples.
+   *
+   * @param weights one weight per sample (in the order of the samples given to the constructor)
+   */
+  void setWeights(const base::DataVector& weights);
+
+  /**
+   * Evaluates the weighted kernel sum at a point.
+   *
+   * @param x point (ndim entries)
+   * @param invBandwidths inverse bandwidths (ndim entries)
+   * @param kernelType type of the kernel
+   * @param relativeError bound for the relative error of the sum
+   * @return weighted kernel sum (without the normalization factors of the kernels)
+   */
+  double eval(const double* x, const double* invBandwidths, KernelType kernelType,
+              double relativeError) const;
+
+  /**
+   * Computes the weighted kernel sum over a range of samples directly. The kernels are
+   * evaluated for blocks of samples at once, one dimension after the other, so the loops over
+   * the samples can be vectorized.
+   *
+   * @param samples pointers to the coordinates of the samples, one array per dimension
+   * @param weights weights of the samples
+   * @param begin first sample of the range
+   * @param end end of the range (exclusive)
+   * @param x point (ndim entries)
+   * @param invBandwidths inverse bandwidths (ndim entries)
+   * @param ndim number of dimensions
+   * @param kernelType type of the kernel
+   * @return weighted kernel sum (without the normalization factors of the kernels)
+   */
+  static double sumKernels(const double* const* samples, const double* weights, size_t begin,
+                           size_t end, const double* x, const double* invBandwidths, size_t ndim,
+                           KernelType kernelType);
+
+ private:
+  struct Node {
+    // range of the samples in the permuted order
+    size_t begin;
+    size_t end;
+    // children (0 for leaves, the root is never a child)
+    size_t left;
+    size_t right;
+    // sum of the weights of the samples
+    double weight;
+  };
+
+  /**
+   * Splits the samples of a node recursively.
+   *
+   * @param begin first sample of the node
+   * @param end end of the samples of the node
+   * @return index of the node
+   */
+  size_t build(size_t begin, size_t end);
+
+  /**
+   * Computes bounds of the kernel values of the samples of a node.
+   *
+   * @param node index of the node
+   * @param x point
+   * @param invBandwidths inverse bandwidths
+   * @param kernelType type of the kernel
+   * @param[out] kmin lower bound
+   * @param[out] kmax upper bound
+   */
+  void kernelBounds(size_t node, const double* x, const double* invBandwidths,
+                    KernelType kernelType, double& kmin, double& kmax) const;
+
+  struct Query {
+    const double* x;
+    const double* invBandwidths;
+    KernelType kernelType;
+    // tolerated error per unit weight relative to the lower bound of the sum
+    double relativeErrorPerWeight;
+    // running lower bound of the sum and the sum computed so far
+    double lowerBound;
+    double sum;
+  };
+
+  /**
+   * Adds the contribution of a node to the sum.
+   *
+   * @param node index of the node
+   * @param kmin lower bound of the kernel values of the node
+   * @param kmax upper bound of the kernel values of the node
+   * @param query state of the evaluation
+   */
+  void evalNode(size_t node, double kmin, double kmax, Query& query) const;
+
+  size_t ndim;
+  size_t nsamples;
+  size_t leafSize;
+  // samples in the permuted order, one array of length nsamples per dimension
+  std::vector<double> points;
+  std::vector<const double*> pointPointers;
+  // original index of the permuted samples
+  std::vector<size_t> indices;
+  // weights in the permuted order
+  std::vector<double> weights;
+  bool nonNegativeWeights;
+  std::vector<Node> nodes;
+  // bounding boxes, boxMin[node * ndim + d] and boxMax[node * ndim + d]
+  std::vector<double> boxMin;
+  std::vector<double> boxMax;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
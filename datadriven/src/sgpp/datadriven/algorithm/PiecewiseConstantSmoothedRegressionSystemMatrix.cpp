@@ -19,7 +19,7 @@ namespace sgpp {
 namespace datadriven {
 
 PiecewiseConstantSmoothedRegressionSystemMatrix::PiecewiseConstantSmoothedRegressionSystemMatrix(
-  datadriven::PiecewiseConstantRegression::Node& piecewiseRegressor,
+  datadriven::PiecewiseConstantRegression::Tree& piecewiseRegressor,
   base::Grid& grid, base::OperationMatrix& C,
   double lambdaRegression) :
   piecewiseRegressor(piecewiseRegressor), grid(grid) {
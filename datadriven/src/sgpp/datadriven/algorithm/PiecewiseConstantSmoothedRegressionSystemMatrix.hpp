@@ -10,7 +10,7 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
-#include <sgpp/datadriven/operation/hash/OperationPiecewiseConstantRegression/Node.hpp>
+#include <sgpp/datadriven/operation/hash/OperationPiecewiseConstantRegression/Tree.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -25,7 +25,7 @@ namespace datadriven {
 class PiecewiseConstantSmoothedRegressionSystemMatrix: public
   sgpp::base::OperationMatrix {
  private:
-  sgpp::datadriven::PiecewiseConstantRegression::Node& piecewiseRegressor;
+  sgpp::datadriven::PiecewiseConstantRegression::Tree& piecewiseRegressor;
   sgpp::base::Grid& grid;
   /// the lambda, the regularisation parameter
   double lambda;
@@ -47,7 +47,7 @@ class PiecewiseConstantSmoothedRegressionSystemMatrix: public
    * @param lambdaRegression the regression parameter
    */
   PiecewiseConstantSmoothedRegressionSystemMatrix(
-    sgpp::datadriven::PiecewiseConstantRegression::Node& piecewiseRegressor,
+    sgpp::datadriven::PiecewiseConstantRegression::Tree& piecewiseRegressor,
     sgpp::base::Grid& grid,
     sgpp::base::OperationMatrix& C, double lambdaRegression);
 
@@ -0,0 +1,241 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+#include <sgpp/datadriven/algorithm/SparseSGDUpdater.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+namespace {
+
+/// scale factors are stored in the coefficients as soon as they exceed this bound
+const double MAX_DIVISOR = 1e5;
+
+template <class BASIS>
+void getAffectedBasisFunctions(base::GridStorage& storage, const base::DataVector& x,
+                               std::vector<std::pair<size_t, double>>& result) {
+  BASIS basis;
+  base::GetAffectedBasisFunctions<BASIS> ga(storage);
+  ga(basis, x, result);
+}
+
+}  // namespace
+
+SparseSGDUpdater::SparseSGDUpdater(base::Grid& grid)
+    : grid(grid),
+      w(grid.getSize(), 0.0),
+      a(grid.getSize(), 0.0),
+      wDivisor(1.0),
+      aDivisor(1.0),
+      wFraction(0.0),
+      aIsZero(true),
+      hogwild(false),
+      point(grid.getDimension()) {
+  base::GridStorage& storage = grid.getStorage();
+
+  if (grid.getType() == base::GridType::Linear) {
+    getAffected = [&storage](const base::DataVector& x, AffectedBasisFunctions& result) {
+      getAffectedBasisFunctions<base::LinearBasis<unsigned int, unsigned int>>(storage, x,
+                                                                                result);
+    };
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    getAffected = [&storage](const base::DataVector& x, AffectedBasisFunctions& result) {
+      getAffectedBasisFunctions<base::LinearModifiedBasis<unsigned int, unsigned int>>(
+          storage, x, result);
+    };
+  } else {
+    throw base::application_exception(
+        "SparseSGDUpdater::SparseSGDUpdater : grid type is not supported");
+  }
+}
+
+SparseSGDUpdater::~SparseSGDUpdater() {}
+
+void SparseSGDUpdater::resize(size_t size) {
+  renormalize();
+  w.resizeZero(size);
+  a.resizeZero(size);
+}
+
+void SparseSGDUpdater::update(const base::DataMatrix& data, const base::DataVector& labels,
+                              size_t begin, size_t end, double gamma, double lambda,
+                              double mu) {
+  if (end <= begin) {
+    return;
+  }
+
+  // keep the scale factors in a range where no precision is lost
+  if ((wDivisor > MAX_DIVISOR) || (aDivisor > MAX_DIVISOR)) {
+    renormalize();
+  }
+
+  const size_t batchSize = end - begin;
+  const double stepSize = gamma / static_cast<double>(batchSize);
+  double* const wData = w.getPointer();
+  double* const aData = a.getPointer();
+
+  if (hogwild) {
+    // weight decay first, so that the coefficients are consistent during the concurrent updates
+    // (the residuals are computed with the coefficients before the decay)
+    const double wDivisorOld = wDivisor;
+    wDivisor /= 1.0 - gamma * lambda;
+    const double wDivisorCur = wDivisor;
+    const double wFractionCur = wFraction;
+    const bool updateA = (mu < 1.0);
+    const size_t dim = data.getNcols();
+
+#pragma omp parallel
+    {
+      AffectedBasisFunctions localAffected;
+      base::DataVector x(dim);
+
+#pragma omp for schedule(dynamic, 16)
+      for (size_t i = begin; i < end; i++) {
+        data.getRow(i, x);
+        getAffected(x, localAffected);
+        double value = 0.0;
+
+        for (const auto& entry : localAffected) {
+          double wi;
+#pragma omp atomic read
+          wi = wData[entry.first];
+          value += wi * entry.second;
+        }
+
+        const double residual = value / wDivisorOld - labels[i];
+        const double etd = -stepSize * residual * wDivisorCur;
+
+        if (etd != 0.0) {
+          for (const auto& entry : localAffected) {
+#pragma omp atomic update
+            wData[entry.first] += etd * entry.second;
+
+            if (updateA) {
+#pragma omp atomic update
+              aData[entry.first] -= wFractionCur * etd * entry.second;
+            }
+          }
+        }
+      }
+    }
+  } else {
+    if (affected.size() < batchSize) {
+      affected.resize(batchSize);
+      residuals.resize(batchSize);
+    }
+
+    // all residuals are computed with the coefficients before the step
+    for (size_t i = 0; i < batchSize; i++) {
+      data.getRow(begin + i, point);
+      getAffected(point, affected[i]);
+      double value = 0.0;
+
+      for (const auto& entry : affected[i]) {
+        value += wData[entry.first] * entry.second;
+      }
+
+      residuals[i] = value / wDivisor - labels[begin + i];
+    }
+
+    // weight decay
+    wDivisor /= 1.0 - gamma * lambda;
+
+    for (size_t i = 0; i < batchSize; i++) {
+      const double etd = -stepSize * residuals[i] * wDivisor;
+
+      if (etd == 0.0) {
+        continue;
+      }
+
+      for (const auto& entry : affected[i]) {
+        wData[entry.first] += etd * entry.second;
+      }
+
+      if (mu < 1.0) {
+        // keep the averaged coefficients unchanged
+        for (const auto& entry : affected[i]) {
+          aData[entry.first] -= wFraction * etd * entry.second;
+        }
+      }
+    }
+  }
+
+  if (mu < 1.0) {
+    aIsZero = false;
+  }
+
+  updateAveraging(mu);
+}
+
+void SparseSGDUpdater::updateAveraging(double mu) {
+  if (mu >= 1.0) {
+    // averaged coefficients are the current ones
+    if (!aIsZero) {
+      a.setAll(0.0);
+      aIsZero = true;
+    }
+
+    aDivisor = wDivisor;
+    wFraction = 1.0;
+  } else if (mu > 0.0) {
+    aDivisor /= 1.0 - mu;
+    wFraction += mu * aDivisor / wDivisor;
+  }
+}
+
+double SparseSGDUpdater::eval(const base::DataVector& x) {
+  AffectedBasisFunctions result;
+  getAffected(x, result);
+  double value = 0.0;
+
+  for (const auto& entry : result) {
+    value += w[entry.first] * entry.second;
+  }
+
+  return value / wDivisor;
+}
+
+void SparseSGDUpdater::getAlpha(base::DataVector& alpha) const {
+  alpha.resize(w.getSize());
+
+  for (size_t i = 0; i < w.getSize(); i++) {
+    alpha[i] = w[i] / wDivisor;
+  }
+}
+
+void SparseSGDUpdater::getAlphaAvg(base::DataVector& alphaAvg) const {
+  alphaAvg.resize(w.getSize());
+
+  for (size_t i = 0; i < w.getSize(); i++) {
+    alphaAvg[i] = (a[i] + wFraction * w[i]) / aDivisor;
+  }
+}
+
+void SparseSGDUpdater::renormalize() {
+  if ((wDivisor != 1.0) || (aDivisor != 1.0) || (wFraction != 0.0)) {
+    for (size_t i = 0; i < w.getSize(); i++) {
+      a[i] = (a[i] + wFraction * w[i]) / aDivisor;
+      w[i] /= wDivisor;
+    }
+
+    aIsZero = false;
+  }
+
+  wDivisor = 1.0;
+  aDivisor = 1.0;
+  wFraction = 0.0;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,153 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Sparse update engine for averaged stochastic gradient descent (ASGD) on the
+ * regularized least squares functional, as used by LearnerSGD.
+ *
+ * One SGD step for a sample \f$(x, y)\f$ reads
+ * \f$\alpha \gets (1 - \gamma\lambda) \alpha - \gamma (f(x) - y) \phi(x)\f$,
+ * followed by the averaging \f$\bar{\alpha} \gets (1 - \mu) \bar{\alpha} + \mu \alpha\f$.
+ * Only the basis functions which are non-zero at \f$x\f$ are touched: they are found by
+ * descending the grid (see base::GetAffectedBasisFunctions). The weight decay and the
+ * averaging are applied lazily by global scale factors (L. Bottou, "Stochastic Gradient
+ * Descent Tricks"), i.e.,
+ * \f$\alpha = w / w_{\text{div}}\f$ and
+ * \f$\bar{\alpha} = (a + w_{\text{frac}} w) / a_{\text{div}}\f$.
+ * Hence, a step costs \f$\mathcal{O}(\ell^d)\f$ instead of \f$\mathcal{O}(N)\f$ and doesn't
+ * allocate memory. The coefficients are only assembled on request (getAlpha, getAlphaAvg).
+ *
+ * A step may process a mini-batch of samples. Then, all residuals are computed with the same
+ * coefficients and the gradients are averaged. If Hogwild mode is enabled, the samples of a
+ * mini-batch are distributed to the OpenMP threads, which read and update the coefficients
+ * concurrently without locks (with atomic operations only); the residuals then see the
+ * updates of other samples of the same mini-batch as soon as they are written.
+ *
+ * Supported grids are linear and modified linear grids on the unit cube.
+ */
+class SparseSGDUpdater {
+ public:
+  /**
+   * Constructor, all coefficients are zero.
+   *
+   * @param grid The grid (Linear or ModLinear); must not be destructed before this object
+   */
+  explicit SparseSGDUpdater(base::Grid& grid);
+
+  /**
+   * Destructor.
+   */
+  ~SparseSGDUpdater();
+
+  /**
+   * Adapts the number of coefficients after the grid has been refined.
+   * Existing coefficients are kept, new ones are zero.
+   *
+   * @param size The new number of grid points
+   */
+  void resize(size_t size);
+
+  /**
+   * Performs one SGD step with the mini-batch consisting of the rows
+   * begin, ..., end - 1 of data.
+   *
+   * @param data The data points
+   * @param labels The corresponding labels
+   * @param begin Index of the first data point of the mini-batch
+   * @param end Index after the last data point of the mini-batch
+   * @param gamma The learning rate
+   * @param lambda The regularization parameter
+   * @param mu The averaging weight (1 means that the averaged coefficients
+   *        are replaced by the current ones)
+   */
+  void update(const base::DataMatrix& data, const base::DataVector& labels, size_t begin,
+              size_t end, double gamma, double lambda, double mu);
+
+  /**
+   * Evaluates the current model (not the averaged one) at a point.
+   *
+   * @param x The point
+   * @return The value of the model
+   */
+  double eval(const base::DataVector& x);
+
+  /**
+   * @param[out] alpha The current coefficients
+   */
+  void getAlpha(base::DataVector& alpha) const;
+
+  /**
+   * @param[out] alphaAvg The averaged coefficients
+   */
+  void getAlphaAvg(base::DataVector& alphaAvg) const;
+
+  /**
+   * @param hogwild Whether the samples of a mini-batch should be processed concurrently
+   */
+  void setHogwild(bool hogwild) { this->hogwild = hogwild; }
+
+  /**
+   * @return Whether the samples of a mini-batch are processed concurrently
+   */
+  bool isHogwild() const { return hogwild; }
+
+ protected:
+  typedef std::vector<std::pair<size_t, double>> AffectedBasisFunctions;
+
+  /**
+   * Stores the scale factors in the coefficient vectors and resets them.
+   */
+  void renormalize();
+
+  /**
+   * Updates the averaging after a step.
+   *
+   * @param mu The averaging weight
+   */
+  void updateAveraging(double mu);
+
+  /// The grid
+  base::Grid& grid;
+  /// Finds the basis functions that are non-zero at a point
+  std::function<void(const base::DataVector&, AffectedBasisFunctions&)> getAffected;
+  /// Unscaled coefficients w
+  base::DataVector w;
+  /// Unscaled averaged coefficients a
+  base::DataVector a;
+  /// Divisor of w
+  double wDivisor;
+  /// Divisor of the averaged coefficients
+  double aDivisor;
+  /// Fraction of w contained in the averaged coefficients
+  double wFraction;
+  /// Whether a is known to be zero
+  bool aIsZero;
+  /// Whether the samples of a mini-batch are processed concurrently
+  bool hogwild;
+  /// Affected basis functions of the samples of the current mini-batch (reused)
+  std::vector<AffectedBasisFunctions> affected;
+  /// Residuals of the samples of the current mini-batch (reused)
+  std::vector<double> residuals;
+  /// Current data point (reused)
+  base::DataVector point;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -5,6 +5,7 @@
 
 #include <sgpp/datadriven/application/DensityEstimator.hpp>
 #include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+#include <sgpp/datadriven/algorithm/KernelDensityTree.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformationKDE.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationKDE.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMarginalizeKDE.hpp>
@@ -35,10 +36,13 @@ KernelDensityEstimator::KernelDensityEstimator(KernelType kernelType,
     : nsamples(0),
       ndim(0),
       bandwidths(0),
+      invBandwidths(0),
       norm(0),
       cond(0),
       sumCondInv(1.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      useTree(false),
+      treeRelativeError(1e-6) {
   initializeKernel(kernelType);
 }
 
@@ -48,10 +52,13 @@ KernelDensityEstimator::KernelDensityEstimator(
     : nsamples(0.0),
       ndim(samplesVec.size()),
       bandwidths(samplesVec.size()),
+      invBandwidths(samplesVec.size()),
       norm(samplesVec.size()),
       cond(0.0),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      useTree(false),
+      treeRelativeError(1e-6) {
   initializeKernel(kernelType);
   initialize(samplesVec);
 }
@@ -61,25 +68,33 @@ KernelDensityEstimator::KernelDensityEstimator(base::DataMatrix& samples, Kernel
     : nsamples(samples.getNrows()),
       ndim(samples.getNcols()),
       bandwidths(samples.getNcols()),
+      invBandwidths(samples.getNcols()),
       norm(samples.getNcols()),
       cond(samples.getNrows()),
       sumCondInv(0.0),
-      bandwidthOptimizationType(bandwidthOptimizationType) {
+      bandwidthOptimizationType(bandwidthOptimizationType),
+      useTree(false),
+      treeRelativeError(1e-6) {
   initializeKernel(kernelType);
   initialize(samples);
 }
 
 KernelDensityEstimator::KernelDensityEstimator(const KernelDensityEstimator& kde) {
   samplesVec = kde.samplesVec;
+  samplePointers = kde.samplePointers;
   nsamples = kde.nsamples;
   ndim = kde.ndim;
   bandwidths = base::DataVector(kde.bandwidths);
+  invBandwidths = base::DataVector(kde.invBandwidths);
   norm = base::DataVector(kde.norm);
   cond = base::DataVector(kde.cond);
   sumCondInv = kde.sumCondInv;
   bandwidthOptimizationType = kde.bandwidthOptimizationType;
+  useTree = kde.useTree;
+  treeRelativeError = kde.treeRelativeError;
 
   initializeKernel(kde.kernel->getType());
+  updateTree();
 }
 
 KernelDensityEstimator::~KernelDensityEstimator() {}
@@ -115,6 +130,12 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
         samples.getRow(idim, *(samplesVec[idim]));
       }
 
+      samplePointers.resize(ndim);
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        samplePointers[idim] = samplesVec[idim]->getPointer();
+      }
+
       // initialize conditionalization factor
       cond.resize(nsamples);
       cond.setAll(1.0);
@@ -125,7 +146,9 @@ void KernelDensityEstimator::initialize(base::DataMatrix& samples) {
 
       // init the bandwidths
       bandwidths.resize(ndim);
+      invBandwidths.resize(ndim);
       computeAndSetOptKDEbdwth();
+      updateTree();
     } else {
       throw base::data_exception(
           "KernelDensityEstimator::KernelDensityEstimator: KDE needs at least two samples to "
@@ -153,6 +176,12 @@ void KernelDensityEstimator::initialize(std::vector<std::shared_ptr<base::DataVe
         samplesVec[idim] = std::make_shared<base::DataVector>(*(samples[idim]));  // copy
       }
 
+      samplePointers.resize(ndim);
+
+      for (size_t idim = 0; idim < ndim; idim++) {
+        samplePointers[idim] = samplesVec[idim]->getPointer();
+      }
+
       // initialize conditionalization factors
       cond.resize(nsamples);
       cond.setAll(1.0);
@@ -163,7 +192,9 @@ void KernelDensityEstimator::initialize(std::vector<std::shared_ptr<base::DataVe
 
       // init the bandwidths
       bandwidths.resize(ndim);
+      invBandwidths.resize(ndim);
       computeAndSetOptKDEbdwth();
+      updateTree();
     } else {
       throw base::data_exception(
           "KernelDensityEstimator::KernelDensityEstimator : KDE needs at least two samples to "
@@ -216,74 +247,101 @@ void KernelDensityEstimator::getBandwidths(base::DataVector& sigma) {
 void KernelDensityEstimator::setBandwidths(const base::DataVector& sigma) {
   for (size_t i = 0; i < sigma.getSize(); i++) {
     bandwidths[i] = sigma[i];
+    invBandwidths[i] = 1.0 / bandwidths[i];
     norm[i] = kernel->norm() / bandwidths[i];
   }
 }
 
+void KernelDensityEstimator::setTreeEvaluation(bool useTree, double relativeError) {
+  treeRelativeError = relativeError;
+
+  if (useTree != this->useTree) {
+    this->useTree = useTree;
+    updateTree();
+  }
+}
+
+bool KernelDensityEstimator::isTreeEvaluation() const { return useTree; }
+
+double KernelDensityEstimator::getTreeRelativeError() const { return treeRelativeError; }
+
+void KernelDensityEstimator::updateTree() {
+  if (useTree && (nsamples > 0) && (samplesVec.size() == ndim)) {
+    tree.reset(new KernelDensityTree(samplesVec));
+    tree->setWeights(cond);
+  } else {
+    tree.reset();
+  }
+}
+
 void KernelDensityEstimator::pdf(base::DataMatrix& data, base::DataVector& res) {
-  // init variables
-  base::DataVector x(ndim);
+  double normalization = sumCondInv;
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    normalization *= norm[idim];
+  }
 
   // resize result vector
   res.resize(data.getNrows());
-  res.setAll(0.0);
+  const double* rows = data.getPointer();
+  const size_t ncols = data.getNcols();
 
   // run over all data points
+#pragma omp parallel for schedule(dynamic, 16)
   for (size_t idata = 0; idata < data.getNrows(); idata++) {
-    // copy samples
-    for (size_t idim = 0; idim < ndim; idim++) {
-      x[idim] = data.get(idata, idim);
-    }
-
-    res[idata] = pdf(x);
+    res[idata] = normalization * sumKernels(rows + idata * ncols);
   }
 }
 
 double KernelDensityEstimator::pdf(base::DataVector& x) {
-  // init variables
-  double res = 0.0;
+  double normalization = sumCondInv;
 
-  // run over all data points
-  for (size_t isample = 0; isample < nsamples; isample++) {
-    res += evalKernel(x, isample);
+  for (size_t idim = 0; idim < ndim; idim++) {
+    normalization *= norm[idim];
   }
 
-  return res * sumCondInv;
+  return normalization * sumKernels(x.getPointer());
 }
 
 double KernelDensityEstimator::evalSubset(base::DataVector& x, std::vector<size_t> skipElements) {
   // init variables
   double res = 0.0;
+  double normalization = 1.0;
+
+  for (size_t idim = 0; idim < ndim; idim++) {
+    normalization *= norm[idim];
+  }
 
   // sort the elements to be skipped
   std::sort(skipElements.begin(), skipElements.end());
-  size_t isample = 0, j = 0;
+  size_t begin = 0;
 
   // just add those kernels which are not in the skipElements list
-  while (isample < nsamples) {
-    if (isample < skipElements[j]) {
-      res += evalKernel(x, isample);
-    } else {
-      j++;
+  for (size_t skipElement : skipElements) {
+    if (skipElement >= begin) {
+      res += KernelDensityTree::sumKernels(samplePointers.data(), cond.getPointer(), begin,
+                                           std::min(skipElement, nsamples), x.getPointer(),
+                                           invBandwidths.getPointer(), ndim, kernel->getType());
+      begin = skipElement + 1;
     }
-    isample++;
   }
 
-  return res / static_cast<double>(nsamples - skipElements.size());
-}
+  if (begin < nsamples) {
+    res += KernelDensityTree::sumKernels(samplePointers.data(), cond.getPointer(), begin,
+                                         nsamples, x.getPointer(), invBandwidths.getPointer(),
+                                         ndim, kernel->getType());
+  }
 
-double KernelDensityEstimator::evalKernel(base::DataVector& x, size_t i) {
-  double res = 1.0;
-  double y = 0.0;
+  return normalization * res / static_cast<double>(nsamples - skipElements.size());
+}
 
-  for (size_t idim = 0; idim < ndim; idim++) {
-    // normalize x
-    y = (x[idim] - samplesVec[idim]->get(i)) / bandwidths[idim];
-    // evaluate kernel
-    res *= norm[idim] * kernel->eval(y);
+double KernelDensityEstimator::sumKernels(const double* x) const {
+  if (tree) {
+    return tree->eval(x, invBandwidths.getPointer(), kernel->getType(), treeRelativeError);
+  } else {
+    return KernelDensityTree::sumKernels(samplePointers.data(), cond.getPointer(), 0, nsamples, x,
+                                         invBandwidths.getPointer(), ndim, kernel->getType());
   }
-
-  return cond[i] * res;
 }
 
 void KernelDensityEstimator::cov(base::DataMatrix& cov, base::DataMatrix* bounds) {
@@ -412,6 +470,10 @@ void KernelDensityEstimator::setConditionalizationFactor(base::DataVector& pcond
   }
 
   sumCondInv = 1. / sumCond;
+
+  if (tree) {
+    tree->setWeights(cond);
+  }
 }
 
 void KernelDensityEstimator::updateConditionalizationFactors(base::DataVector& x,
@@ -426,9 +488,22 @@ void KernelDensityEstimator::updateConditionalizationFactors(base::DataVector& x
     idim = dims[i];
 
     if (idim < ndim) {
-      for (size_t isample = 0; isample < nsamples; isample++) {
-        xi = (x[idim] - samplesVec[idim]->get(isample)) / bandwidths[idim];
-        pcond[isample] *= norm[idim] * kernel->eval(xi);
+      const double* samples = samplesVec[idim]->getPointer();
+      const double invh = invBandwidths[idim];
+      const double normd = norm[idim];
+      double* p = pcond.getPointer();
+
+      // the kernels are inlined, so the loops can be vectorized
+      if (kernel->getType() == KernelType::GAUSSIAN) {
+        for (size_t isample = 0; isample < nsamples; isample++) {
+          xi = (x[idim] - samples[isample]) * invh;
+          p[isample] *= normd * std::exp(-0.5 * xi * xi);
+        }
+      } else {
+        for (size_t isample = 0; isample < nsamples; isample++) {
+          xi = (x[idim] - samples[isample]) * invh;
+          p[isample] *= normd * std::max(0.0, 1.0 - xi * xi);
+        }
       }
     } else {
       throw base::data_exception(
@@ -13,12 +13,15 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 
 namespace sgpp {
 namespace datadriven {
 
+class KernelDensityTree;
+
 // --------------------------------------------------------------------------------
 enum class KernelType { GAUSSIAN, EPANECHNIKOV };
 
@@ -94,10 +97,39 @@ class KernelDensityEstimator : public DensityEstimator {
   void cov(base::DataMatrix& cov, base::DataMatrix* bounds = nullptr) override;
 
   double pdf(base::DataVector& x) override;
+
+  /**
+   * Evaluates the density at the rows of the given matrix in parallel (OpenMP).
+   *
+   * @param points points (one per row)
+   * @param[out] res values of the density
+   */
   void pdf(base::DataMatrix& points, base::DataVector& res) override;
 
   double evalSubset(base::DataVector& x, std::vector<size_t> skipElements);
 
+  /**
+   * Switches between the direct evaluation of the kernel sums (default) and the evaluation
+   * with a kd-tree over the samples (see KernelDensityTree), which prunes the nodes whose
+   * contribution is known up to the given relative error. The tree is kept up to date with the
+   * samples and the conditionalization factors; densities obtained by marginalization and
+   * conditionalization inherit the evaluation settings.
+   *
+   * @param useTree whether the tree is used
+   * @param relativeError bound for the relative error of the density values (0 for exact values)
+   */
+  void setTreeEvaluation(bool useTree, double relativeError = 1e-6);
+
+  /**
+   * @return whether the density is evaluated with a kd-tree
+   */
+  bool isTreeEvaluation() const;
+
+  /**
+   * @return bound for the relative error of the evaluation with the kd-tree
+   */
+  double getTreeRelativeError() const;
+
   /// getter and setter functions
   void getConditionalizationFactor(base::DataVector& pcond);
   void setConditionalizationFactor(base::DataVector& pcond);
@@ -118,10 +150,19 @@ class KernelDensityEstimator : public DensityEstimator {
   size_t getNsamples() override;
 
  private:
-  double evalKernel(base::DataVector& x, size_t i);
+  /**
+   * @param x point
+   * @return sum of the conditionalized kernels (without the normalization factors)
+   */
+  double sumKernels(const double* x) const;
+
+  /// (re)builds the tree if the tree evaluation is enabled
+  void updateTree();
 
   /// samples
   std::vector<std::shared_ptr<base::DataVector>> samplesVec;
+  /// pointers to the samples of each dimension
+  std::vector<const double*> samplePointers;
 
   /// kernel
   std::unique_ptr<Kernel> kernel;
@@ -131,6 +172,8 @@ class KernelDensityEstimator : public DensityEstimator {
 
   /// standard deviations for the kernels in 1d
   base::DataVector bandwidths;
+  /// inverse bandwidths
+  base::DataVector invBandwidths;
   /// normalization factor for 1d kernels
   base::DataVector norm;
   /// conditionalization factors
@@ -140,6 +183,11 @@ class KernelDensityEstimator : public DensityEstimator {
   /// bandwith optimization type
   BandwidthOptimizationType bandwidthOptimizationType;
 
+  /// kd-tree evaluation
+  bool useTree;
+  double treeRelativeError;
+  std::unique_ptr<KernelDensityTree> tree;
+
   void computeAndSetOptKDEbdwth();
   void computeNormalizationFactors();
 };
@@ -17,6 +17,7 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitor.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp>
+#include <sgpp/datadriven/algorithm/SparseSGDUpdater.hpp>
 #include <sgpp/datadriven/application/LearnerSGD.hpp>
 
 #include <cmath>
@@ -59,7 +60,9 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
       gamma(gamma),
       currentGamma(gamma),
       batchSize(batchSize),
-      useValidData(useValidData) {
+      miniBatchSize(1),
+      useValidData(useValidData),
+      hogwild(false) {
 
   // if no validation data is provided -> create buffer
   // which contains already processed data points
@@ -77,6 +80,21 @@ LearnerSGD::LearnerSGD(base::RegularGridConfiguration& gridConfig,
 
 LearnerSGD::~LearnerSGD() {}
 
+void LearnerSGD::setMiniBatchSize(size_t miniBatchSize) {
+  if (miniBatchSize == 0) {
+    throw base::application_exception(
+        "LearnerSGD::setMiniBatchSize : mini-batch size must be positive");
+  }
+  this->miniBatchSize = miniBatchSize;
+}
+
+void LearnerSGD::setHogwild(bool hogwild) {
+  this->hogwild = hogwild;
+  if (updater) {
+    updater->setHogwild(hogwild);
+  }
+}
+
 void LearnerSGD::initialize() {
   // vector containing error contributions for predictive refinement
   batchError.resize(batchSize, 0.0);
@@ -89,6 +107,9 @@ void LearnerSGD::initialize() {
   alpha.resize(grid->getSize(), 0.0);
   // vector for averaged surpluses
   alphaAvg.resize(grid->getSize(), 0.0);
+  // sparse SGD steps
+  updater.reset(new SparseSGDUpdater(*grid));
+  updater->setHogwild(hogwild);
 }
 
 std::unique_ptr<base::Grid> LearnerSGD::createRegularGrid() {
@@ -138,73 +159,35 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
   double acc = getAccuracy(testData, testLabels, 0.0);
   avgErrors.append(1.0 - acc);
 
-  // parameters for ADAM
-  /*sgpp::base::DataVector m(alpha.getSize(), 0.0);
-  sgpp::base::DataVector v(alpha.getSize(), 0.0);
-  double beta_1 = 0.25;
-  double beta_2 = 0.95;
-  double epsilon = 1e-8;*/
-
   // counts total number of processed data points
   size_t processedPoints = 0;
+  sgpp::base::DataVector x(dim);
+  size_t numData = trainData.getNrows();
   // main loop which performs the learning process
   while (cntDataPasses < maxDataPasses) {
-    for (size_t currIt = 0; currIt < trainData.getNrows(); currIt++) {
-      // get next training sample x and its label y
-      sgpp::base::DataVector x(dim);
-      trainData.getRow(currIt, x);
-      double y = trainLabels.get(currIt);
+    for (size_t currIt = 0; currIt < numData; currIt += miniBatchSize) {
+      // the last mini-batch of a pass may be smaller
+      size_t currEnd = std::min(currIt + miniBatchSize, numData);
+      size_t lastPoint = processedPoints + (currEnd - currIt) - 1;
 
-      // store data point in batch dataset used for checking
+      // store data points in batch dataset used for checking
       // predictive refinement criterion
       // if validation set is used -> not needed
       if (!useValidData) {
-        pushToBatch(x, y);
+        for (size_t i = currIt; i < currEnd; i++) {
+          trainData.getRow(i, x);
+          pushToBatch(x, trainLabels.get(i));
+        }
       }
 
-      sgpp::base::DataVector delta(alpha.getSize());
-
-      sgpp::base::DataVector singleAlpha(1);
-      singleAlpha[0] = 1.0;
-
-      // perform SGD step
-      sgpp::base::DataMatrix dm(x.getPointer(), 1, x.getSize());
-      std::unique_ptr<base::OperationMultipleEval> multEval(
-          op_factory::createOperationMultipleEval(*grid, dm));
-      multEval->multTranspose(singleAlpha, delta);
-
-      double residual = delta.dotProduct(alpha) - y;
-
-      // ADAM
-      // gradient
-      /*delta.mult(residual);
-      delta.axpy(lambda, alpha);
-      sgpp::base::DataVector grad_1(delta);
-      sgpp::base::DataVector grad_2(delta);
-      //update biased first and second moment estimates
-      grad_1.mult(1.0-beta_1);
-      m.mult(beta_1);
-      m.add(grad_1);
-      grad_2.sqr();
-      grad_2.mult(1.0-beta_2);
-      v.mult(beta_2);
-      v.add(grad_2);
-      //update bias-corrected first and second moment estimates
-      //m.mult(1.0/(1.0-std::pow(beta_1,currIt+1)));
-      //v.mult(1.0/(1.0-std::pow(beta_2,currIt+1)));
-      m.mult(1.0/(1.0-std::pow(beta_1,processedPoints+1)));
-      v.mult(1.0/(1.0-std::pow(beta_2,processedPoints+1)));
-      //update alpha
-      v.sqrt();
-      sgpp::base::DataVector eps_vec(alpha.getSize(), epsilon);
-      v.add(eps_vec);
-      m.componentwise_div(v);
-      m.mult(currentGamma);
-      alpha.sub(m);*/
-
-      // SGD
-      alpha.mult(1 - currentGamma * lambda);
-      alpha.axpy(-currentGamma * residual, delta);
+      // smoothing according to L. Bottou
+      size_t t1 = (lastPoint > dim + 1) ? lastPoint - dim : 1;
+      size_t t2 = (lastPoint > numData + 1) ? lastPoint - numData : 1;
+      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
+      mu = 1.0 / mu;
+
+      // sparse (averaged) SGD step, the coefficients are assembled only when needed
+      updater->update(trainData, trainLabels, currIt, currEnd, currentGamma, lambda, mu);
 
       // learning rate according to L. Bottou
       /*currentGamma =
@@ -214,25 +197,12 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
               -0.75);*/
       currentGamma =
           gamma *
-          std::pow(
-              (1 + gamma * lambda * (static_cast<double>(processedPoints) + 1)),
-              -0.75);
-
-      // smoothing according to L. Bottou
-      size_t t1 = (processedPoints > dim + 1) ? processedPoints - dim : 1;
-      size_t t2 = (processedPoints > trainData.getNrows() + 1)
-                      ? processedPoints - trainData.getNrows()
-                      : 1;
-      double mu = (t1 > t2) ? static_cast<double>(t1) : static_cast<double>(t2);
-      mu = 1.0 / mu;
-
-      // average SGD / ADAM
-      alphaAvg.mult(1 - mu);
-      alphaAvg.axpy(mu, alpha);
+          std::pow((1 + gamma * lambda * (static_cast<double>(lastPoint) + 1)), -0.75);
 
       size_t refinementsNecessary = 0;
       if (refCnt < refNum && processedPoints > 0 && monitor) {
         // check if refinement should be performed
+        updater->getAlphaAvg(alphaAvg);
         currentBatchError = getError(*batchData, *batchLabels, "MSE");
         currentTrainError = getError(trainData, trainLabels, "MSE");
         monitor->pushToBuffer(1, currentBatchError, currentTrainError);
@@ -242,7 +212,7 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
       while (refinementsNecessary > 0) {
         // acc = getAccuracy(testData, testLabels, 0.0);
         // avgErrors.append(1.0 - acc);
-        std::cout << "refinement at iteration: " << processedPoints + 1
+        std::cout << "refinement at iteration: " << lastPoint + 1
                   << std::endl;
 
         base::GridStorage& gridStorage = grid->getStorage();
@@ -266,12 +236,8 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
               threshold, numPoints);
           decorator.free_refine(gridStorage, indicator);
         }
-        alpha.resizeZero(grid->getSize());
-        alphaAvg.resizeZero(grid->getSize());
-
-        // required for ADAM
-        // m.resizeZero(grid->getSize());
-        // v.resizeZero(grid->getSize());
+        updater->resize(grid->getSize());
+        updater->getAlphaAvg(alphaAvg);
 
         std::cout << "refinement step: " << refCnt + 1 << std::endl;
         std::cout << "new grid size: " << grid->getSize() << std::endl;
@@ -280,16 +246,19 @@ void LearnerSGD::train(size_t maxDataPasses, std::string refType,
         refinementsNecessary--;
       }
 
-      // save current error
-      if ((processedPoints + 1) % 10 == 0) {
+      // save current error (every 10 data points)
+      if ((lastPoint + 1) / 10 > processedPoints / 10) {
+        updater->getAlphaAvg(alphaAvg);
         acc = getAccuracy(testData, testLabels, 0.0);
         avgErrors.append(1.0 - acc);
       }
 
-      processedPoints++;
+      processedPoints = lastPoint + 1;
     }
     cntDataPasses++;
   }
+  updater->getAlpha(alpha);
+  updater->getAlphaAvg(alphaAvg);
   std::cout << "# Training finished" << std::endl;
   std::cout << "final grid size: " << grid->getSize() << std::endl;
   // double mse = getError(testData, testLabels, "MSE");
@@ -8,9 +8,11 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/algorithm/SparseSGDUpdater.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -19,6 +21,8 @@ namespace datadriven {
 
 /**
  * LearnerSGD learns the data using stochastic gradient descent.
+ * The SGD steps only touch the basis functions which are non-zero at the
+ * current data points (see SparseSGDUpdater).
  */
 
 class LearnerSGD {
@@ -62,6 +66,22 @@ class LearnerSGD {
    */
   void initialize();
 
+  /**
+   * Sets the number of data points per SGD step (default 1).
+   * The gradients of the data points of a mini-batch are averaged.
+   *
+   * @param miniBatchSize The mini-batch size
+   */
+  void setMiniBatchSize(size_t miniBatchSize);
+
+  /**
+   * Enables lock-free concurrent processing of the data points of a
+   * mini-batch (Hogwild), which only pays off for larger mini-batches.
+   *
+   * @param hogwild Whether Hogwild updates should be used
+   */
+  void setHogwild(bool hogwild);
+
   /**
    * Implements online learning using stochastic gradient descent.
    *
@@ -177,6 +197,7 @@ class LearnerSGD {
   base::DataMatrix* batchData;
   base::DataVector* batchLabels;
   base::DataVector batchError;
+  std::unique_ptr<SparseSGDUpdater> updater;
 
   base::RegularGridConfiguration gridConfig;
   base::AdaptivityConfiguration adaptivityConfig;
@@ -186,8 +207,10 @@ class LearnerSGD {
   double currentGamma;
 
   size_t batchSize;
+  size_t miniBatchSize;
 
   bool useValidData;
+  bool hogwild;
 };
 
 }  // namespace datadriven
@@ -51,7 +51,7 @@ LearnerSVM::LearnerSVM(base::RegularGridConfiguration& gridConfig,
 
 LearnerSVM::~LearnerSVM() {}
 
-void LearnerSVM::initialize(size_t budget) {
+void LearnerSVM::initialize(size_t budget, SVMBudgetMaintenance budgetMaintenance) {
   // create grid
   grid = createRegularGrid();
 
@@ -60,7 +60,8 @@ void LearnerSVM::initialize(size_t budget) {
 
   // create SVM
   svm = std::unique_ptr<PrimalDualSVM>(
-      new PrimalDualSVM(grid->getSize(), trainData.getNcols(), budget, false));
+      new PrimalDualSVM(grid->getSize(), trainData.getNcols(), budget, false,
+                        budgetMaintenance));
 }
 
 std::unique_ptr<base::Grid> LearnerSVM::createRegularGrid() {
@@ -303,14 +304,11 @@ double LearnerSVM::getAccuracy(const sgpp::base::DataVector& referenceLabels,
 
 void LearnerSVM::predict(sgpp::base::DataMatrix& testData,
                          sgpp::base::DataVector& predictedLabels) {
-  predictedLabels.resize(testData.getNrows());
-  size_t dim = testData.getNcols();
+  // evaluate all test samples at once
+  svm->predictRaw(*grid, testData, predictedLabels);
 
-  for (size_t i = 0; i < testData.getNrows(); i++) {
-    // get next test sample x
-    sgpp::base::DataVector x(dim);
-    testData.getRow(i, x);
-    predictedLabels.set(i, svm->predict(*grid, x, dim));
+  for (size_t i = 0; i < predictedLabels.getSize(); i++) {
+    predictedLabels[i] = std::signbit(predictedLabels[i]) ? -1.0 : 1.0;
   }
 }
 
@@ -318,16 +316,17 @@ double LearnerSVM::getError(sgpp::base::DataMatrix& data,
                             sgpp::base::DataVector& labels,
                             std::string errorType) {
   size_t numData = data.getNrows();
-  size_t dim = data.getNcols();
   sgpp::base::DataVector error(numData);
   error.setAll(0.0);
 
+  // evaluate all samples at once
+  sgpp::base::DataVector predictions(numData);
+  svm->predictRaw(*grid, data, predictions);
+
   double res = -1.0;
   if (errorType == "MSE") {
     for (size_t i = 0; i < numData; i++) {
-      sgpp::base::DataVector x(dim);
-      data.getRow(i, x);
-      error.set(i, labels.get(i) - svm->predictRaw(*grid, x, dim));
+      error.set(i, labels.get(i) - predictions.get(i));
     }
     // loss (MSE)
     double sum = 0;
@@ -338,11 +337,7 @@ double LearnerSVM::getError(sgpp::base::DataMatrix& data,
   }
   if (errorType == "Hinge") {
     for (size_t i = 0; i < numData; i++) {
-      sgpp::base::DataVector x(dim);
-      data.getRow(i, x);
-      error.set(
-          i,
-          std::max(0.0, 1.0 - labels.get(i) * svm->predictRaw(*grid, x, dim)));
+      error.set(i, std::max(0.0, 1.0 - labels.get(i) * predictions.get(i)));
     }
     // loss (Hinge)
     double sum = 0;
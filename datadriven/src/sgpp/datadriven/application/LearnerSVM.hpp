@@ -79,8 +79,10 @@ class LearnerSVM {
    * Initializes the SVM learner.
    *
    * @param budget The max. number of stored support vectors
+   * @param budgetMaintenance Strategy applied when the budget is exhausted
    */
-  void initialize(size_t budget);
+  void initialize(size_t budget,
+                  SVMBudgetMaintenance budgetMaintenance = SVMBudgetMaintenance::Discard);
 
   /**
    * Implements support vector learning with sparse grid kernels.
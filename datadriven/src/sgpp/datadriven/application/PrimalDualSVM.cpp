@@ -4,18 +4,21 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/datadriven/application/PrimalDualSVM.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <memory>
 
 namespace sgpp {
 namespace datadriven {
 
 PrimalDualSVM::PrimalDualSVM(size_t dim, size_t dataDim, size_t budget,
-                             bool useBias)
+                             bool useBias, SVMBudgetMaintenance budgetMaintenance)
     : svs(sgpp::base::DataMatrix(0, dataDim)),
       alphas(sgpp::base::DataVector(0)),
       norms(sgpp::base::DataVector(0)),
@@ -23,34 +26,45 @@ PrimalDualSVM::PrimalDualSVM(size_t dim, size_t dataDim, size_t budget,
       w2(sgpp::base::DataVector(dim, 0.0)),
       budget(budget),
       useBias(useBias),
-      bias(0.0) {
-  svs.reserveAdditionalRows(budget);
+      bias(0.0),
+      budgetMaintenance(budgetMaintenance) {
+  // one additional row for the support vector added before the budget maintenance
+  svs.reserveAdditionalRows(budget + 1);
 }
 
 PrimalDualSVM::~PrimalDualSVM() {}
 
 double PrimalDualSVM::predictRaw(sgpp::base::Grid& grid,
-                                 sgpp::base::DataVector& x, size_t dataDim,
+                                 sgpp::base::DataVector& x, size_t /*dataDim*/,
                                  bool trans) {
-  sgpp::base::DataVector xTrans(grid.getSize());
+  double res;
   if (trans) {
-    xTrans = x;
+    res = w.dotProduct(x);
   } else {
-    // SG-kernel evaluation
-    sgpp::base::DataMatrix xMatrix(1, dataDim);
-    xMatrix.setRow(0, x);
-    sgpp::base::DataVector unitAlpha(1, 1.0);
-    std::unique_ptr<base::OperationMultipleEval> multEval(
-        op_factory::createOperationMultipleEval(grid, xMatrix));
-    multEval->multTranspose(unitAlpha, xTrans);
+    // the kernel expansion equals the sparse grid function with coefficients w
+    std::unique_ptr<base::OperationEval> opEval(op_factory::createOperationEval(grid));
+    res = opEval->eval(w, x);
   }
-  double res = w.dotProduct(xTrans);
   if (useBias) {
     res += bias;
   }
   return res;
 }
 
+void PrimalDualSVM::predictRaw(sgpp::base::Grid& grid,
+                               sgpp::base::DataMatrix& data,
+                               sgpp::base::DataVector& result) {
+  result.resize(data.getNrows());
+  std::unique_ptr<base::OperationMultipleEval> multEval(
+      op_factory::createOperationMultipleEval(grid, data));
+  multEval->mult(w, result);
+  if (useBias) {
+    for (size_t i = 0; i < result.getSize(); i++) {
+      result[i] += bias;
+    }
+  }
+}
+
 int PrimalDualSVM::predict(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
                            size_t dataDim) {
   bool sign = std::signbit(this->predictRaw(grid, x, dataDim));
@@ -76,35 +90,135 @@ void PrimalDualSVM::multiply(double scalar) {
 
 void PrimalDualSVM::add(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
                         double alpha, size_t dataDim) {
-  if (svs.getNrows() < budget) {
-    sgpp::base::DataVector xTrans(grid.getSize());
-    // SG-kernel evaluation
-    sgpp::base::DataMatrix xMatrix(1, dataDim);
-    xMatrix.setRow(0, x);
-    sgpp::base::DataVector unitAlpha(1, 1.0);
-    std::unique_ptr<base::OperationMultipleEval> multEval(
-        op_factory::createOperationMultipleEval(grid, xMatrix));
-    multEval->multTranspose(unitAlpha, xTrans);
-
-    svs.appendRow(x);
-    alphas.append(alpha);
-    norms.append(xTrans.dotProduct(xTrans));
-
-    sgpp::base::DataVector xTransCopy(xTrans);
-    xTrans.mult(alpha);
-    w.add(xTrans);
-    xTransCopy.mult(std::abs(alpha));
-    w2.add(xTransCopy);
+  if (svs.getNrows() >= budget &&
+      budgetMaintenance == SVMBudgetMaintenance::Discard) {
+    return;
+  }
 
-    if (useBias) {
-      bias += alpha;
+  sgpp::base::DataVector xTrans(grid.getSize());
+  transform(grid, x, dataDim, xTrans);
+
+  svs.appendRow(x);
+  alphas.append(alpha);
+  norms.append(xTrans.dotProduct(xTrans));
+  updateNormalVectors(xTrans, alpha, 1.0);
+
+  if (useBias) {
+    bias += alpha;
+  }
+
+  // budget maintenance, the normal vectors only contain the remaining support vectors
+  if (svs.getNrows() > budget) {
+    if (budgetMaintenance == SVMBudgetMaintenance::Merge &&
+        mergeSmallest(grid, dataDim)) {
+      return;
+    }
+
+    size_t smallest = 0;
+    for (size_t i = 1; i < alphas.getSize(); i++) {
+      if (std::abs(alphas[i]) < std::abs(alphas[smallest])) {
+        smallest = i;
+      }
     }
+    remove(grid, smallest, dataDim);
+  }
+}
+
+void PrimalDualSVM::remove(sgpp::base::Grid& grid, size_t idx, size_t dataDim) {
+  sgpp::base::DataVector x(dataDim);
+  sgpp::base::DataVector xTrans(grid.getSize());
+  svs.getRow(idx, x);
+  transform(grid, x, dataDim, xTrans);
+  updateNormalVectors(xTrans, alphas[idx], -1.0);
+
+  if (useBias) {
+    bias -= alphas[idx];
+  }
+
+  removeRow(idx);
+}
+
+void PrimalDualSVM::removeRow(size_t idx) {
+  const size_t last = svs.getNrows() - 1;
+  if (idx != last) {
+    const size_t ncols = svs.getNcols();
+    std::copy(svs.getPointer() + last * ncols, svs.getPointer() + (last + 1) * ncols,
+              svs.getPointer() + idx * ncols);
+    alphas[idx] = alphas[last];
+    norms[idx] = norms[last];
   }
+  svs.resizeRows(last);
+  alphas.resize(last);
+  norms.resize(last);
+}
+
+void PrimalDualSVM::updateNormalVectors(sgpp::base::DataVector& xTrans, double alpha,
+                                        double factor) {
+  w.axpy(factor * alpha, xTrans);
+  w2.axpy(factor * std::abs(alpha), xTrans);
+}
+
+void PrimalDualSVM::transform(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
+                              size_t dataDim, sgpp::base::DataVector& xTrans) {
+  // SG-kernel evaluation
+  sgpp::base::DataMatrix xMatrix(1, dataDim);
+  xMatrix.setRow(0, x);
+  sgpp::base::DataVector unitAlpha(1, 1.0);
+  std::unique_ptr<base::OperationMultipleEval> multEval(
+      op_factory::createOperationMultipleEval(grid, xMatrix));
+  multEval->multTranspose(unitAlpha, xTrans);
 }
 
-/*void PrimalDualSVM::remove(size_t idx) {
-  // ToDo:
-}*/
+bool PrimalDualSVM::mergeSmallest(sgpp::base::Grid& grid, size_t dataDim) {
+  const size_t n = alphas.getSize();
+  size_t first = 0;
+  for (size_t i = 1; i < n; i++) {
+    if (std::abs(alphas[i]) < std::abs(alphas[first])) {
+      first = i;
+    }
+  }
+
+  // partner with the same sign
+  size_t second = n;
+  for (size_t i = 0; i < n; i++) {
+    if (i != first &&
+        std::signbit(alphas[i]) == std::signbit(alphas[first]) &&
+        (second == n || std::abs(alphas[i]) < std::abs(alphas[second]))) {
+      second = i;
+    }
+  }
+
+  if (second == n) {
+    return false;
+  }
+
+  // the merged vector replaces the contributions of both vectors to the normal vectors
+  sgpp::base::DataVector x(dataDim);
+  sgpp::base::DataVector xTrans(grid.getSize());
+
+  for (size_t idx : {first, second}) {
+    svs.getRow(idx, x);
+    transform(grid, x, dataDim, xTrans);
+    updateNormalVectors(xTrans, alphas[idx], -1.0);
+  }
+
+  const double weightSum = std::abs(alphas[first]) + std::abs(alphas[second]);
+  const double firstWeight =
+      (weightSum > 0.0) ? std::abs(alphas[first]) / weightSum : 0.5;
+  for (size_t d = 0; d < dataDim; d++) {
+    svs.set(second, d, firstWeight * svs.get(first, d) +
+                           (1.0 - firstWeight) * svs.get(second, d));
+  }
+  alphas[second] += alphas[first];
+
+  svs.getRow(second, x);
+  transform(grid, x, dataDim, xTrans);
+  norms[second] = xTrans.dotProduct(xTrans);
+  updateNormalVectors(xTrans, alphas[second], 1.0);
+
+  removeRow(first);
+  return true;
+}
 
 }  // namespace datadriven
 }  // namespace sgpp
@@ -14,10 +14,33 @@
 namespace sgpp {
 namespace datadriven {
 
+/**
+ * Strategy applied when a support vector is added to a full budget.
+ */
+enum class SVMBudgetMaintenance {
+  /// the new support vector is discarded and doesn't change the normal vector
+  Discard,
+  /// the support vector with the smallest absolute weight is removed from the set
+  Removal,
+  /// the two support vectors with the smallest absolute weights (and the same sign) are merged
+  Merge
+};
+
 /**
  * Implementation of a support vector machine in primal
  * formulation which additionally stores support vectors.
  * For non-linear classification, sparse grid kernels are applied.
+ *
+ * As the sparse grid kernel is \f$K(x, y) = \phi(x)^T \phi(y)\f$, the kernel expansion
+ * \f$\sum_i \alpha_i K(x_i, x)\f$ equals the evaluation of the sparse grid function with the
+ * coefficients w at x. Hence predictions don't depend on the number of support vectors, and
+ * batches of queries are evaluated with the (vectorized) OperationMultipleEval of the grid.
+ *
+ * The support vectors are stored contiguously (one row per vector). If the budget is exhausted,
+ * the maintenance strategy decides which support vectors are kept; w and w2 always equal
+ * \f$\sum_i \alpha_i \phi(x_i)\f$ and \f$\sum_i |\alpha_i| \phi(x_i)\f$ over the kept support
+ * vectors. Both strategies need O(budget) operations plus one (Removal) or three (Merge) feature
+ * transformations.
  */
 
 class PrimalDualSVM {
@@ -29,8 +52,10 @@ class PrimalDualSVM {
    * @param inputDim The dimension of the data
    * @param budget The max number of support vectors
    * @param useBias Indicates whether bias should be used
+   * @param budgetMaintenance Strategy applied when the budget is exhausted
    */
-  PrimalDualSVM(size_t dim, size_t inputDim, size_t budget, bool useBias);
+  PrimalDualSVM(size_t dim, size_t inputDim, size_t budget, bool useBias,
+                SVMBudgetMaintenance budgetMaintenance = SVMBudgetMaintenance::Discard);
 
   /**
    * Destructor.
@@ -49,6 +74,16 @@ class PrimalDualSVM {
   double predictRaw(sgpp::base::Grid& grid, sgpp::base::DataVector& x,
                     size_t dataDim, bool trans = false);
 
+  /**
+   * Raw predictions for a batch of data points.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param data The data points (one per row)
+   * @param[out] result The raw prediction values
+   */
+  void predictRaw(sgpp::base::Grid& grid, sgpp::base::DataMatrix& data,
+                  sgpp::base::DataVector& result);
+
   /**
    * Class prediction for a given data point and grid.
    *
@@ -78,7 +113,15 @@ class PrimalDualSVM {
    */
   void multiply(double scalar);
 
-  // void remove(size_t idx);
+  /**
+   * Removes a support vector from the set (the last support vector takes its place)
+   * and its contribution from the normal vectors and the bias.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param idx The index of the support vector
+   * @param dataDim Dimension of the data
+   */
+  void remove(sgpp::base::Grid& grid, size_t idx, size_t dataDim);
 
   // the set of support vectors
   base::DataMatrix svs;
@@ -98,6 +141,48 @@ class PrimalDualSVM {
   bool useBias;
   // parameter to change position of decision hyperplane
   double bias;
+  // strategy applied when the budget is exhausted
+  SVMBudgetMaintenance budgetMaintenance;
+
+  /**
+   * Transforms a data point into the feature space.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param x The data point
+   * @param dataDim Dimension of x
+   * @param[out] xTrans The transformed data point
+   */
+  void transform(sgpp::base::Grid& grid, sgpp::base::DataVector& x, size_t dataDim,
+                 sgpp::base::DataVector& xTrans);
+
+  /**
+   * Adds the contribution of a support vector to the normal vectors, i.e.
+   * factor * alpha * xTrans to w and factor * |alpha| * xTrans to w2.
+   *
+   * @param xTrans The transformed support vector
+   * @param alpha The weight of the support vector
+   * @param factor 1 to add the contribution, -1 to subtract it
+   */
+  void updateNormalVectors(sgpp::base::DataVector& xTrans, double alpha, double factor);
+
+  /**
+   * Removes a support vector from the set (the last support vector takes its place)
+   * without changing the normal vectors.
+   *
+   * @param idx The index of the support vector
+   */
+  void removeRow(size_t idx);
+
+  /**
+   * Merges the support vector with the smallest absolute weight with the one with the next
+   * smallest absolute weight and the same sign. The merged vector is the mean of both vectors
+   * weighted with the absolute weights, its weight is the sum of both weights.
+   *
+   * @param grid The sparse grid which defines the transformation
+   * @param dataDim Dimension of the data
+   * @return whether two support vectors have been merged
+   */
+  bool mergeSmallest(sgpp::base::Grid& grid, size_t dataDim);
 };
 
 }  // namespace datadriven
@@ -728,21 +728,11 @@ void LearnerSGDEOnOffParallel::mergeAlphaValues(size_t classIndex,
           || !addedPoints.empty()) {
         D(std::cout << "Found necessary refinement data" << std::endl;)
 
-        // See DBMatOnlineDe::updateAlpha()
+        // See updateAlpha()
         if (!deletedPoints.empty()) {
-          D(std::cout << "Copying vector (deleting deleted grid points)." << std::endl;)
-          DataVector newAlpha{
-              dataVector.getSize() - deletedPoints.size() + addedPoints.size()};
-          for (size_t i = 0; i < dataVector.getSize(); i++) {
-            if (std::find(deletedPoints.begin(), deletedPoints.end(), i) !=
-                deletedPoints.end()) {
-              continue;
-            }
-
-            newAlpha.append(dataVector.get(i));
-          }
-          // set new alpha
-          dataVector = newAlpha;
+          D(std::cout << "Removing deleted grid points from vector." << std::endl;)
+          std::vector<size_t> vecDeletedPoints{std::begin(deletedPoints), std::end(deletedPoints)};
+          dataVector.remove(vecDeletedPoints);
         }
         dataVector.resizeZero(dataVector.size() + addedPoints.size());
         D(std::cout << "New alpha vector is now " << dataVector.size() << " elements long."
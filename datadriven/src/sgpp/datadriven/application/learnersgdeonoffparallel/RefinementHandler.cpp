@@ -119,8 +119,12 @@ void RefinementHandler::updateClassVariablesAfterRefinement(
 
     size_t numDimensions = learnerInstance->getDimensionality();
 
-    // Delete the grid points removed on master thread
-    grid.getStorage().deletePoints(refinementResult->deletedGridPointsIndices);
+    // Delete the grid points removed on master thread, the coarsening on the master keeps the
+    // order of the remaining points as well
+    grid.getStorage().compact(
+        std::vector<size_t>(refinementResult->deletedGridPointsIndices.begin(),
+                            refinementResult->deletedGridPointsIndices.end()),
+        sgpp::base::CompactionPolicy::Stable);
 
     size_t sizeBeforeAdditions = grid.getSize();
     D(std::cout << "Grid size after deleting is " << sizeBeforeAdditions << std::endl;)
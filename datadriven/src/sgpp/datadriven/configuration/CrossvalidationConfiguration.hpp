@@ -28,6 +28,7 @@ struct CrossvalidationConfiguration {
   int seed_;      // seed for randomized k-fold
   bool shuffle_;  // randomized/sequential k-fold
   bool silent_;   // verbosity
+  size_t parallelFolds_ = 1;  // number of folds that are trained concurrently
 
   // regularization parameter optimization
   double lambda_;       // regularization parameter
@@ -16,7 +16,15 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 namespace sgpp {
@@ -24,7 +32,11 @@ namespace datadriven {
 
 SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
     DataSourceCrossValidation* dataSource, ModelFittingBase* fitter, Scorer* scorer)
-    : SparseGridMiner(fitter, scorer), dataSource{dataSource} {}
+    : SparseGridMiner(fitter, scorer), dataSource{dataSource}, fitterFactory{nullptr} {}
+
+void SparseGridMinerCrossValidation::setFitterFactory(FitterFactory* fitterFactory) {
+  this->fitterFactory = fitterFactory;
+}
 
 double SparseGridMinerCrossValidation::learn(bool verbose) {
   // todo(fuchsgdk): see below
@@ -41,118 +53,210 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   const CrossvalidationConfiguration& crossValidationConfig =
       dataSource->getCrossValidationConfig();
 
-  std::vector<double> scores;
-  scores.reserve(crossValidationConfig.kfold_);
+  foldScores.assign(crossValidationConfig.kfold_, 0.0);
+
+  // concurrent folds need independent fitters and untransformed data
+  const size_t parallelFolds =
+      std::min(crossValidationConfig.parallelFolds_, crossValidationConfig.kfold_);
+  bool concurrentFolds =
+      (parallelFolds > 1) && (fitterFactory != nullptr) &&
+      (dataSource->getConfig().dataTransformationConfig.type == DataTransformationType::NONE);
+#ifdef USE_SCALAPACK
+  concurrentFolds =
+      concurrentFolds && !fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_;
+#endif /* USE_SCALAPACK */
+
+  if (parallelFolds > 1 && !concurrentFolds) {
+    print("Folds are trained sequentially, concurrent folds require a fitter factory and no data "
+          "transformation");
+  }
+
+  if (concurrentFolds) {
+    learnFoldsConcurrently(parallelFolds, verbose);
+  } else {
+    for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
+      std::ostringstream out;
+      out << "###############"
+          << "Fold #" << fold;
+      print(out);
 
-  for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
-    dataSource->setFold(fold);
+      // Reset the fitter
+      fitter->reset();
+      foldScores[fold] = learnFold(*fitter, fold, false, verbose);
+    }
+  }
 
-    // todo(fuchsgdk):
-    // This is the kind of cv implemented by Lettrich in the scorer class and it was
-    // merely moved to fit into the data source. Conceptual changes might be done in order to
-    // really support batch based learning with cv and not only regression.
-    // What should be done is reimplementing the data source such that it provides batches
+  // Calculate mean score and std deviation
+  double meanScore = 0.0;
+  for (size_t idx = 0; idx < foldScores.size(); idx++) {
+    meanScore += foldScores[idx];
+  }
+  meanScore /= static_cast<double>(foldScores.size());
+  double stdDeviation = 0.0;
+  for (size_t idx = 0; idx < foldScores.size(); idx++) {
+    stdDeviation += std::pow(foldScores[idx] - meanScore, 2);
+  }
+  stdDeviation = std::sqrt(stdDeviation / static_cast<double>(crossValidationConfig.kfold_ - 1));
 
+  std::ostringstream out;
+  out << "###############" << std::endl
+      << "Mean score: " << meanScore << std::endl
+      << "Standard deviation: " << stdDeviation;
+  print(out);
+  return meanScore;
+}
+
+const std::vector<double>& SparseGridMinerCrossValidation::getFoldScores() const {
+  return foldScores;
+}
+
+double SparseGridMinerCrossValidation::learnFold(ModelFittingBase& foldFitter, size_t fold,
+                                                 bool concurrent, bool verbose) {
+  // todo(fuchsgdk):
+  // This is the kind of cv implemented by Lettrich in the scorer class and it was
+  // merely moved to fit into the data source. Conceptual changes might be done in order to
+  // really support batch based learning with cv and not only regression.
+
+  // the folds are given by indices into the samples, which are read once; the validation data and
+  // the batches are copied from them
+  const DataSourceConfig& config = dataSource->getConfig();
+  Dataset& samples = dataSource->getSamples();
+  std::vector<size_t> validationIndices;
+  std::vector<size_t> trainingIndices;
+  dataSource->getFoldIndices(fold, validationIndices, trainingIndices);
+  std::unique_ptr<Dataset> validationData(
+      samples.getSubset(validationIndices, 0, validationIndices.size()));
+
+  // batches as provided by DataSource::getNextSamples
+  const size_t batchSize = (config.numBatches == 1 && config.batchSize == 0)
+                               ? trainingIndices.size()
+                               : config.batchSize;
+
+  // Create a refinement monitor for this fold
+  RefinementMonitorFactory monitorFactory;
+  std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+      foldFitter.getFitterConfiguration().getRefinementConfig()));
+
+  if (verbose) {
     std::ostringstream out;
-    out << "###############"
-        << "Fold #" << fold;
+    out << "Validation data size: " << validationData->getNumberInstances();
     print(out);
+  }
 
-    // Create a refinement monitor for this fold
-    RefinementMonitorFactory monitorFactory;
-    RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-        fitter->getFitterConfiguration().getRefinementConfig());
+  for (size_t epoch = 0; epoch < config.epochs; epoch++) {
+    if (verbose) {
+      std::ostringstream out;
+      out << "###############"
+          << "Starting training epoch #" << epoch;
+      print(out);
+    }
 
-    // Reset the fitter
-    fitter->reset();
+    // Process dataset iteratively
+    size_t iteration = 0;
+    for (size_t begin = 0; (batchSize > 0) && (begin < trainingIndices.size());
+         begin += batchSize) {
+      const size_t end = std::min(begin + batchSize, trainingIndices.size());
+      std::unique_ptr<Dataset> dataset;
+      if (concurrent) {
+        dataset.reset(samples.getSubset(trainingIndices, begin, end));
+      } else {
+        // the data source transforms the batch (if wanted), which only works for one fold at a time
+        dataset.reset(dataSource->getTrainingBatch(trainingIndices, begin, end));
+      }
+      size_t numInstances = dataset->getNumberInstances();
 
-    for (size_t epoch = 0; epoch < dataSource->getConfig().epochs; epoch++) {
       if (verbose) {
         std::ostringstream out;
         out << "###############"
-            << "Starting training epoch #" << epoch;
+            << "Itertation #" << (iteration++) << std::endl
+            << "Batch size: " << numInstances;
         print(out);
       }
-      dataSource->reset();
-      Dataset* validationData = dataSource->getValidationData();
-      size_t validationSize = validationData->getNumberInstances();
+
+      // Train model on new batch
+      foldFitter.update(*dataset);
+
+      // Evaluate the score on the training and validation data
+      double scoreTrain = scorer->test(foldFitter, *dataset);
+      double scoreVal = scorer->test(foldFitter, *validationData);
 
       if (verbose) {
         std::ostringstream out;
-        out << "Validation data size: " << validationSize;
+        out << "Score on batch: " << scoreTrain << std::endl
+            << "Score on validation data: " << scoreVal;
         print(out);
       }
-      // Process dataset iteratively
-      size_t iteration = 0;
-      while (true) {
-        std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
-        size_t numInstances = dataset->getNumberInstances();
-        if (numInstances == 0) {
-          // The source does not provide any more samples
-          break;
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Itertation #" << (iteration++) << std::endl
-              << "Batch size: " << numInstances;
-          print(out);
-        }
-
-        // Train model on new batch
-        fitter->update(*dataset);
-
-        // Evaluate the score on the training and validation data
-        double scoreTrain = scorer->test(*fitter, *dataset);
-        double scoreVal = scorer->test(*fitter, *validationData);
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "Score on batch: " << scoreTrain << std::endl
-              << "Score on validation data: " << scoreVal;
-          print(out);
-        }
-
-        // Refine the model if neccessary
-        monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
-        size_t refinements = monitor->refinementsNecessary();
-        while (refinements--) {
-          fitter->refine();
-        }
-
-        if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration finished.";
-          print(out);
-        }
+
+      // Refine the model if neccessary
+      monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
+      size_t refinements = monitor->refinementsNecessary();
+      while (refinements--) {
+        foldFitter.refine();
+      }
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Iteration finished.";
+        print(out);
       }
     }
-    // Evaluate the final score on the validation data
-    dataSource->reset();
-    Dataset* validationData = dataSource->getValidationData();
-    scores.push_back(scorer->test(*fitter, *validationData));
   }
 
-  // Calculate mean score and std deviation
-  double meanScore = 0.0;
-  for (size_t idx = 0; idx < scores.size(); idx++) {
-    meanScore += scores[idx];
-  }
-  meanScore /= static_cast<double>(scores.size());
-  double stdDeviation = 0.0;
-  for (size_t idx = 0; idx < scores.size(); idx++) {
-    stdDeviation += std::pow(scores[idx] - meanScore, 2);
+  // Evaluate the final score on the validation data
+  return scorer->test(foldFitter, *validationData);
+}
+
+void SparseGridMinerCrossValidation::learnFoldsConcurrently(size_t parallelFolds, bool verbose) {
+  const size_t kfold = dataSource->getCrossValidationConfig().kfold_;
+  // the samples are read before the folds share them
+  dataSource->getSamples();
+
+#ifdef _OPENMP
+  // each fold gets an equal share of the threads for the parallel regions of its fitter
+  const int maxActiveLevels = omp_get_max_active_levels();
+  const int threadsPerFold = std::max(1, omp_get_max_threads() / static_cast<int>(parallelFolds));
+  omp_set_max_active_levels(std::max(maxActiveLevels, 2));
+#endif
+
+  // exceptions must not leave the parallel region, the first one is rethrown after it
+  std::once_flag onceFlag;
+  std::exception_ptr exceptionPtr;
+
+#pragma omp parallel for num_threads(static_cast<int>(parallelFolds)) schedule(dynamic, 1)
+  for (size_t fold = 0; fold < kfold; fold++) {
+    try {
+#ifdef _OPENMP
+      omp_set_num_threads(threadsPerFold);
+#endif
+      // the factory isn't thread safe, only the fitters of the running folds exist at a time
+      std::unique_ptr<ModelFittingBase> foldFitter;
+#pragma omp critical
+      foldFitter.reset(fitterFactory->buildFitter());
+
+      foldScores[fold] = learnFold(*foldFitter, fold, true, false);
+      foldFitter.reset();
+
+      if (verbose) {
+        std::ostringstream out;
+        out << "###############"
+            << "Fold #" << fold << " score on validation data: " << foldScores[fold];
+#pragma omp critical
+        print(out);
+      }
+    } catch (...) {
+      std::call_once(onceFlag, [&]() { exceptionPtr = std::current_exception(); });
+    }
   }
-  stdDeviation = std::sqrt(stdDeviation / static_cast<double>(crossValidationConfig.kfold_ - 1));
 
-  std::ostringstream out;
-  out << "###############" << std::endl
-      << "Mean score: " << meanScore << std::endl
-      << "Standard deviation: " << stdDeviation;
-  print(out);
-  return meanScore;
+#ifdef _OPENMP
+  omp_set_max_active_levels(maxActiveLevels);
+#endif
+
+  if (exceptionPtr) {
+    std::rethrow_exception(exceptionPtr);
+  }
 }
+
 } /* namespace datadriven */
 } /* namespace sgpp */
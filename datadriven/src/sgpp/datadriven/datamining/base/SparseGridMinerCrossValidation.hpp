@@ -14,8 +14,10 @@
 
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -25,6 +27,12 @@ namespace datadriven {
  * validate the accuracy of the model itself. This process it slow and memory consuming and only
  * recommended for small datasets.
  *
+ * If a fitter factory is set and CrossvalidationConfiguration::parallelFolds_ is larger than one,
+ * that many folds are trained concurrently, each with its own fitter built by the factory and an
+ * equal share of the OpenMP threads. The folds then are given by indices into the samples of the
+ * data source, which are read once; the current batch and the validation data of a fold are
+ * copied from them, as the fitters train on datasets. Otherwise (and with data transformations
+ * or ScaLAPACK) the folds are trained one after another.
  */
 class SparseGridMinerCrossValidation : public SparseGridMiner {
  public:
@@ -77,12 +85,51 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
    */
   double learn(bool verbose) override;
 
+  /**
+   * Sets the factory used to build the fitters of concurrently trained folds.
+   * @param fitterFactory factory that builds fitters configured like the fitter of the miner. The
+   * miner doesn't take ownership, the factory has to exist while the miner learns.
+   */
+  void setFitterFactory(FitterFactory* fitterFactory);
+
+  /**
+   * Returns the scores of the folds on their validation data computed by the last call of #learn.
+   * @return score of each fold
+   */
+  const std::vector<double>& getFoldScores() const;
+
  private:
+  /**
+   * Trains a fitter on the training samples of a fold and scores it on the validation samples.
+   * @param foldFitter the (reset) fitter of the fold
+   * @param fold index of the fold
+   * @param concurrent whether other folds are trained at the same time, the batches are not
+   * transformed by the data source then
+   * @param verbose generate output on the progress
+   * @return score on the validation samples
+   */
+  double learnFold(ModelFittingBase& foldFitter, size_t fold, bool concurrent, bool verbose);
+
+  /**
+   * Trains and scores the folds concurrently, each with a fitter built by the fitter factory.
+   * @param parallelFolds number of folds that are trained at the same time
+   * @param verbose generate output on the progress
+   */
+  void learnFoldsConcurrently(size_t parallelFolds, bool verbose);
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
    */
   std::unique_ptr<DataSourceCrossValidation> dataSource;
+  /**
+   * Factory for the fitters of concurrently trained folds (not owned).
+   */
+  FitterFactory* fitterFactory;
+  /**
+   * Scores of the folds of the last learning cycle.
+   */
+  std::vector<double> foldScores;
 };
 
 } /* namespace datadriven */
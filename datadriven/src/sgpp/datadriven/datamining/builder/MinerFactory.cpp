@@ -42,11 +42,19 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
+  SparseGridMiner* miner = buildMiner(path);
+  FitterFactory* fitterFactory = createFitterFactory(parser);
+
+  // cross validation can train the folds concurrently with fitters of the optimizer's factory
+  auto crossValidationMiner = dynamic_cast<SparseGridMinerCrossValidation*>(miner);
+  if (crossValidationMiner != nullptr) {
+    crossValidationMiner->setFitterFactory(fitterFactory);
+  }
+
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    return new HarmonicaHyperparameterOptimizer(miner, fitterFactory, parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    return new BoHyperparameterOptimizer(miner, fitterFactory, parser);
   }
 }
 
@@ -37,7 +37,7 @@ Scorer* ScorerFactory::buildScorer(const DataMiningConfigParser& parser) {
   ScorerConfiguration config;
   parser.getScorerConfig(config, config);
   auto metric = buildMetric(config.metric);
-  return new Scorer(metric);
+  return new Scorer(metric, config.chunkSize);
 }
 
 
@@ -181,6 +181,7 @@ bool DataMiningConfigParser::getScorerConfig(ScorerConfiguration &config,
       std::cout << "# Did not find scorer[metric]. Setting default value "
                 << ScorerMetricTypeParser::toString(defaults.metric) << "." << std::endl;
     }
+    config.chunkSize = parseUInt(*scorerConfig, "chunkSize", defaults.chunkSize, "scorer");
   } else {
     std::cout << "# Could not find specification  of scorer. Falling Back to default values."
               << std::endl;
@@ -350,6 +351,8 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseBool(*crossvalidationConfig, "shuffle", defaults.shuffle_, "crossValidation");
     config.silent_ =
         parseBool(*crossvalidationConfig, "silent", defaults.silent_, "crossValidation");
+    config.parallelFolds_ = parseUInt(*crossvalidationConfig, "parallelFolds",
+                                      defaults.parallelFolds_, "crossValidation");
     config.lambda_ =
         parseDouble(*crossvalidationConfig, "lambda", defaults.lambda_, "crossValidation");
     config.lambdaStart_ = parseDouble(*crossvalidationConfig, "lambdaStart", defaults.lambdaStart_,
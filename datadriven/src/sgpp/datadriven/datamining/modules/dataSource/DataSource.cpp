@@ -44,38 +44,29 @@ DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
 DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.numBatches); }
 
 Dataset* DataSource::getNextSamples() {
-  Dataset* dataset = nullptr;
-
   // only one iteration: we want all samples
   if (config.numBatches == 1 && config.batchSize == 0) {
-    currentIteration++;
-    dataset = sampleProvider->getAllSamples();
-
-    // Transform dataset if wanted
-    if (!(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
-      dataTransformation->initialize(dataset, config.dataTransformationConfig);
-      return dataTransformation->doTransformation(dataset);
-    } else {
-      return dataset;
-    }
+    return processBatch(sampleProvider->getAllSamples());
     // several iterations
   } else {
-    dataset = sampleProvider->getNextSamples(config.batchSize);
-    currentIteration++;
+    return processBatch(sampleProvider->getNextSamples(config.batchSize));
+  }
+}
 
-    // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
-        !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
-      dataTransformation->initialize(dataset, config.dataTransformationConfig);
-      return dataTransformation->doTransformation(dataset);
-    }
+Dataset* DataSource::processBatch(Dataset* dataset) {
+  currentIteration++;
 
-    // Transform dataset if wanted
-    if (!(config.dataTransformationConfig.type == DataTransformationType::NONE))
-      return dataTransformation->doTransformation(dataset);
-    else
-      return dataset;
+  if (config.dataTransformationConfig.type == DataTransformationType::NONE) {
+    return dataset;
   }
+
+  // If all samples or first batch -> initialize transformation
+  if ((config.numBatches == 1 && config.batchSize == 0) || currentIteration == 1) {
+    dataTransformation->initialize(dataset, config.dataTransformationConfig);
+  }
+
+  // Transform dataset
+  return dataTransformation->doTransformation(dataset);
 }
 
 const DataSourceConfig& DataSource::getConfig() const { return config; }
@@ -101,6 +101,14 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+  /**
+   * Counts a batch of samples as an iteration and applies the data transformation (if wanted),
+   * which is initialized with the first batch or with all samples.
+   * @param dataset the batch of samples
+   * @return the batch or the transformed batch
+   */
+  Dataset* processBatch(Dataset* dataset);
 };
 
 } /* namespace datadriven */
@@ -14,6 +14,7 @@
 
 #include <vector>
 #include <iostream>
+#include <memory>
 
 using sgpp::base::DataVector;
 using sgpp::base::algorithm_exception;
@@ -51,6 +52,50 @@ const CrossvalidationConfiguration& DataSourceCrossValidation::getCrossValidatio
   return crossValidationConfig;
 }
 
+Dataset& DataSourceCrossValidation::getSamples() {
+  if (!samples) {
+    // the samples of the first fold are followed by all other samples in their original order
+    const size_t currentFold = shuffling->getFold();
+    shuffling->setFold(0);
+    sampleProvider->reset();
+    samples.reset(sampleProvider->getAllSamples());
+    shuffling->setFold(currentFold);
+    sampleProvider->reset();
+  }
+  return *samples;
+}
+
+void DataSourceCrossValidation::getFoldIndices(size_t foldIdx,
+                                               std::vector<size_t>& validationIndices,
+                                               std::vector<size_t>& trainingIndices) {
+  const size_t numSamples = getSamples().getNumberInstances();
+  const size_t kfold = crossValidationConfig.kfold_;
+  const size_t foldStart = (numSamples / kfold) * foldIdx;
+  // the last fold possibly is bigger
+  const size_t foldEnd =
+      (foldIdx == kfold - 1) ? numSamples : foldStart + numSamples / kfold;
+
+  validationIndices.resize(foldEnd - foldStart);
+  trainingIndices.resize(numSamples - (foldEnd - foldStart));
+
+  for (size_t i = foldStart; i < foldEnd; i++) {
+    validationIndices[i - foldStart] = i;
+  }
+
+  for (size_t i = 0; i < foldStart; i++) {
+    trainingIndices[i] = i;
+  }
+
+  for (size_t i = foldEnd; i < numSamples; i++) {
+    trainingIndices[i - (foldEnd - foldStart)] = i;
+  }
+}
+
+Dataset* DataSourceCrossValidation::getTrainingBatch(const std::vector<size_t>& indices,
+                                                     size_t begin, size_t end) {
+  return processBatch(getSamples().getSubset(indices, begin, end));
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
 
@@ -15,6 +15,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 #include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -23,7 +24,8 @@ namespace datadriven {
  * DataSourceCrossValidation is a high level interface to provide functionality for processing
  * data using a cross validation enviroment. That is retrieving a certain fold for validation
  * and the rest of the data for training.
- * Note that memory-wise this is very costly and not tractable for large data.
+ * Note that memory-wise this is very costly and not tractable for large data. Folds can also be
+ * accessed by indices into the shared samples (see #getSamples and #getFoldIndices).
  */
 class DataSourceCrossValidation : public DataSource {
  public:
@@ -64,6 +66,36 @@ class DataSourceCrossValidation : public DataSource {
    */
   const CrossvalidationConfiguration& getCrossValidationConfig() const;
 
+  /**
+   * Returns all samples in the order in which the folds are defined. The samples are read from the
+   * sample provider once and shared by all folds, which only store indices of these samples (see
+   * #getFoldIndices). The data transformation is not applied.
+   * @return reference to the samples (owned by the data source)
+   */
+  Dataset& getSamples();
+
+  /**
+   * Computes the indices of the validation and the training samples of a fold, the samples are
+   * given by #getSamples. The training samples are in the order in which the sample provider
+   * returns them after the validation samples if the fold is set with #setFold.
+   * @param foldIdx index of the fold
+   * @param validationIndices indices of the validation samples
+   * @param trainingIndices indices of the training samples
+   */
+  void getFoldIndices(size_t foldIdx, std::vector<size_t>& validationIndices,
+                      std::vector<size_t>& trainingIndices);
+
+  /**
+   * Returns a batch of training samples given by indices of #getSamples. The data transformation
+   * is applied as for the batches of #getNextSamples, so this method must not be called
+   * concurrently.
+   * @param indices indices of the samples (e.g. the training indices of a fold)
+   * @param begin position of the first sample of the batch in indices
+   * @param end position after the last sample of the batch in indices
+   * @return pointer to the new batch
+   */
+  Dataset* getTrainingBatch(const std::vector<size_t>& indices, size_t begin, size_t end);
+
  private:
   /**
    * Validation dataset
@@ -77,6 +109,10 @@ class DataSourceCrossValidation : public DataSource {
    * Shuffling functor that is held by the sample provider.
    */
   DataShufflingFunctorCrossValidation* shuffling;
+  /**
+   * All samples in the order of the folds, read on demand.
+   */
+  std::unique_ptr<Dataset> samples;
 };
 
 } /* namespace datadriven */
@@ -34,6 +34,8 @@ void DataShufflingFunctorCrossValidation::setFold(size_t fold) {
   }
 }
 
+size_t DataShufflingFunctorCrossValidation::getFold() const { return currentFold; }
+
 size_t DataShufflingFunctorCrossValidation::operator()(size_t idx, size_t numSamples) {
   size_t foldSize = getCurrentFoldSize(numSamples);
   size_t foldStart = (numSamples / crossValidationConfig.kfold_) * currentFold;
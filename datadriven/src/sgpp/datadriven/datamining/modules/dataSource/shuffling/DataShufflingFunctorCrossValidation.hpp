@@ -48,6 +48,12 @@ class DataShufflingFunctorCrossValidation : public DataShufflingFunctor {
    */
   void setFold(size_t fold);
 
+  /**
+   * Get the index of the current fold
+   * @return the index of the current fold
+   */
+  size_t getFold() const;
+
   /**
    * Returns the size of the fold currently used for validation
    * @param numSamples the number of samples in total
@@ -11,6 +11,7 @@
 
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
 // TODO(lettrich): allow different refinement types
@@ -28,8 +29,44 @@ using sgpp::solver::SLESolver;
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+/**
+ * System matrix of the training data since the last fit: the matrix-free system of the latest
+ * dataset plus the assembled Gram matrix \f$B^T B\f$ of the earlier ones.
+ */
+class AccumulatedSystemMatrix : public base::OperationMatrix {
+ public:
+  AccumulatedSystemMatrix(DMSystemMatrixBase &latestSystemMatrix, DataMatrix &earlierGramMatrix,
+                          double earlierRegularization)
+      : latestSystemMatrix(latestSystemMatrix),
+        earlierGramMatrix(earlierGramMatrix),
+        earlierRegularization(earlierRegularization) {}
+
+  void mult(DataVector &alpha, DataVector &result) override {
+    latestSystemMatrix.mult(alpha, result);
+
+    if (earlierGramMatrix.getNrows() > 0) {
+      DataVector temp{alpha.getSize()};
+      earlierGramMatrix.mult(alpha, temp);
+      result.add(temp);
+      result.axpy(earlierRegularization, alpha);
+    }
+  }
+
+ private:
+  DMSystemMatrixBase &latestSystemMatrix;
+  DataMatrix &earlierGramMatrix;
+  double earlierRegularization;
+};
+
+}  // namespace
+
 ModelFittingLeastSquares::ModelFittingLeastSquares(const FitterConfigurationLeastSquares &config)
-    : ModelFittingBaseSingleGrid{}, refinementsPerformed{0} {
+    : ModelFittingBaseSingleGrid{},
+      refinementsPerformed{0},
+      latestInstances{0},
+      earlierInstances{0} {
   this->config = std::unique_ptr<FitterConfiguration>(
       std::make_unique<FitterConfigurationLeastSquares>(config));
   solver = std::unique_ptr<SLESolver>{buildSolver(this->config->getSolverFinalConfig())};
@@ -51,16 +88,17 @@ void ModelFittingLeastSquares::evaluate(DataMatrix &samples, DataVector &results
 void ModelFittingLeastSquares::fit(Dataset &newDataset) {
   // clear model
   reset();
-  dataset = &newDataset;
 
   // build grid
   auto &gridConfig = config->getGridConfig();
-  gridConfig.dim_ = dataset->getDimension();
+  gridConfig.dim_ = newDataset.getDimension();
   grid = std::unique_ptr<Grid>{buildGrid(config->getGridConfig())};
   // build surplus vector
   alpha = DataVector{grid->getSize()};
+  // no training data yet, the update with the dataset assembles and solves the system
+  b = DataVector{grid->getSize()};
 
-  assembleSystemAndSolve(config->getSolverFinalConfig(), alpha);
+  update(newDataset);
 }
 
 bool ModelFittingLeastSquares::refine() {
@@ -73,10 +111,19 @@ bool ModelFittingLeastSquares::refine() {
       auto noPoints = grid->getSize();
       grid->getGenerator().refine(refinementFunctor);
       if (grid->getSize() > noPoints) {
-        // Tell the SLE manager that the grid changed (for interal data structures)
+        // new points are appended, so the old surpluses are kept as starting vector
         alpha.resizeZero(grid->getSize());
+        // Tell the system matrix that the grid changed (for interal data structures)
+        systemMatrix->prepareGrid();
 
-        assembleSystemAndSolve(config->getSolverRefineConfig(), alpha);
+        // the earlier datasets aren't available to assemble the rows of the new points, so the
+        // system is restricted to the latest dataset
+        earlierGramMatrix = DataMatrix{};
+        earlierInstances = 0;
+        b = DataVector{grid->getSize()};
+        systemMatrix->generateb(dataset->getTargets(), b);
+
+        solveSystem(config->getSolverRefineConfig());
         refinementsPerformed++;
         return true;
       } else {
@@ -94,11 +141,27 @@ bool ModelFittingLeastSquares::refine() {
 
 void ModelFittingLeastSquares::update(Dataset &newDataset) {
   if (grid != nullptr) {
-    reset();
+    // the previous dataset becomes part of the assembled normal equations
+    if (systemMatrix != nullptr) {
+      accumulateLatestGramMatrix();
+    }
+
     // reassign dataset
     dataset = &newDataset;
-    // create sytem matrix
-    assembleSystemAndSolve(config->getSolverFinalConfig(), alpha);
+    latestInstances = newDataset.getNumberInstances();
+
+    // create sytem matrix of the new dataset
+    systemMatrix.reset(buildSystemMatrix(*grid, newDataset.getData(),
+                                         config->getRegularizationConfig().lambda_,
+                                         config->getMultipleEvalConfig()));
+
+    // add the right hand side of the new dataset
+    DataVector bNew{grid->getSize()};
+    systemMatrix->generateb(newDataset.getTargets(), bNew);
+    b.add(bNew);
+
+    // warm start from the previous surpluses
+    solveSystem(config->getSolverFinalConfig());
   } else {
     fit(newDataset);
   }
@@ -115,20 +178,48 @@ DMSystemMatrixBase *ModelFittingLeastSquares::buildSystemMatrix(
 
 void ModelFittingLeastSquares::reset() {
   grid.reset();
+  systemMatrix.reset();
   refinementsPerformed = 0;
+  latestInstances = 0;
+  earlierGramMatrix = DataMatrix{};
+  earlierInstances = 0;
+  b = DataVector{};
 }
 
-void ModelFittingLeastSquares::assembleSystemAndSolve(const SLESolverConfiguration &solverConfig,
-                                                      DataVector &alpha) const {
-  auto systemMatrix = std::unique_ptr<DMSystemMatrixBase>(
-      buildSystemMatrix(*grid, dataset->getData(), config->getRegularizationConfig().lambda_,
-                        config->getMultipleEvalConfig()));
+void ModelFittingLeastSquares::accumulateLatestGramMatrix() {
+  const size_t gridSize = grid->getSize();
+  const double latestRegularization =
+      static_cast<double>(latestInstances) * config->getRegularizationConfig().lambda_;
+
+  if (earlierGramMatrix.getNrows() == 0) {
+    earlierGramMatrix = DataMatrix{gridSize, gridSize, 0.0};
+  }
+
+  // the system matrix applied to the unit vectors gives the columns of B^T B + m * lambda * I
+  DataVector unitVector{gridSize, 0.0};
+  DataVector column{gridSize};
+
+  for (size_t j = 0; j < gridSize; j++) {
+    unitVector[j] = 1.0;
+    systemMatrix->mult(unitVector, column);
+    unitVector[j] = 0.0;
+    column[j] -= latestRegularization;
+
+    for (size_t i = 0; i < gridSize; i++) {
+      earlierGramMatrix.set(i, j, earlierGramMatrix.get(i, j) + column[i]);
+    }
+  }
+
+  earlierInstances += latestInstances;
+}
 
-  DataVector b{grid->getSize()};
-  systemMatrix->generateb(dataset->getTargets(), b);
+void ModelFittingLeastSquares::solveSystem(const SLESolverConfiguration &solverConfig) {
+  AccumulatedSystemMatrix accumulatedSystemMatrix(
+      *systemMatrix, earlierGramMatrix,
+      static_cast<double>(earlierInstances) * config->getRegularizationConfig().lambda_);
 
   reconfigureSolver(*solver, solverConfig);
-  solver->solve(*systemMatrix, alpha, b, true, verboseSolver, DEFAULT_RES_THRESHOLD);
+  solver->solve(accumulatedSystemMatrix, alpha, b, true, verboseSolver, DEFAULT_RES_THRESHOLD);
 }
 }  // namespace datadriven
 }  // namespace sgpp
@@ -15,6 +15,8 @@
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 #include <sgpp/solver/SLESolver.hpp>
 
+#include <memory>
+
 using sgpp::solver::SLESolver;
 using sgpp::base::DataMatrix;
 using sgpp::base::Grid;
@@ -30,6 +32,16 @@ namespace datadriven {
  *
  * Allows usage of different grids, different solvers and different regularization techniques based
  * on the provided configuration objects.
+ *
+ * The model can be trained incrementally: update() keeps the grid and the surpluses of the previous
+ * fit and solves the normal equations of all datasets since the last fit, starting from the
+ * previous solution. Hence, the result is the same as that of a fit on the concatenated datasets
+ * (up to the solver tolerance). The datasets aren't kept: the latest one is part of the matrix-free
+ * system matrix, the earlier ones are accumulated in an assembled Gram matrix \f$B^T B\f$ and the
+ * right hand side \f$B^T y\f$. An update costs one product of the system matrix of the previous
+ * dataset per grid point plus the solver iterations on the new dataset, the memory consumption
+ * is quadratic in the grid size. As the earlier datasets aren't available to assemble the
+ * rows of new grid points, refine() restricts the system to the latest dataset.
  */
 class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
  public:
@@ -55,6 +67,12 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   bool refine() override;
 
+  /**
+   * Train the existing model with a new dataset. The grid is kept, the normal equations of the
+   * dataset are added to the ones of the earlier datasets since the last fit, and the system is
+   * solved starting from the current surpluses. If there is no model yet, fit() is called.
+   * @param dataset the new training dataset.
+   */
   void update(Dataset &dataset) override;
 
   /**
@@ -94,13 +112,42 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
                                         OperationMultipleEvalConfiguration &config) const;
 
   /**
-   * based on the current dataset and grid, assemble a system of linear equations and solve for the
-   * hierarchical surplus vector alpha.
+   * Adds \f$B^T B\f$ of the latest dataset, obtained from its system matrix, to the Gram matrix
+   * of the earlier datasets.
+   */
+  void accumulateLatestGramMatrix();
+
+  /**
+   * Solve the normal equations of all datasets since the last fit (since the last refinement if
+   * there were updates), starting from the current surpluses.
    * @param solverConfig: Configuration of the SLESolver (refinement, or final solver).
-   * @param alpha: Reference to a data vector where hierarchical surpluses will be stored into. Make
-   * sure the vector size is equal to the amount of grid points.
    */
-  void assembleSystemAndSolve(const SLESolverConfiguration &solverConfig, DataVector &alpha) const;
+  void solveSystem(const SLESolverConfiguration &solverConfig);
+
+  /**
+   * Matrix-free system matrix of the latest dataset, kept across refinements.
+   */
+  std::unique_ptr<DMSystemMatrixBase> systemMatrix;
+
+  /**
+   * Number of instances of the latest dataset.
+   */
+  size_t latestInstances;
+
+  /**
+   * Gram matrix \f$B^T B\f$ of the datasets before the latest one (empty if there are none).
+   */
+  DataMatrix earlierGramMatrix;
+
+  /**
+   * Number of instances of the datasets before the latest one.
+   */
+  size_t earlierInstances;
+
+  /**
+   * Right hand side \f$B^T y\f$ of all datasets in the system.
+   */
+  DataVector b;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -20,13 +20,25 @@ namespace datadriven {
 Metric* Accuracy::clone() const { return new Accuracy(*this); }
 
 double Accuracy::measure(const DataVector& predictedValues, const DataVector& trueValues) const {
+  return finalize(accumulate(predictedValues.getPointer(), trueValues.getPointer(),
+                             predictedValues.size()),
+                  predictedValues.size());
+}
+
+double Accuracy::accumulate(const double* predictedValues, const double* trueValues,
+                            size_t count) const {
   size_t correct = 0;
-  for (size_t i = 0; i < predictedValues.size(); i++) {
-    if (predictedValues.get(i) == trueValues.get(i)) {
+#pragma omp parallel for reduction(+ : correct) schedule(static)
+  for (size_t i = 0; i < count; i++) {
+    if (predictedValues[i] == trueValues[i]) {
       correct++;
     }
   }
-  return static_cast<double>(correct) / static_cast<double>(predictedValues.size());
+  return static_cast<double>(correct);
+}
+
+double Accuracy::finalize(double accumulated, size_t count) const {
+  return accumulated / static_cast<double>(count);
 }
 
 } /* namespace datadriven */
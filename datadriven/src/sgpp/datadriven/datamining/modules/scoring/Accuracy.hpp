@@ -33,6 +33,26 @@ class Accuracy : public Metric {
    * @return mean squared error (MSE) - strictly positive such that smaller values are better.
    */
   double measure(const DataVector& predictedValues, const DataVector& trueValues) const override;
+
+  /**
+   * Contribution of a chunk of instances to the accuracy.
+   *
+   * @param predictedValues values calculated by the model for the instances of the chunk
+   * @param trueValues actual values of the instances of the chunk
+   * @param count number of instances in the chunk
+   * @return sum of the contributions of the instances
+   */
+  double accumulate(const double* predictedValues, const double* trueValues,
+                    size_t count) const override;
+
+  /**
+   * Computes the accuracy from the accumulated contributions.
+   *
+   * @param accumulated sum of the contributions of all instances
+   * @param count number of instances
+   * @return ratio of the correctly predicted instances
+   */
+  double finalize(double accumulated, size_t count) const override;
 };
 
 } /* namespace datadriven */
@@ -20,13 +20,24 @@ namespace datadriven {
 Metric *MSE::clone() const { return new MSE(*this); }
 
 double MSE::measure(const DataVector &predictedValues, const DataVector &trueValues) const {
-  DataVector tmp(predictedValues);
-  tmp.sub(trueValues);
-  // std::cout << "Predicted " << predictedValues.toString() << std::endl;
-  // std::cout << "True " << trueValues.toString() << std::endl;
-  // std::cout << "Residual " << tmp.toString() << std::endl;
-  const double error = tmp.l2Norm();
-  return (error * error / static_cast<double>(tmp.getSize()));
+  return finalize(accumulate(predictedValues.getPointer(), trueValues.getPointer(),
+                             predictedValues.getSize()),
+                  predictedValues.getSize());
+}
+
+double MSE::accumulate(const double *predictedValues, const double *trueValues,
+                       size_t count) const {
+  double sum = 0.0;
+#pragma omp parallel for reduction(+ : sum) schedule(static)
+  for (size_t i = 0; i < count; i++) {
+    const double residual = predictedValues[i] - trueValues[i];
+    sum += residual * residual;
+  }
+  return sum;
+}
+
+double MSE::finalize(double accumulated, size_t count) const {
+  return accumulated / static_cast<double>(count);
 }
 } /* namespace datadriven */
 } /* namespace sgpp */
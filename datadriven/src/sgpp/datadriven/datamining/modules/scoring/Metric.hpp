@@ -80,6 +80,28 @@ class Metric {
    */
   virtual double measure(const DataVector &predictedValues,
                          const DataVector &trueValues) const = 0;
+
+  /**
+   * Streaming evaluation: accumulates the contributions of a chunk of instances. The metric of a
+   * dataset is #finalize applied to the sum of the contributions of its chunks, so the predicted
+   * values never have to be stored for the whole dataset.
+   *
+   * @param predictedValues values calculated by the model for the instances of the chunk
+   * @param trueValues actual values of the instances of the chunk
+   * @param count number of instances in the chunk
+   * @return sum of the contributions of the instances
+   */
+  virtual double accumulate(const double *predictedValues, const double *trueValues,
+                            size_t count) const = 0;
+
+  /**
+   * Streaming evaluation: computes the metric from the accumulated contributions.
+   *
+   * @param accumulated sum of the contributions of all instances (see #accumulate)
+   * @param count number of instances
+   * @return Quantification of the difference. Smaller is better.
+   */
+  virtual double finalize(double accumulated, size_t count) const = 0;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
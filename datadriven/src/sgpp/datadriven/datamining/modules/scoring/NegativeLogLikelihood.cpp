@@ -22,15 +22,25 @@ Metric *NegativeLogLikelihood::clone() const { return new NegativeLogLikelihood(
 
 double NegativeLogLikelihood::measure(
     const DataVector &predictedValues, const DataVector &trueValues) const {
-  DataVector tmp(predictedValues);
+  return finalize(accumulate(predictedValues.getPointer(), trueValues.getPointer(),
+                             predictedValues.size()),
+                  predictedValues.size());
+}
+
+double NegativeLogLikelihood::accumulate(const double *predictedValues,
+                                         const double * /*trueValues*/, size_t count) const {
   double ll = 0.0;
-  for (size_t i = 0; i < predictedValues.size(); i++) {
-    double prob = predictedValues.get(i);
-    if (prob > 0) {
-      ll += std::log(prob);
+#pragma omp parallel for reduction(+ : ll) schedule(static)
+  for (size_t i = 0; i < count; i++) {
+    if (predictedValues[i] > 0) {
+      ll += std::log(predictedValues[i]);
     }
   }
-  return -ll;
+  return ll;
+}
+
+double NegativeLogLikelihood::finalize(double accumulated, size_t /*count*/) const {
+  return -accumulated;
 }
 } /* namespace datadriven */
 } /* namespace sgpp */
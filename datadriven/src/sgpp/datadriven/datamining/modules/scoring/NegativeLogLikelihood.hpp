@@ -38,6 +38,26 @@ class NegativeLogLikelihood : public Metric {
    * @return the negative log likelihood of the predicted probabilities
    */
   double measure(const DataVector &predictedValues, const DataVector &trueValues) const override;
+
+  /**
+   * Contribution of a chunk of instances to the negative log likelihood.
+   *
+   * @param predictedValues values calculated by the model for the instances of the chunk
+   * @param trueValues ignored
+   * @param count number of instances in the chunk
+   * @return sum of the contributions of the instances
+   */
+  double accumulate(const double *predictedValues, const double *trueValues,
+                    size_t count) const override;
+
+  /**
+   * Computes the negative log likelihood from the accumulated contributions.
+   *
+   * @param accumulated sum of the contributions of all instances
+   * @param count number of instances
+   * @return the negative log likelihood
+   */
+  double finalize(double accumulated, size_t count) const override;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -16,12 +16,14 @@
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationOnOffParallel.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
+#include <algorithm>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
-Scorer::Scorer(Metric* metric) : metric{std::unique_ptr<Metric>{metric}} {}
+Scorer::Scorer(Metric* metric, size_t chunkSize)
+    : metric{std::unique_ptr<Metric>{metric}}, chunkSize{std::max(chunkSize, size_t{1})} {}
 
 double Scorer::test(ModelFittingBase& model, Dataset& testDataset) {
 #ifdef USE_SCALAPACK
@@ -29,10 +31,40 @@ double Scorer::test(ModelFittingBase& model, Dataset& testDataset) {
     return testDistributed(model, testDataset);
   }
 #endif
-  DataVector predictedValues{testDataset.getNumberInstances()};
-  model.evaluate(testDataset.getData(), predictedValues);
-  // set score
-  return metric->measure(predictedValues, testDataset.getTargets());
+  const size_t numInstances = testDataset.getNumberInstances();
+  DataMatrix& data = testDataset.getData();
+  const DataVector& targets = testDataset.getTargets();
+
+  if (numInstances <= chunkSize) {
+    DataVector predictedValues{numInstances};
+    model.evaluate(data, predictedValues);
+    return metric->finalize(
+        metric->accumulate(predictedValues.getPointer(), targets.getPointer(), numInstances),
+        numInstances);
+  }
+
+  // evaluate chunks of instances and accumulate the score
+  const size_t dim = data.getNcols();
+  DataMatrix chunk{chunkSize, dim};
+  DataVector predictedValues{chunkSize};
+  double accumulated = 0.0;
+
+  for (size_t begin = 0; begin < numInstances; begin += chunkSize) {
+    const size_t count = std::min(chunkSize, numInstances - begin);
+
+    if (count < chunk.getNrows()) {
+      chunk.resizeRows(count);
+      predictedValues.resize(count);
+    }
+
+    std::copy(data.getPointer() + begin * dim, data.getPointer() + (begin + count) * dim,
+              chunk.getPointer());
+    model.evaluate(chunk, predictedValues);
+    accumulated +=
+        metric->accumulate(predictedValues.getPointer(), targets.getPointer() + begin, count);
+  }
+
+  return metric->finalize(accumulated, numInstances);
 }
 
 double Scorer::testDistributed(ModelFittingBase& model, Dataset& testDataset) {
@@ -34,9 +34,11 @@ class Scorer {
    *
    * @param metric  #sgpp::datadriven::Metric to to quantify approximation quality of a trained
    * model. Scorer will take ownership of this object.
-   * puts a random seed.
+   * @param chunkSize number of instances that are evaluated at once when testing; the metric is
+   * accumulated over the chunks, so the predictions are never stored for the whole dataset. The
+   * model builds its evaluation operation for each chunk, so the chunks shouldn't be too small.
    */
-  explicit Scorer(Metric* metric);
+  explicit Scorer(Metric* metric, size_t chunkSize = 65536);
 
   /**
    * Move constructor
@@ -64,7 +66,9 @@ class Scorer {
   ~Scorer() = default;
 
   /**
-   * evaluate the accuracy on the test set using the #sgpp::datadriven::Metric.
+   * evaluate the accuracy on the test set using the #sgpp::datadriven::Metric. The test set is
+   * evaluated in chunks. The scorer has no state that changes during testing, so models can be
+   * tested concurrently.
    *
    * @param model model to be fitted based on the train dataset.
    * @param testDataset dataset used quantify accuracy using #sgpp::datadriven::Metric.
@@ -87,6 +91,11 @@ class Scorer {
    * #sgpp::datadriven::Metric to be used to quantify accuracy of the fit.
    */
   std::unique_ptr<Metric> metric;
+
+  /**
+   * Number of instances that are evaluated at once.
+   */
+  size_t chunkSize;
 };
 
 } /* namespace datadriven */
@@ -31,6 +31,11 @@ struct ScorerConfiguration {
    * Type of metric that should be used to calculate the accuracy of the fit.
    */
   ScorerMetricType metric = ScorerMetricType::accuracy;
+  /**
+   * Number of instances that are evaluated at once when testing. Each chunk builds the
+   * evaluation operation of the model anew, so small chunks save memory at the cost of this setup.
+   */
+  size_t chunkSize = 65536;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -71,6 +71,11 @@ namespace datadriven {
     }
   }
 
+  bool MultiSurplusRefinementFunctor::isThreadSafe() const {
+    // the surplus functors only read the surpluses
+    return true;
+  }
+
   void MultiSurplusRefinementFunctor::setGridIndex(size_t grid_index) {
     this->current_grid_index = grid_index;
   }
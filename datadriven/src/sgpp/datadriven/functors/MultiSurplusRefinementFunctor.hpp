@@ -45,6 +45,7 @@ class MultiSurplusRefinementFunctor : public MultiGridRefinementFunctor {
   double start() const override;
   size_t getRefinementsNum() const override;
   double getRefinementThreshold() const override;
+  bool isThreadSafe() const override;
   virtual ~MultiSurplusRefinementFunctor() {}
 
   void setGridIndex(size_t grid_index) override;
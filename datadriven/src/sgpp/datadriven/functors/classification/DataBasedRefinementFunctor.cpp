@@ -77,6 +77,10 @@ namespace datadriven {
     return this->threshold;
   }
 
+  bool DataBasedRefinementFunctor::isThreadSafe() const {
+    return true;
+  }
+
   void DataBasedRefinementFunctor::setGridIndex(size_t grid_index) {
     this->current_grid_index = grid_index;
   }
@@ -56,6 +56,7 @@ class DataBasedRefinementFunctor : public MultiGridRefinementFunctor {
   double start() const override;
   size_t getRefinementsNum() const override;
   double getRefinementThreshold() const override;
+  bool isThreadSafe() const override;
   virtual ~DataBasedRefinementFunctor() {}
 
   void setGridIndex(size_t grid_index) override;
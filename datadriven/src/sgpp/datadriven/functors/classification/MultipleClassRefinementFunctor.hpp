@@ -45,6 +45,13 @@ class MultipleClassRefinementFunctor: public ZeroCrossingRefinementFunctor {
   double operator()(base::GridStorage& storage,
                     size_t seq) const override;
 
+  /**
+   * The evaluation accumulates the border scores, hence it must not run concurrently.
+   *
+   * @return false
+   */
+  bool isThreadSafe() const override { return false; }
+
   /**
    * Gets the range in which densities are considered to be close.
    * Gives a percentage [0,1].
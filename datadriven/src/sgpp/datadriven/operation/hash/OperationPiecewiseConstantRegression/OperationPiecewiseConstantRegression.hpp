@@ -14,7 +14,7 @@
 #include "sgpp/base/operation/hash/OperationMultipleEval.hpp"
 #include "sgpp/base/tools/SGppStopwatch.hpp"
 #include "sgpp/base/exception/operation_exception.hpp"
-#include "sgpp/datadriven/operation/hash/OperationPiecewiseConstantRegression/Node.hpp"
+#include "sgpp/datadriven/operation/hash/OperationPiecewiseConstantRegression/Tree.hpp"
 #include "sgpp/globaldef.hpp"
 
 namespace sgpp {
@@ -29,31 +29,11 @@ class OperationPiecewiseConstantRegression {
   OperationPiecewiseConstantRegression(base::DataMatrix& dataset, base::DataVector& values)
       : dataset(dataset), values(values), dims(dataset.getNcols()) {}
 
-  std::unique_ptr<PiecewiseConstantRegression::Node> hierarchize(double targetMSE,
+  std::unique_ptr<PiecewiseConstantRegression::Tree> hierarchize(double targetMSE,
                                                                  size_t targetMaxLevel) {
-    std::vector<double> xRoot(dims);
-
-    for (size_t d = 0; d < dims; d++) {
-      xRoot[d] = 0.5;
-    }
-
-    std::vector<double> hRoot(dims);
-
-    for (size_t d = 0; d < dims; d++) {
-      hRoot[d] = 0.5;
-    }
-
-    std::vector<size_t> rootSupport(dataset.getNrows());
-
-    for (size_t i = 0; i < dataset.getNrows(); i++) {
-      rootSupport[i] = i;
-    }
-
-    std::unique_ptr<PiecewiseConstantRegression::Node> root =
-        std::make_unique<PiecewiseConstantRegression::Node>(xRoot, hRoot, rootSupport, dataset,
-                                                            values);
-
-    root->hierarchize(targetMSE, targetMaxLevel);
+    std::unique_ptr<PiecewiseConstantRegression::Tree> root =
+        std::make_unique<PiecewiseConstantRegression::Tree>(dataset, values, targetMSE,
+                                                            targetMaxLevel);
 
     std::cout << "total node count: " << (root->getChildCount() + 1) << std::endl;
     std::cout << "hierarchization max level: " << root->getHierarchizationMaxLevel() << std::endl;
@@ -0,0 +1,387 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <algorithm>
+#include <vector>
+
+#include "sgpp/base/operation/hash/common/basis/LinearBasis.hpp"
+#include "sgpp/datadriven/operation/hash/OperationPiecewiseConstantRegression/Tree.hpp"
+
+namespace sgpp {
+namespace datadriven {
+namespace PiecewiseConstantRegression {
+
+namespace {
+
+/**
+ * Node of the current level of the construction.
+ */
+struct LevelNode {
+  size_t node;
+  // range of the point indices in the index buffer of the level
+  size_t begin;
+  size_t count;
+  // value of the node (sum of the surpluses on the path from the root)
+  double value;
+};
+
+/**
+ * Statistics of the points of a half of a node.
+ */
+struct HalfStatistics {
+  size_t count;
+  double sum;
+  // sum of the squared differences to the value of the node
+  double squaredError;
+};
+
+/// number of points of a node processed by one thread
+const size_t BLOCK_SIZE = 4096;
+
+}  // namespace
+
+Tree::Tree(base::DataMatrix& dataset, base::DataVector& values, double targetMSE,
+           size_t targetMaxLevel)
+    : dataset(dataset), values(values), dim(dataset.getNcols()), maxLevel(0) {
+  const size_t numPoints = dataset.getNrows();
+
+  // coordinates column by column, a split only reads one dimension
+  std::vector<double> coordinates(dim * numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      coordinates[d * numPoints + i] = dataset.get(i, d);
+    }
+  }
+
+  // root: the unit cube with the average of all points
+  std::vector<size_t> indices(numPoints);
+  double sum = 0.0;
+
+  for (size_t i = 0; i < numPoints; i++) {
+    indices[i] = i;
+    sum += values[i];
+  }
+
+  const double rootValue = (numPoints > 0) ? sum / static_cast<double>(numPoints) : 0.0;
+  surplus.push_back(rootValue);
+  splitDim.push_back(0);
+  splitPoint.push_back(0.5);
+  leftChild.push_back(0);
+  rightChild.push_back(0);
+  center.assign(dim, 0.5);
+  h.assign(dim, 0.5);
+
+  if (dim == 0) {
+    return;
+  }
+
+  auto inUnitCube = [&coordinates, numPoints, this](size_t i) {
+    for (size_t d = 0; d < dim; d++) {
+      const double p = coordinates[d * numPoints + i];
+
+      if ((p < 0.0) || (p > 1.0)) {
+        return false;
+      }
+    }
+
+    return true;
+  };
+
+  std::vector<LevelNode> level = {LevelNode{0, 0, numPoints, rootValue}};
+  std::vector<size_t> nextIndices;
+
+  for (size_t l = 0; (l < targetMaxLevel) && !level.empty(); l++) {
+    const size_t r = l % dim;
+    const double* x = &coordinates[r * numPoints];
+
+    // the points of the nodes are split into blocks, so the top levels with few (large) nodes
+    // are processed in parallel as well; the blocks of node k are blockBegin[k], ...,
+    // blockBegin[k + 1] - 1
+    std::vector<size_t> blockBegin(level.size() + 1, 0);
+
+    for (size_t k = 0; k < level.size(); k++) {
+      blockBegin[k + 1] = blockBegin[k] + (level[k].count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    }
+
+    const size_t numBlocks = blockBegin.back();
+    std::vector<size_t> blockNode(numBlocks);
+
+    for (size_t k = 0; k < level.size(); k++) {
+      std::fill(blockNode.begin() + blockBegin[k], blockNode.begin() + blockBegin[k + 1], k);
+    }
+
+    // points of a block: begin and end index in the index buffer of the level
+    auto blockRange = [&level, &blockBegin, &blockNode](size_t b, size_t& begin, size_t& end) {
+      const LevelNode& current = level[blockNode[b]];
+      begin = current.begin + (b - blockBegin[blockNode[b]]) * BLOCK_SIZE;
+      end = std::min(begin + BLOCK_SIZE, current.begin + current.count);
+    };
+
+    // statistics of both halves of each block in one pass over its points
+    std::vector<HalfStatistics> blockStatistics(2 * numBlocks);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t b = 0; b < numBlocks; b++) {
+      const LevelNode& current = level[blockNode[b]];
+      const double mid = center[current.node * dim + r];
+      HalfStatistics left = {0, 0.0, 0.0};
+      HalfStatistics right = {0, 0.0, 0.0};
+      size_t begin, end;
+      blockRange(b, begin, end);
+
+      for (size_t j = begin; j < end; j++) {
+        const size_t i = indices[j];
+
+        // the root may contain points outside of the unit cube, its children don't
+        if ((l == 0) && !inUnitCube(i)) {
+          continue;
+        }
+
+        const double v = values[i];
+        const double diff = current.value - v;
+
+        // points on the split belong to both halves
+        if (x[i] <= mid) {
+          left.count++;
+          left.sum += v;
+          left.squaredError += diff * diff;
+        }
+
+        if (x[i] >= mid) {
+          right.count++;
+          right.sum += v;
+          right.squaredError += diff * diff;
+        }
+      }
+
+      blockStatistics[2 * b] = left;
+      blockStatistics[2 * b + 1] = right;
+    }
+
+    // create the refined halves (in breadth-first order) and their index ranges, the statistics
+    // of the blocks are summed in a fixed order, so the tree doesn't depend on the number of
+    // threads
+    std::vector<LevelNode> nextLevel;
+    // per block: position of its first point in the index buffers of the refined halves
+    std::vector<size_t> blockOffsets(2 * numBlocks, 0);
+    size_t nextCount = 0;
+
+    for (size_t k = 0; k < level.size(); k++) {
+      const LevelNode& current = level[k];
+
+      for (size_t side = 0; side < 2; side++) {
+        HalfStatistics half = {0, 0.0, 0.0};
+
+        for (size_t b = blockBegin[k]; b < blockBegin[k + 1]; b++) {
+          blockOffsets[2 * b + side] = nextCount + half.count;
+          half.count += blockStatistics[2 * b + side].count;
+          half.sum += blockStatistics[2 * b + side].sum;
+          half.squaredError += blockStatistics[2 * b + side].squaredError;
+        }
+
+        if ((half.count == 0) ||
+            (half.squaredError / static_cast<double>(half.count) <= targetMSE)) {
+          continue;
+        }
+
+        const size_t child = surplus.size();
+        const double average = half.sum / static_cast<double>(half.count);
+        surplus.push_back(average - current.value);
+        // value of the child, the sum of the surpluses on its path
+        const double value = current.value + surplus.back();
+        splitDim.push_back(0);
+        splitPoint.push_back(0.0);
+        leftChild.push_back(0);
+        rightChild.push_back(0);
+
+        center.resize(center.size() + dim);
+        h.resize(h.size() + dim);
+        std::copy(&center[current.node * dim], &center[current.node * dim] + dim,
+                  &center[child * dim]);
+        std::copy(&h[current.node * dim], &h[current.node * dim] + dim, &h[child * dim]);
+
+        h[child * dim + r] /= 2.0;
+        center[child * dim + r] += (side == 0) ? -h[child * dim + r] : h[child * dim + r];
+
+        (side == 0 ? leftChild : rightChild)[current.node] = child;
+        splitDim[current.node] = r;
+        nextLevel.push_back(LevelNode{child, nextCount, half.count, value});
+        nextCount += half.count;
+      }
+
+      splitPoint[current.node] = center[current.node * dim + splitDim[current.node]];
+    }
+
+    if (nextLevel.empty()) {
+      break;
+    }
+
+    maxLevel = l + 1;
+
+    // copy the point indices of the refined halves, each block to its own positions
+    nextIndices.resize(nextCount);
+
+#pragma omp parallel for schedule(dynamic)
+    for (size_t b = 0; b < numBlocks; b++) {
+      const LevelNode& current = level[blockNode[b]];
+      const double mid = center[current.node * dim + r];
+      size_t* left = nullptr;
+      size_t* right = nullptr;
+
+      if (leftChild[current.node] != 0) {
+        left = nextIndices.data() + blockOffsets[2 * b];
+      }
+
+      if (rightChild[current.node] != 0) {
+        right = nextIndices.data() + blockOffsets[2 * b + 1];
+      }
+
+      if ((left == nullptr) && (right == nullptr)) {
+        continue;
+      }
+
+      size_t begin, end;
+      blockRange(b, begin, end);
+
+      for (size_t j = begin; j < end; j++) {
+        const size_t i = indices[j];
+
+        if ((l == 0) && !inUnitCube(i)) {
+          continue;
+        }
+
+        if ((left != nullptr) && (x[i] <= mid)) {
+          *(left++) = i;
+        }
+
+        if ((right != nullptr) && (x[i] >= mid)) {
+          *(right++) = i;
+        }
+      }
+    }
+
+    indices.swap(nextIndices);
+    level.swap(nextLevel);
+  }
+}
+
+double Tree::evaluatePoint(const double* point) const {
+  double sum = 0.0;
+  size_t node = 0;
+
+  while (true) {
+    sum += surplus[node];
+    const size_t child =
+        (point[splitDim[node]] < splitPoint[node]) ? leftChild[node] : rightChild[node];
+
+    if (child == 0) {
+      return sum;
+    }
+
+    node = child;
+  }
+}
+
+double Tree::evaluate(std::vector<double>& point) { return evaluatePoint(point.data()); }
+
+void Tree::evaluate(base::DataMatrix& points, base::DataVector& result) {
+  const size_t numPoints = points.getNrows();
+  const size_t numCols = points.getNcols();
+  const double* data = points.getPointer();
+  result.resize(numPoints);
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < numPoints; i++) {
+    result[i] = evaluatePoint(data + i * numCols);
+  }
+}
+
+double Tree::integrate(sgpp::base::GridPoint& gridPoint, size_t& integratedNodes) {
+  integratedNodes = 0;
+  return integrateNode(0, gridPoint, integratedNodes);
+}
+
+double Tree::integrateNode(size_t node, sgpp::base::GridPoint& gridPoint,
+                           size_t& integratedNodes) {
+  integratedNodes += 1;
+
+  sgpp::base::SLinearBase basis;
+  const double* x = &center[node * dim];
+  const double* hNode = &h[node * dim];
+  double sum = 0.0;
+  double integral = 1.0;
+
+  for (size_t d = 0; d < dim; d++) {
+    // integrate left side of triangle
+    double integral1D = 0.0;
+
+    double gridPointHat = gridPoint.getStandardCoordinate(d);
+
+    double gridPointH = (1.0 / static_cast<double>(1 << gridPoint.getLevel(d)));
+
+    double leftGridPointHat = gridPointHat - gridPointH;
+    double rightGridPointHat = gridPointHat + gridPointH;
+
+    double leftGridPointConstant = x[d] - hNode[d];
+    double rightGridPointConstant = x[d] + hNode[d];
+
+    double leftSideLeftBorder = std::max(leftGridPointHat, leftGridPointConstant);
+    double leftSideRightBorder = std::min(gridPointHat, rightGridPointConstant);
+
+    if (leftSideRightBorder > leftSideLeftBorder) {
+      double leftIntegral1D = (leftSideRightBorder - leftSideLeftBorder) *
+                               basis.eval(gridPoint.getLevel(d), gridPoint.getIndex(d),
+                                          (leftSideRightBorder + leftSideLeftBorder) / 2.0);
+      integral1D += leftIntegral1D;
+    }
+
+    double rightSideLeftBorder = std::max(gridPointHat, leftGridPointConstant);
+    double rightSideRightBorder = std::min(rightGridPointHat, rightGridPointConstant);
+
+    if (rightSideRightBorder > rightSideLeftBorder) {
+      double rightIntegral1D = (rightSideRightBorder - rightSideLeftBorder) *
+                                basis.eval(gridPoint.getLevel(d), gridPoint.getIndex(d),
+                                           (rightSideRightBorder + rightSideLeftBorder) / 2.0);
+      integral1D += rightIntegral1D;
+    }
+
+    integral *= integral1D;
+  }
+
+  double product = surplus[node] * integral;
+
+  if (integral > 0.0) {
+    if (leftChild[node] != 0) {
+      sum += integrateNode(leftChild[node], gridPoint, integratedNodes);
+    }
+
+    if (rightChild[node] != 0) {
+      sum += integrateNode(rightChild[node], gridPoint, integratedNodes);
+    }
+  }
+
+  return sum + product;
+}
+
+uint64_t Tree::getChildCount() { return surplus.size() - 1; }
+
+uint64_t Tree::getHierarchizationMaxLevel() { return maxLevel; }
+
+double Tree::getMSE() {
+  base::DataVector evaluations;
+  evaluate(dataset, evaluations);
+  double mse = 0.0;
+
+  for (size_t i = 0; i < dataset.getNrows(); i++) {
+    mse += (evaluations[i] - values[i]) * (evaluations[i] - values[i]);
+  }
+
+  return mse;
+}
+
+}  // namespace PiecewiseConstantRegression
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,113 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <vector>
+
+#include "sgpp/globaldef.hpp"
+#include "sgpp/base/datatypes/DataMatrix.hpp"
+#include "sgpp/base/datatypes/DataVector.hpp"
+#include "sgpp/base/grid/GridStorage.hpp"
+
+namespace sgpp {
+namespace datadriven {
+namespace PiecewiseConstantRegression {
+
+/**
+ * Hierarchical piecewise-constant approximation of a dataset.
+ *
+ * Each node is a box of the unit cube, its surplus is the average of the values of the data
+ * points in the box minus the value of its parent. A node is split in halves in one dimension
+ * (cycling through the dimensions with the level), a half becomes a child if it contains data
+ * points and if the parent's value doesn't approximate them within the target MSE.
+ *
+ * The nodes are stored in flat arrays in breadth-first order and reference their children by
+ * index. The tree is built level by level: the points of the nodes of a level are split into
+ * blocks of fixed size, which are processed in parallel (so the top levels with few nodes are
+ * parallelized as well). Each block computes the statistics of both halves in a single pass over
+ * its points and later copies the point indices of the refined halves into the index buffer of
+ * the next level. The statistics of the blocks are summed in a fixed order, hence the tree
+ * doesn't depend on the number of threads.
+ */
+class Tree {
+ public:
+  /**
+   * Builds the tree.
+   *
+   * @param dataset data points in the unit cube (one per row)
+   * @param values values of the data points
+   * @param targetMSE a half of a node is refined if the MSE of the node's value on the half is
+   * larger than this
+   * @param targetMaxLevel maximal level of the nodes (the root has level zero)
+   */
+  Tree(base::DataMatrix& dataset, base::DataVector& values, double targetMSE,
+       size_t targetMaxLevel);
+
+  /**
+   * Evaluates the approximation at a point.
+   *
+   * @param point the point
+   * @return value of the approximation
+   */
+  double evaluate(std::vector<double>& point);
+
+  /**
+   * Evaluates the approximation at many points (in parallel).
+   *
+   * @param points the points (one per row)
+   * @param[out] result values of the approximation
+   */
+  void evaluate(base::DataMatrix& points, base::DataVector& result);
+
+  /**
+   * Computes the L2 scalar product of the approximation and a linear basis function.
+   *
+   * @param gridPoint grid point of the basis function
+   * @param[out] integratedNodes number of nodes visited
+   * @return value of the scalar product
+   */
+  double integrate(sgpp::base::GridPoint& gridPoint, size_t& integratedNodes);
+
+  /**
+   * @return number of nodes without the root
+   */
+  uint64_t getChildCount();
+
+  /**
+   * @return maximal level of the nodes
+   */
+  uint64_t getHierarchizationMaxLevel();
+
+  /**
+   * @return sum of the squared errors on the dataset
+   */
+  double getMSE();
+
+ private:
+  double evaluatePoint(const double* point) const;
+
+  double integrateNode(size_t node, sgpp::base::GridPoint& gridPoint, size_t& integratedNodes);
+
+  base::DataMatrix& dataset;
+  base::DataVector& values;
+  size_t dim;
+  size_t maxLevel;
+
+  // per node: surplus, dimension and position of the split, children (0 if not present, the
+  // root is never a child)
+  std::vector<double> surplus;
+  std::vector<size_t> splitDim;
+  std::vector<double> splitPoint;
+  std::vector<size_t> leftChild;
+  std::vector<size_t> rightChild;
+  // boxes of the nodes, center[node * dim + d] and h[node * dim + d]
+  std::vector<double> center;
+  std::vector<double> h;
+};
+
+}  // namespace PiecewiseConstantRegression
+}  // namespace datadriven
+}  // namespace sgpp
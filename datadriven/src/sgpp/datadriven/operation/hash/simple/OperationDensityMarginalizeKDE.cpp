@@ -49,6 +49,7 @@ void OperationDensityMarginalizeKDE::doMarginalize(
   }
 
   // initialize kde with new samples
+  marginalizedKDE.setTreeEvaluation(kde->isTreeEvaluation(), kde->getTreeRelativeError());
   marginalizedKDE.initialize(newSamplesVec);
 }
 
@@ -82,6 +83,7 @@ void OperationDensityMarginalizeKDE::doMarginalize(
     }
   }
 
+  marginalizedKDE.setTreeEvaluation(kde->isTreeEvaluation(), kde->getTreeRelativeError());
   marginalizedKDE.initialize(newSamplesVec);
 }
 
@@ -96,6 +98,7 @@ void OperationDensityMarginalizeKDE::margToDimX(
   newSamplesVec[0] = kde->getSamples(mdim);
 
   // initialize marginalized kde
+  marginalizedKDE.setTreeEvaluation(kde->isTreeEvaluation(), kde->getTreeRelativeError());
   marginalizedKDE.initialize(newSamplesVec);
 }
 
@@ -111,6 +114,7 @@ void OperationDensityMarginalizeKDE::margToDimXs(
   }
 
   // initialize kde with new samples
+  marginalizedKDE.setTreeEvaluation(kde->isTreeEvaluation(), kde->getTreeRelativeError());
   marginalizedKDE.initialize(newSamplesVec);
 }
 }  // namespace datadriven
@@ -7,6 +7,9 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -34,5 +37,19 @@ const sgpp::base::DataVector& Dataset::getTargets() const { return targets; }
 
 const sgpp::base::DataMatrix& Dataset::getData() const { return data; }
 
+Dataset* Dataset::getSubset(const std::vector<size_t>& indices, size_t begin, size_t end) const {
+  Dataset* subset = new Dataset(end - begin, dimension);
+  const double* src = data.getPointer();
+  double* dest = subset->data.getPointer();
+
+  for (size_t i = begin; i < end; i++) {
+    std::copy(src + indices[i] * dimension, src + (indices[i] + 1) * dimension,
+              dest + (i - begin) * dimension);
+    subset->targets[i - begin] = targets[indices[i]];
+  }
+
+  return subset;
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
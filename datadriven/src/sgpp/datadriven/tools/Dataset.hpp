@@ -12,6 +12,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -61,6 +62,17 @@ class Dataset {
    */
   const sgpp::base::DataMatrix& getData() const;
 
+  /**
+   * Copies a subset of the instances into a new dataset.
+   *
+   * @param indices indices of instances of this dataset
+   * @param begin first position in indices that is copied
+   * @param end end of the positions in indices that are copied
+   * @return dataset containing the instances indices[begin], ..., indices[end - 1] (owned by the
+   * caller)
+   */
+  Dataset* getSubset(const std::vector<size_t>& indices, size_t begin, size_t end) const;
+
  protected:
   size_t numberInstances;
   size_t dimension;
@@ -51,6 +51,8 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp>
+#include <sgpp/datadriven/algorithm/SparseSGDUpdater.hpp>
+#include <sgpp/datadriven/algorithm/KernelDensityTree.hpp>
 
 #include <sgpp/datadriven/functors/MultiGridRefinementFunctor.hpp>
 #include <sgpp/datadriven/functors/MultiSurplusRefinementFunctor.hpp>
@@ -0,0 +1,262 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
+#include <sgpp/datadriven/datamining/base/SparseGridMinerCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/hpo/FitterFactory.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/MSE.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::base::application_exception;
+using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::DataShufflingFunctor;
+using sgpp::datadriven::DataShufflingFunctorCrossValidation;
+using sgpp::datadriven::DataShufflingFunctorRandom;
+using sgpp::datadriven::DataShufflingFunctorSequential;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourceCrossValidation;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::FitterConfigurationLeastSquares;
+using sgpp::datadriven::FitterFactory;
+using sgpp::datadriven::ModelFittingBase;
+using sgpp::datadriven::ModelFittingLeastSquares;
+using sgpp::datadriven::MSE;
+using sgpp::datadriven::Scorer;
+using sgpp::datadriven::SparseGridMinerCrossValidation;
+
+namespace {
+
+/**
+ * ARFF string of quasi-random points (golden ratio sequences) with the values of a smooth function.
+ */
+std::string createArff(size_t numInstances) {
+  std::ostringstream arff;
+  arff << "@RELATION test\n@ATTRIBUTE x0 NUMERIC\n@ATTRIBUTE x1 NUMERIC\n"
+       << "@ATTRIBUTE class NUMERIC\n@DATA\n";
+  arff.precision(17);
+
+  for (size_t i = 0; i < numInstances; i++) {
+    const double x0 = std::fmod(0.5 + 0.6180339887 * static_cast<double>(i), 1.0);
+    const double x1 = std::fmod(0.5 + 0.7548776662 * static_cast<double>(i), 1.0);
+    arff << x0 << "," << x1 << "," << std::sin(3.0 * x0) * std::exp(x1) + x0 * x1 << "\n";
+  }
+
+  return arff.str();
+}
+
+/**
+ * Data source for k-fold cross validation of the samples of createArff, the caller owns the
+ * cross validation shuffling.
+ */
+DataSourceCrossValidation* createDataSource(
+    size_t numInstances, const CrossvalidationConfiguration& crossValidationConfig,
+    DataShufflingFunctor* shuffling, DataShufflingFunctorCrossValidation*& cvShuffling) {
+  cvShuffling = new DataShufflingFunctorCrossValidation(crossValidationConfig, shuffling);
+  auto sampleProvider = new ArffFileSampleProvider(cvShuffling);
+  sampleProvider->readString(createArff(numInstances), true);
+  return new DataSourceCrossValidation(DataSourceConfig(), crossValidationConfig, cvShuffling,
+                                       sampleProvider);
+}
+
+void checkEqualSamples(Dataset& samples, const std::vector<size_t>& indices, Dataset& dataset) {
+  BOOST_REQUIRE_EQUAL(dataset.getNumberInstances(), indices.size());
+
+  for (size_t i = 0; i < indices.size(); i++) {
+    BOOST_CHECK_EQUAL(dataset.getTargets()[i], samples.getTargets()[indices[i]]);
+
+    for (size_t d = 0; d < samples.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(dataset.getData().get(i, d), samples.getData().get(indices[i], d));
+    }
+  }
+}
+
+FitterConfigurationLeastSquares createFitterConfig() {
+  FitterConfigurationLeastSquares config;
+  config.setupDefaults();
+  config.getGridConfig().level_ = 3;
+  config.getSolverRefineConfig().maxIterations_ = 1000;
+  config.getSolverFinalConfig().maxIterations_ = 1000;
+  config.getRegularizationConfig().lambda_ = 1e-3;
+  return config;
+}
+
+/**
+ * Builds least squares fitters with the configuration of createFitterConfig.
+ */
+class LeastSquaresFitterFactory : public FitterFactory {
+ public:
+  ModelFittingBase* buildFitter() override {
+    return new ModelFittingLeastSquares(createFitterConfig());
+  }
+};
+
+/**
+ * Least squares fitter that fails to train.
+ */
+class ThrowingFitter : public ModelFittingLeastSquares {
+ public:
+  ThrowingFitter() : ModelFittingLeastSquares(createFitterConfig()) {}
+
+  void update(Dataset& /*dataset*/) override {
+    throw application_exception("ThrowingFitter: update failed");
+  }
+};
+
+/**
+ * Builds least squares fitters, the fitter of one fold fails to train.
+ */
+class ThrowingFitterFactory : public FitterFactory {
+ public:
+  ThrowingFitterFactory() : numFitters(0) {}
+
+  ModelFittingBase* buildFitter() override {
+    // the fitters are built under omp critical, the first one is the fitter of the miner
+    if (++numFitters == 4) {
+      return new ThrowingFitter();
+    }
+
+    return new ModelFittingLeastSquares(createFitterConfig());
+  }
+
+ private:
+  size_t numFitters;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestCrossValidationFolds)
+
+BOOST_AUTO_TEST_CASE(testFoldIndices) {
+  // the last fold is bigger
+  const size_t numInstances = 23;
+  CrossvalidationConfiguration crossValidationConfig;
+  crossValidationConfig.kfold_ = 4;
+
+  for (bool shuffle : {false, true}) {
+    std::unique_ptr<DataShufflingFunctor> shuffling;
+
+    if (shuffle) {
+      shuffling.reset(new DataShufflingFunctorRandom(42));
+    } else {
+      shuffling.reset(new DataShufflingFunctorSequential());
+    }
+
+    DataShufflingFunctorCrossValidation* cvShuffling;
+    std::unique_ptr<DataSourceCrossValidation> dataSource(
+        createDataSource(numInstances, crossValidationConfig, shuffling.get(), cvShuffling));
+    std::unique_ptr<DataShufflingFunctorCrossValidation> cvShufflingOwner(cvShuffling);
+    Dataset& samples = dataSource->getSamples();
+    BOOST_CHECK_EQUAL(samples.getNumberInstances(), numInstances);
+
+    for (size_t fold = 0; fold < crossValidationConfig.kfold_; fold++) {
+      std::vector<size_t> validationIndices;
+      std::vector<size_t> trainingIndices;
+      dataSource->getFoldIndices(fold, validationIndices, trainingIndices);
+      BOOST_CHECK_EQUAL(validationIndices.size() + trainingIndices.size(), numInstances);
+
+      // the same samples in the same order as provided by the sample provider
+      dataSource->setFold(fold);
+      dataSource->reset();
+      checkEqualSamples(samples, validationIndices, *dataSource->getValidationData());
+      std::unique_ptr<Dataset> trainingData(dataSource->getNextSamples());
+      checkEqualSamples(samples, trainingIndices, *trainingData);
+
+      std::unique_ptr<Dataset> batch(
+          dataSource->getTrainingBatch(trainingIndices, 0, trainingIndices.size()));
+      checkEqualSamples(samples, trainingIndices, *batch);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentFolds) {
+  const size_t numInstances = 200;
+  std::vector<double> foldScores;
+
+  for (size_t parallelFolds : {1, 3}) {
+    CrossvalidationConfiguration crossValidationConfig;
+    crossValidationConfig.kfold_ = 4;
+    crossValidationConfig.parallelFolds_ = parallelFolds;
+    DataShufflingFunctorSequential shuffling;
+    DataShufflingFunctorCrossValidation* cvShuffling;
+    DataSourceCrossValidation* dataSource =
+        createDataSource(numInstances, crossValidationConfig, &shuffling, cvShuffling);
+    std::unique_ptr<DataShufflingFunctorCrossValidation> cvShufflingOwner(cvShuffling);
+    LeastSquaresFitterFactory fitterFactory;
+
+    SparseGridMinerCrossValidation miner(dataSource, fitterFactory.buildFitter(),
+                                         new Scorer(new MSE()));
+    miner.setFitterFactory(&fitterFactory);
+    const double meanScore = miner.learn(false);
+    BOOST_REQUIRE_EQUAL(miner.getFoldScores().size(), crossValidationConfig.kfold_);
+
+    if (parallelFolds == 1) {
+      foldScores = miner.getFoldScores();
+    } else {
+      // the concurrent folds are trained like the sequential ones
+      for (size_t fold = 0; fold < foldScores.size(); fold++) {
+        BOOST_CHECK_CLOSE(miner.getFoldScores()[fold], foldScores[fold], 1e-6);
+      }
+    }
+
+    double sum = 0.0;
+
+    for (double score : miner.getFoldScores()) {
+      sum += score;
+    }
+
+    BOOST_CHECK_CLOSE(meanScore, sum / static_cast<double>(crossValidationConfig.kfold_), 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testConcurrentFoldsRethrow) {
+  CrossvalidationConfiguration crossValidationConfig;
+  crossValidationConfig.kfold_ = 4;
+  crossValidationConfig.parallelFolds_ = 2;
+  DataShufflingFunctorSequential shuffling;
+  DataShufflingFunctorCrossValidation* cvShuffling;
+  DataSourceCrossValidation* dataSource =
+      createDataSource(100, crossValidationConfig, &shuffling, cvShuffling);
+  std::unique_ptr<DataShufflingFunctorCrossValidation> cvShufflingOwner(cvShuffling);
+  ThrowingFitterFactory fitterFactory;
+
+  SparseGridMinerCrossValidation miner(dataSource, fitterFactory.buildFitter(),
+                                       new Scorer(new MSE()));
+  miner.setFitterFactory(&fitterFactory);
+#ifdef _OPENMP
+  const int maxActiveLevels = omp_get_max_active_levels();
+#endif
+
+  // the exception of the failing fold leaves the parallel region and the nesting is restored
+  BOOST_CHECK_THROW(miner.learn(false), application_exception);
+#ifdef _OPENMP
+  BOOST_CHECK_EQUAL(omp_get_max_active_levels(), maxActiveLevels);
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,160 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/KernelDensityTree.hpp>
+#include <sgpp/datadriven/application/KernelDensityEstimator.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::KernelDensityEstimator;
+using sgpp::datadriven::KernelType;
+
+namespace {
+
+void createSamples(size_t numSamples, size_t dim, DataMatrix& samples) {
+  std::mt19937 generator(1234);
+  std::normal_distribution<double> distribution(0.5, 0.15);
+  samples.resize(numSamples, dim);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      samples(i, d) = distribution(generator);
+    }
+  }
+}
+
+/**
+ * Reference implementation: sum of the product kernels, evaluated one by one.
+ */
+double referencePdf(KernelDensityEstimator& kde, DataVector& x) {
+  DataVector bandwidths;
+  DataVector cond;
+  DataVector sample(kde.getDim());
+  kde.getBandwidths(bandwidths);
+  kde.getConditionalizationFactor(cond);
+  sgpp::datadriven::Kernel& kernel = kde.getKernel();
+  double res = 0.0;
+
+  for (size_t i = 0; i < kde.getNsamples(); i++) {
+    kde.getSample(i, sample);
+    double value = cond[i];
+
+    for (size_t d = 0; d < kde.getDim(); d++) {
+      value *= kernel.norm() / bandwidths[d] * kernel.eval((x[d] - sample[d]) / bandwidths[d]);
+    }
+
+    res += value;
+  }
+
+  return res / cond.sum();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestKernelDensityTree)
+
+BOOST_AUTO_TEST_CASE(testTreeEvaluation) {
+  const size_t dim = 3;
+  DataMatrix samples;
+  createSamples(2000, dim, samples);
+  DataMatrix points;
+  createSamples(100, dim, points);
+
+  for (KernelType kernelType : {KernelType::GAUSSIAN, KernelType::EPANECHNIKOV}) {
+    KernelDensityEstimator kde(samples, kernelType);
+    KernelDensityEstimator treeKDE(samples, kernelType);
+    KernelDensityEstimator exactTreeKDE(samples, kernelType);
+    treeKDE.setTreeEvaluation(true, 1e-4);
+    exactTreeKDE.setTreeEvaluation(true, 0.0);
+    BOOST_CHECK(treeKDE.isTreeEvaluation());
+    BOOST_CHECK(!kde.isTreeEvaluation());
+
+    DataVector values;
+    DataVector treeValues;
+    DataVector exactTreeValues;
+    kde.pdf(points, values);
+    treeKDE.pdf(points, treeValues);
+    exactTreeKDE.pdf(points, exactTreeValues);
+    DataVector x(dim);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, x);
+      const double reference = referencePdf(kde, x);
+      BOOST_CHECK_CLOSE(values[i], reference, 1e-10);
+      BOOST_CHECK_CLOSE(kde.pdf(x), reference, 1e-10);
+      BOOST_CHECK_CLOSE(exactTreeValues[i], reference, 1e-10);
+      BOOST_CHECK_LE(std::abs(treeValues[i] - reference), 1e-4 * reference + 1e-300);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLeaveOneOut) {
+  const size_t dim = 2;
+  DataMatrix samples;
+  createSamples(300, dim, samples);
+  KernelDensityEstimator kde(samples);
+
+  // leaving out a sample equals the estimator of the remaining samples with the same bandwidths
+  DataVector bandwidths;
+  kde.getBandwidths(bandwidths);
+  DataMatrix remainingSamples(samples);
+  remainingSamples.resizeRows(samples.getNrows() - 1);
+  KernelDensityEstimator remainingKDE(remainingSamples, KernelType::GAUSSIAN,
+                                      sgpp::datadriven::BandwidthOptimizationType::NONE);
+  remainingKDE.setBandwidths(bandwidths);
+
+  DataVector x(dim);
+  samples.getRow(samples.getNrows() - 1, x);
+  std::vector<size_t> skipElements = {samples.getNrows() - 1};
+  BOOST_CHECK_CLOSE(kde.evalSubset(x, skipElements), remainingKDE.pdf(x), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(testMarginalizationAndConditionalization) {
+  const size_t dim = 3;
+  DataMatrix samples;
+  createSamples(1000, dim, samples);
+  KernelDensityEstimator kde(samples);
+  KernelDensityEstimator treeKDE(samples);
+  treeKDE.setTreeEvaluation(true, 1e-8);
+
+  // marginalized densities inherit the evaluation settings
+  std::unique_ptr<KernelDensityEstimator> marginalizedKDE(treeKDE.marginalize(1));
+  BOOST_CHECK(marginalizedKDE->isTreeEvaluation());
+  BOOST_CHECK_EQUAL(marginalizedKDE->getTreeRelativeError(), 1e-8);
+
+  // conditionalized densities evaluated with the tree use the conditionalization factors
+  DataVector xbar(dim, 0.45);
+  KernelDensityEstimator conditionalizedKDE;
+  KernelDensityEstimator treeConditionalizedKDE;
+  std::unique_ptr<sgpp::datadriven::OperationDensityConditionalKDE> opCond(
+      sgpp::op_factory::createOperationDensityConditionalKDE(kde));
+  std::unique_ptr<sgpp::datadriven::OperationDensityConditionalKDE> treeOpCond(
+      sgpp::op_factory::createOperationDensityConditionalKDE(treeKDE));
+  opCond->condToDimX(0, xbar, conditionalizedKDE);
+  treeOpCond->condToDimX(0, xbar, treeConditionalizedKDE);
+  BOOST_CHECK(treeConditionalizedKDE.isTreeEvaluation());
+
+  DataVector x(1);
+
+  for (double x0 : {0.1, 0.3, 0.5, 0.7}) {
+    x[0] = x0;
+    const double reference = referencePdf(conditionalizedKDE, x);
+    BOOST_CHECK_CLOSE(conditionalizedKDE.pdf(x), reference, 1e-10);
+    BOOST_CHECK_CLOSE(treeConditionalizedKDE.pdf(x), reference, 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/algorithm/SystemMatrixLeastSquaresIdentity.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationLeastSquares.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingLeastSquares.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::FitterConfigurationLeastSquares;
+using sgpp::datadriven::ModelFittingLeastSquares;
+using sgpp::datadriven::SystemMatrixLeastSquaresIdentity;
+
+namespace {
+
+/**
+ * Fills a dataset with quasi-random points (golden ratio sequences starting at offset) and the
+ * values of a smooth function.
+ */
+void createDataset(Dataset& dataset, size_t offset) {
+  for (size_t i = 0; i < dataset.getNumberInstances(); i++) {
+    const double x = std::fmod(0.5 + 0.6180339887 * static_cast<double>(offset + i), 1.0);
+    const double y = std::fmod(0.5 + 0.7548776662 * static_cast<double>(offset + i), 1.0);
+    dataset.getData().set(i, 0, x);
+    dataset.getData().set(i, 1, y);
+    dataset.getTargets()[i] = std::sin(3.0 * x) * std::exp(y) + x * y;
+  }
+}
+
+FitterConfigurationLeastSquares createConfig() {
+  FitterConfigurationLeastSquares config;
+  config.setupDefaults();
+  config.getGridConfig().level_ = 3;
+  config.getRefinementConfig().numRefinements_ = 1;
+  config.getRefinementConfig().noPoints_ = 5;
+  config.getSolverRefineConfig().maxIterations_ = 1000;
+  config.getSolverFinalConfig().maxIterations_ = 1000;
+  config.getRegularizationConfig().lambda_ = 1e-3;
+  return config;
+}
+
+void checkEqualModels(ModelFittingLeastSquares& model, ModelFittingLeastSquares& reference) {
+  Dataset testData(100, 2);
+  createDataset(testData, 10000);
+  DataVector values(testData.getNumberInstances());
+  DataVector referenceValues(testData.getNumberInstances());
+  model.evaluate(testData.getData(), values);
+  reference.evaluate(testData.getData(), referenceValues);
+
+  for (size_t i = 0; i < values.getSize(); i++) {
+    BOOST_CHECK_SMALL(values[i] - referenceValues[i], 1e-8);
+  }
+}
+
+/**
+ * Checks that the surpluses of the model solve the regularized normal equations of the dataset.
+ */
+void checkNormalEquations(ModelFittingLeastSquares& model, Dataset& dataset, double lambda) {
+  SystemMatrixLeastSquaresIdentity systemMatrix(model.getGrid(), dataset.getData(), lambda);
+  DataVector& alpha = model.getSurpluses();
+  DataVector b(alpha.getSize());
+  DataVector residual(alpha.getSize());
+  systemMatrix.generateb(dataset.getTargets(), b);
+  systemMatrix.mult(alpha, residual);
+  residual.sub(b);
+  BOOST_CHECK_SMALL(residual.l2Norm() / b.l2Norm(), 1e-6);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestModelFittingLeastSquares)
+
+BOOST_AUTO_TEST_CASE(testUpdateMatchesBatchFit) {
+  const size_t numInstances1 = 150;
+  const size_t numInstances2 = 250;
+  const size_t numInstances3 = 100;
+  Dataset dataset1(numInstances1, 2);
+  Dataset dataset2(numInstances2, 2);
+  Dataset dataset3(numInstances3, 2);
+  Dataset concatenated(numInstances1 + numInstances2 + numInstances3, 2);
+  createDataset(dataset1, 0);
+  createDataset(dataset2, numInstances1);
+  createDataset(dataset3, numInstances1 + numInstances2);
+  createDataset(concatenated, 0);
+
+  ModelFittingLeastSquares incremental(createConfig());
+  incremental.fit(dataset1);
+  incremental.update(dataset2);
+  incremental.update(dataset3);
+
+  ModelFittingLeastSquares batch(createConfig());
+  batch.fit(concatenated);
+  checkEqualModels(incremental, batch);
+
+  // both refine the same grid points, the system is restricted to the latest dataset
+  BOOST_CHECK(incremental.refine());
+  BOOST_CHECK(batch.refine());
+  BOOST_CHECK_EQUAL(incremental.getGrid().getSize(), batch.getGrid().getSize());
+  checkNormalEquations(incremental, dataset3, createConfig().getRegularizationConfig().lambda_);
+
+  // fit() discards the previous datasets
+  incremental.fit(concatenated);
+  batch.reset();
+  batch.fit(concatenated);
+  checkEqualModels(incremental, batch);
+
+  // with a single dataset, the refined model is fitted to all data
+  BOOST_CHECK(incremental.refine());
+  checkNormalEquations(incremental, concatenated,
+                       createConfig().getRegularizationConfig().lambda_);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
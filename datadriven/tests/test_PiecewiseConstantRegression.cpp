@@ -0,0 +1,179 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/OperationPiecewiseConstantRegression/Tree.hpp>
+
+#include <omp.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::PiecewiseConstantRegression::Tree;
+
+namespace {
+
+/**
+ * Piecewise constant on the boxes of level two in both dimensions.
+ */
+double stepFunction(double x0, double x1) {
+  return std::floor(4.0 * x0) + 10.0 * std::floor(4.0 * x1);
+}
+
+void createDataset(size_t numPoints, DataMatrix& dataset, DataVector& values, size_t seed) {
+  std::mt19937 generator(seed);
+  // avoid the boundaries of the boxes
+  std::uniform_real_distribution<double> distribution(0.01, 0.24);
+  std::uniform_int_distribution<int> box(0, 3);
+  dataset.resize(numPoints, 2);
+  values.resize(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    dataset(i, 0) = 0.25 * box(generator) + distribution(generator);
+    dataset(i, 1) = 0.25 * box(generator) + distribution(generator);
+    values[i] = stepFunction(dataset(i, 0), dataset(i, 1));
+  }
+}
+
+/**
+ * Quasi-random points (golden ratio sequences) and the values of a smooth function, more points
+ * than a thread processes at once.
+ */
+void createSmoothDataset(DataMatrix& dataset, DataVector& values) {
+  const size_t numPoints = 20000;
+  dataset.resize(numPoints, 2);
+  values.resize(numPoints);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    const double x0 = std::fmod(0.5 + 0.6180339887 * static_cast<double>(i), 1.0);
+    const double x1 = std::fmod(0.5 + 0.7548776662 * static_cast<double>(i), 1.0);
+    dataset(i, 0) = x0;
+    dataset(i, 1) = x1;
+    values[i] = std::sin(3.0 * x0) * std::exp(x1) + x0 * x1;
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPiecewiseConstantRegression)
+
+BOOST_AUTO_TEST_CASE(testStepFunction) {
+  DataMatrix dataset;
+  DataVector values;
+  createDataset(1000, dataset, values, 7);
+
+  // four levels resolve the boxes of level two in both dimensions
+  Tree tree(dataset, values, 1e-12, 4);
+  BOOST_CHECK_EQUAL(tree.getHierarchizationMaxLevel(), 4);
+  BOOST_CHECK_SMALL(tree.getMSE(), 1e-16);
+
+  // too few levels can't resolve the function
+  Tree coarseTree(dataset, values, 1e-12, 3);
+  BOOST_CHECK_GT(coarseTree.getMSE(), 1.0);
+
+  // batched evaluation equals the evaluation point by point
+  DataMatrix points;
+  DataVector pointValues;
+  createDataset(200, points, pointValues, 8);
+  DataVector result;
+  tree.evaluate(points, result);
+  BOOST_CHECK_EQUAL(result.getSize(), points.getNrows());
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    std::vector<double> point;
+    points.getRow(i, point);
+    BOOST_CHECK_EQUAL(result[i], tree.evaluate(point));
+    BOOST_CHECK_SMALL(result[i] - pointValues[i], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testConstantIntegration) {
+  DataMatrix dataset;
+  DataVector values;
+  createDataset(100, dataset, values, 7);
+  values.setAll(2.0);
+
+  // a constant function is represented by the root
+  Tree tree(dataset, values, 0.0, 10);
+  BOOST_CHECK_EQUAL(tree.getChildCount(), 0);
+
+  // scalar products with the hat functions (the integral of a hat function of level l is 2^-l)
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    size_t integratedNodes;
+    const double reference =
+        2.0 * std::pow(0.5, static_cast<double>(storage.getPoint(i).getLevelSum()));
+    BOOST_CHECK_CLOSE(tree.integrate(storage.getPoint(i), integratedNodes), reference, 1e-10);
+    BOOST_CHECK_EQUAL(integratedNodes, 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRegression) {
+  DataMatrix dataset;
+  DataVector values;
+  createSmoothDataset(dataset, values);
+
+  // reference values of the recursive implementation
+  const std::vector<std::vector<double>> points = {
+      {0.1, 0.2}, {0.3, 0.9}, {0.55, 0.45}, {0.8, 0.15}, {0.95, 0.7}};
+  const std::vector<double> referenceValues = {0.36413654711050336, 2.0957625594284153,
+                                               1.8458767707272541, 0.9590906199884377,
+                                               1.1747324789274751};
+  const std::vector<double> referenceIntegrals = {0.40834287599026264, 0.15210057909990543,
+                                                  0.2026464150193793, 0.14820070090966966,
+                                                  0.26547703289974334};
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(2);
+  sgpp::base::GridStorage& storage = grid->getStorage();
+  BOOST_REQUIRE_EQUAL(storage.getSize(), referenceIntegrals.size());
+
+  const int maxThreads = omp_get_max_threads();
+  DataVector firstResult;
+
+  // the tree doesn't depend on the number of threads
+  for (int numThreads : {1, 2, 4}) {
+    omp_set_num_threads(numThreads);
+    Tree tree(dataset, values, 1e-3, 8);
+    BOOST_CHECK_EQUAL(tree.getHierarchizationMaxLevel(), 8);
+
+    for (size_t i = 0; i < points.size(); i++) {
+      std::vector<double> point = points[i];
+      BOOST_CHECK_CLOSE(tree.evaluate(point), referenceValues[i], 1e-10);
+    }
+
+    for (size_t i = 0; i < storage.getSize(); i++) {
+      size_t integratedNodes;
+      BOOST_CHECK_CLOSE(tree.integrate(storage.getPoint(i), integratedNodes),
+                        referenceIntegrals[i], 1e-10);
+    }
+
+    DataVector result;
+    tree.evaluate(dataset, result);
+
+    if (firstResult.getSize() == 0) {
+      firstResult = result;
+    } else {
+      for (size_t i = 0; i < result.getSize(); i++) {
+        BOOST_CHECK_EQUAL(result[i], firstResult[i]);
+      }
+    }
+  }
+
+  omp_set_num_threads(maxThreads);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
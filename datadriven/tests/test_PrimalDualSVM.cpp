@@ -0,0 +1,216 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/application/PrimalDualSVM.hpp>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::PrimalDualSVM;
+using sgpp::datadriven::SVMBudgetMaintenance;
+
+namespace {
+
+void createPoints(size_t numPoints, size_t dim, DataMatrix& points) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  points.resize(numPoints, dim);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      points(i, d) = distribution(generator);
+    }
+  }
+}
+
+/**
+ * Checks that the normal vectors equal the weighted sums of the transformed support vectors.
+ */
+void checkNormalVectors(Grid& grid, PrimalDualSVM& svm) {
+  std::unique_ptr<sgpp::base::OperationMultipleEval> multEval(
+      sgpp::op_factory::createOperationMultipleEval(grid, svm.svs));
+  DataVector absAlphas(svm.alphas.getSize());
+
+  for (size_t i = 0; i < absAlphas.getSize(); i++) {
+    absAlphas[i] = std::abs(svm.alphas[i]);
+  }
+
+  DataVector w(grid.getSize());
+  DataVector w2(grid.getSize());
+  multEval->multTranspose(svm.alphas, w);
+  multEval->multTranspose(absAlphas, w2);
+
+  for (size_t i = 0; i < grid.getSize(); i++) {
+    BOOST_CHECK_SMALL(svm.w[i] - w[i], 1e-10);
+    BOOST_CHECK_SMALL(svm.w2[i] - w2[i], 1e-10);
+  }
+}
+
+/**
+ * Adds the points with the given weights to the SVM.
+ */
+void addPoints(Grid& grid, PrimalDualSVM& svm, DataMatrix& points, const DataVector& alphas) {
+  DataVector x(points.getNcols());
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    points.getRow(i, x);
+    svm.add(grid, x, alphas[i], points.getNcols());
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPrimalDualSVM)
+
+BOOST_AUTO_TEST_CASE(testBudgetMaintenance) {
+  const size_t dim = 2;
+  const size_t budget = 10;
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataMatrix points;
+  createPoints(50, dim, points);
+  DataMatrix queries;
+  createPoints(20, dim, queries);
+
+  for (SVMBudgetMaintenance budgetMaintenance :
+       {SVMBudgetMaintenance::Discard, SVMBudgetMaintenance::Removal,
+        SVMBudgetMaintenance::Merge}) {
+    PrimalDualSVM svm(grid->getSize(), dim, budget, true, budgetMaintenance);
+    DataVector x(dim);
+
+    for (size_t i = 0; i < points.getNrows(); i++) {
+      points.getRow(i, x);
+      // labels depend on the first coordinate
+      const double alpha = ((x[0] < 0.5) ? -1.0 : 1.0) * (1.0 + static_cast<double>(i % 7));
+      svm.add(*grid, x, alpha, dim);
+      BOOST_CHECK_LE(svm.svs.getNrows(), budget);
+      BOOST_CHECK_EQUAL(svm.alphas.getSize(), svm.svs.getNrows());
+      BOOST_CHECK_EQUAL(svm.norms.getSize(), svm.svs.getNrows());
+    }
+
+    BOOST_CHECK_EQUAL(svm.svs.getNrows(), budget);
+    checkNormalVectors(*grid, svm);
+
+    // batched predictions equal the single ones
+    DataVector predictions;
+    svm.predictRaw(*grid, queries, predictions);
+    BOOST_CHECK_EQUAL(predictions.getSize(), queries.getNrows());
+
+    for (size_t i = 0; i < queries.getNrows(); i++) {
+      queries.getRow(i, x);
+      BOOST_CHECK_CLOSE(predictions[i], svm.predictRaw(*grid, x, dim), 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRemove) {
+  const size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(2);
+  DataMatrix points;
+  createPoints(4, dim, points);
+  PrimalDualSVM svm(grid->getSize(), dim, 4, false);
+  DataVector x(dim);
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    points.getRow(i, x);
+    svm.add(*grid, x, static_cast<double>(i + 1), dim);
+  }
+
+  // the last support vector takes the place of the removed one
+  svm.remove(*grid, 1, dim);
+  BOOST_CHECK_EQUAL(svm.svs.getNrows(), 3);
+  BOOST_CHECK_EQUAL(svm.alphas[1], 4.0);
+  BOOST_CHECK_EQUAL(svm.svs.get(1, 0), points.get(3, 0));
+  BOOST_CHECK_EQUAL(svm.svs.get(1, 1), points.get(3, 1));
+  checkNormalVectors(*grid, svm);
+
+  // with bias, the predictions equal the ones of an SVM with only the remaining support vectors
+  PrimalDualSVM svmBias(grid->getSize(), dim, 4, true);
+  PrimalDualSVM svmRemaining(grid->getSize(), dim, 4, true);
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    points.getRow(i, x);
+    svmBias.add(*grid, x, static_cast<double>(i + 1), dim);
+
+    if (i != 1) {
+      svmRemaining.add(*grid, x, static_cast<double>(i + 1), dim);
+    }
+  }
+
+  svmBias.remove(*grid, 1, dim);
+
+  for (size_t i = 0; i < points.getNrows(); i++) {
+    points.getRow(i, x);
+    BOOST_CHECK_CLOSE(svmBias.predictRaw(*grid, x, dim), svmRemaining.predictRaw(*grid, x, dim),
+                      1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRemovalEvictsSmallest) {
+  const size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataMatrix points;
+  createPoints(4, dim, points);
+  PrimalDualSVM svm(grid->getSize(), dim, 3, false, SVMBudgetMaintenance::Removal);
+  DataVector alphas(std::vector<double>{2.0, -0.5, 3.0, 1.5});
+  addPoints(*grid, svm, points, alphas);
+
+  // the second vector is evicted, the last one takes its place
+  BOOST_CHECK_EQUAL(svm.svs.getNrows(), 3);
+  const size_t expectedRows[] = {0, 3, 2};
+
+  for (size_t i = 0; i < 3; i++) {
+    BOOST_CHECK_EQUAL(svm.alphas[i], alphas[expectedRows[i]]);
+
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_EQUAL(svm.svs.get(i, d), points.get(expectedRows[i], d));
+    }
+  }
+
+  checkNormalVectors(*grid, svm);
+}
+
+BOOST_AUTO_TEST_CASE(testMergeSmallest) {
+  const size_t dim = 2;
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataMatrix points;
+  createPoints(4, dim, points);
+  PrimalDualSVM svm(grid->getSize(), dim, 3, false, SVMBudgetMaintenance::Merge);
+  DataVector alphas(std::vector<double>{2.0, 0.5, -3.0, 1.0});
+  addPoints(*grid, svm, points, alphas);
+
+  // the second and the last vector are merged into the place of the second one
+  BOOST_CHECK_EQUAL(svm.svs.getNrows(), 3);
+  BOOST_CHECK_EQUAL(svm.alphas[0], 2.0);
+  BOOST_CHECK_EQUAL(svm.alphas[1], 1.5);
+  BOOST_CHECK_EQUAL(svm.alphas[2], -3.0);
+
+  for (size_t d = 0; d < dim; d++) {
+    BOOST_CHECK_EQUAL(svm.svs.get(0, d), points.get(0, d));
+    BOOST_CHECK_CLOSE(svm.svs.get(1, d), (0.5 * points.get(1, d) + points.get(3, d)) / 1.5,
+                      1e-12);
+    BOOST_CHECK_EQUAL(svm.svs.get(2, d), points.get(2, d));
+  }
+
+  checkNormalVectors(*grid, svm);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,207 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/algorithm/SparseSGDUpdater.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::datadriven::SparseSGDUpdater;
+
+namespace {
+
+/**
+ * Reference implementation of the averaged SGD steps with dense vectors
+ * (as formerly done by LearnerSGD).
+ */
+void denseUpdate(Grid& grid, const DataMatrix& data, const DataVector& labels, size_t begin,
+                 size_t end, double gamma, double lambda, double mu, DataVector& alpha,
+                 DataVector& alphaAvg) {
+  DataVector step(alpha.getSize(), 0.0);
+  DataVector x(data.getNcols());
+  DataVector delta(alpha.getSize());
+  DataVector singleAlpha(1, 1.0);
+
+  for (size_t i = begin; i < end; i++) {
+    data.getRow(i, x);
+    DataMatrix dm(x.getPointer(), 1, x.getSize());
+    std::unique_ptr<sgpp::base::OperationMultipleEval> multEval(
+        sgpp::op_factory::createOperationMultipleEval(grid, dm));
+    multEval->multTranspose(singleAlpha, delta);
+    const double residual = delta.dotProduct(alpha) - labels[i];
+    step.axpy(-gamma * residual / static_cast<double>(end - begin), delta);
+  }
+
+  alpha.mult(1.0 - gamma * lambda);
+  alpha.add(step);
+  alphaAvg.mult(1.0 - mu);
+  alphaAvg.axpy(mu, alpha);
+}
+
+void createData(size_t numData, size_t dim, DataMatrix& data, DataVector& labels) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  data.resize(numData, dim);
+  labels.resize(numData);
+
+  for (size_t i = 0; i < numData; i++) {
+    double value = 0.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      data(i, d) = distribution(generator);
+      value += std::sin(3.0 * data(i, d));
+    }
+
+    labels[i] = (value > 0.5 * static_cast<double>(dim)) ? 1.0 : -1.0;
+  }
+}
+
+double maxDifference(const DataVector& x, const DataVector& y) {
+  DataVector difference(x);
+  difference.sub(y);
+  return difference.maxNorm();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestSparseSGDUpdater)
+
+BOOST_AUTO_TEST_CASE(testDenseEquivalence) {
+  const size_t dim = 3;
+  const size_t numData = 200;
+  const double gamma = 0.05;
+  const double lambda = 1e-3;
+  DataMatrix data;
+  DataVector labels;
+  createData(numData, dim, data, labels);
+
+  std::unique_ptr<Grid> linearGrid(Grid::createLinearGrid(dim));
+  std::unique_ptr<Grid> modLinearGrid(Grid::createModLinearGrid(dim));
+
+  for (Grid* grid : {linearGrid.get(), modLinearGrid.get()}) {
+    grid->getGenerator().regular(4);
+
+    for (size_t miniBatchSize : {1, 7}) {
+      SparseSGDUpdater updater(*grid);
+      DataVector alpha(grid->getSize(), 0.0);
+      DataVector alphaAvg(grid->getSize(), 0.0);
+      DataVector sparseAlpha;
+      DataVector sparseAlphaAvg;
+
+      // a constant averaging weight lets the scale factors grow exponentially, so that they
+      // are renormalized during the passes
+      for (size_t pass = 0; pass < 3; pass++) {
+        for (size_t i = 0; i < numData; i += miniBatchSize) {
+          const size_t end = std::min(i + miniBatchSize, numData);
+          const double t = static_cast<double>(pass * numData + i) + 1.0;
+          const double currentGamma = gamma * std::pow(1.0 + gamma * lambda * t, -0.75);
+          const double mu = (t < 20.0) ? 1.0 : 0.05;
+
+          denseUpdate(*grid, data, labels, i, end, currentGamma, lambda, mu, alpha, alphaAvg);
+          updater.update(data, labels, i, end, currentGamma, lambda, mu);
+        }
+      }
+
+      updater.getAlpha(sparseAlpha);
+      updater.getAlphaAvg(sparseAlphaAvg);
+      BOOST_CHECK_SMALL(maxDifference(alpha, sparseAlpha), 1e-10);
+      BOOST_CHECK_SMALL(maxDifference(alphaAvg, sparseAlphaAvg), 1e-10);
+
+      // evaluation of the current model
+      DataVector x(dim);
+      data.getRow(0, x);
+      std::unique_ptr<sgpp::base::OperationEval> opEval(
+          sgpp::op_factory::createOperationEval(*grid));
+      BOOST_CHECK_CLOSE(updater.eval(x), opEval->eval(alpha, x), 1e-8);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testResizeAndHogwild) {
+  const size_t dim = 2;
+  const size_t numData = 100;
+  DataMatrix data;
+  DataVector labels;
+  createData(numData, dim, data, labels);
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  SparseSGDUpdater updater(*grid);
+  updater.update(data, labels, 0, numData / 2, 0.1, 1e-2, 0.5);
+
+  DataVector alphaBefore;
+  DataVector alphaAvgBefore;
+  updater.getAlpha(alphaBefore);
+  updater.getAlphaAvg(alphaAvgBefore);
+
+  // new coefficients are zero, existing ones are kept
+  const size_t oldSize = grid->getSize();
+  sgpp::base::SurplusRefinementFunctor functor(alphaBefore, 5);
+  grid->getGenerator().refine(functor);
+  BOOST_REQUIRE_GT(grid->getSize(), oldSize);
+  updater.resize(grid->getSize());
+
+  DataVector alpha;
+  DataVector alphaAvg;
+  updater.getAlpha(alpha);
+  updater.getAlphaAvg(alphaAvg);
+  BOOST_REQUIRE_EQUAL(alpha.getSize(), grid->getSize());
+
+  for (size_t i = 0; i < grid->getSize(); i++) {
+    BOOST_CHECK_CLOSE(alpha[i], (i < oldSize) ? alphaBefore[i] : 0.0, 1e-12);
+    BOOST_CHECK_CLOSE(alphaAvg[i], (i < oldSize) ? alphaAvgBefore[i] : 0.0, 1e-12);
+  }
+
+  // Hogwild steps agree with the sequential ones for a mini-batch of size one
+  SparseSGDUpdater hogwildUpdater(*grid);
+  SparseSGDUpdater sequentialUpdater(*grid);
+  hogwildUpdater.setHogwild(true);
+  BOOST_CHECK(hogwildUpdater.isHogwild());
+
+  for (size_t i = 0; i < numData; i++) {
+    hogwildUpdater.update(data, labels, i, i + 1, 0.1, 1e-2, 0.1);
+    sequentialUpdater.update(data, labels, i, i + 1, 0.1, 1e-2, 0.1);
+  }
+
+  DataVector hogwildAlpha;
+  hogwildUpdater.getAlphaAvg(hogwildAlpha);
+  sequentialUpdater.getAlphaAvg(alpha);
+  BOOST_CHECK_SMALL(maxDifference(hogwildAlpha, alpha), 1e-12);
+
+  // Hogwild steps with larger mini-batches reduce the training error
+  hogwildUpdater.update(data, labels, 0, numData, 0.1, 1e-2, 1.0);
+  double error = 0.0;
+  DataVector x(dim);
+
+  for (size_t i = 0; i < numData; i++) {
+    data.getRow(i, x);
+    error += std::pow(hogwildUpdater.eval(x) - labels[i], 2);
+  }
+
+  BOOST_CHECK_LT(error / static_cast<double>(numData), 1.0);
+}
+
+BOOST_AUTO_TEST_CASE(testUnsupportedGrid) {
+  std::unique_ptr<Grid> grid(Grid::createPolyGrid(2, 3));
+  grid->getGenerator().regular(2);
+  BOOST_CHECK_THROW(SparseSGDUpdater updater(*grid), sgpp::base::application_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,169 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/Accuracy.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/MSE.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/NegativeLogLikelihood.hpp>
+#include <sgpp/datadriven/datamining/modules/scoring/Scorer.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::Accuracy;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::Metric;
+using sgpp::datadriven::ModelFittingBase;
+using sgpp::datadriven::MSE;
+using sgpp::datadriven::NegativeLogLikelihood;
+using sgpp::datadriven::Scorer;
+
+namespace {
+
+/**
+ * Model whose prediction is the first coordinate, records the sizes of the evaluated chunks.
+ */
+class FirstCoordinateModel : public ModelFittingBase {
+ public:
+  void fit(Dataset& /*dataset*/) override {}
+
+  bool refine() override { return false; }
+
+  void update(Dataset& /*dataset*/) override {}
+
+  double evaluate(const DataVector& sample) override { return sample[0]; }
+
+  void evaluate(DataMatrix& samples, DataVector& results) override {
+    BOOST_REQUIRE_EQUAL(results.getSize(), samples.getNrows());
+    chunkSizes.push_back(samples.getNrows());
+
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      results[i] = samples.get(i, 0);
+    }
+  }
+
+  void reset() override { chunkSizes.clear(); }
+
+  std::vector<size_t> chunkSizes;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestStreamingMetrics)
+
+BOOST_AUTO_TEST_CASE(testChunkedAccumulation) {
+  const size_t numInstances = 1000;
+  std::mt19937 generator(3);
+  std::uniform_int_distribution<int> classes(0, 2);
+  DataVector predictedValues(numInstances);
+  DataVector trueValues(numInstances);
+
+  for (size_t i = 0; i < numInstances; i++) {
+    predictedValues[i] = static_cast<double>(classes(generator)) + 0.5;
+    trueValues[i] = static_cast<double>(classes(generator)) + 0.5;
+  }
+
+  std::vector<std::unique_ptr<Metric>> metrics;
+  metrics.emplace_back(new MSE());
+  metrics.emplace_back(new Accuracy());
+  metrics.emplace_back(new NegativeLogLikelihood());
+
+  for (auto& metric : metrics) {
+    // chunks of different sizes give the score of the whole dataset
+    for (size_t chunkSize : {1, 7, 100, 1000}) {
+      double accumulated = 0.0;
+
+      for (size_t begin = 0; begin < numInstances; begin += chunkSize) {
+        const size_t count = std::min(chunkSize, numInstances - begin);
+        accumulated += metric->accumulate(predictedValues.getPointer() + begin,
+                                          trueValues.getPointer() + begin, count);
+      }
+
+      BOOST_CHECK_CLOSE(metric->finalize(accumulated, numInstances),
+                        metric->measure(predictedValues, trueValues), 1e-10);
+    }
+  }
+
+  // reference values
+  size_t correct = 0;
+  double squaredError = 0.0;
+
+  for (size_t i = 0; i < numInstances; i++) {
+    correct += (predictedValues[i] == trueValues[i]) ? 1 : 0;
+    squaredError += (predictedValues[i] - trueValues[i]) * (predictedValues[i] - trueValues[i]);
+  }
+
+  BOOST_CHECK_CLOSE(Accuracy().measure(predictedValues, trueValues),
+                    static_cast<double>(correct) / static_cast<double>(numInstances), 1e-10);
+  BOOST_CHECK_CLOSE(MSE().measure(predictedValues, trueValues),
+                    squaredError / static_cast<double>(numInstances), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(testDatasetSubset) {
+  Dataset dataset(10, 2);
+
+  for (size_t i = 0; i < 10; i++) {
+    dataset.getData().set(i, 0, static_cast<double>(i));
+    dataset.getData().set(i, 1, static_cast<double>(10 * i));
+    dataset.getTargets()[i] = static_cast<double>(100 * i);
+  }
+
+  std::vector<size_t> indices = {9, 2, 5, 0};
+  std::unique_ptr<Dataset> subset(dataset.getSubset(indices, 1, 4));
+  BOOST_CHECK_EQUAL(subset->getNumberInstances(), 3);
+  BOOST_CHECK_EQUAL(subset->getDimension(), 2);
+
+  for (size_t i = 0; i < 3; i++) {
+    BOOST_CHECK_EQUAL(subset->getData().get(i, 0), static_cast<double>(indices[i + 1]));
+    BOOST_CHECK_EQUAL(subset->getData().get(i, 1), static_cast<double>(10 * indices[i + 1]));
+    BOOST_CHECK_EQUAL(subset->getTargets()[i], static_cast<double>(100 * indices[i + 1]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testScorerChunks) {
+  const size_t numInstances = 100;
+  Dataset dataset(numInstances, 2);
+  DataVector predictedValues(numInstances);
+
+  for (size_t i = 0; i < numInstances; i++) {
+    predictedValues[i] = std::sin(static_cast<double>(i));
+    dataset.getData().set(i, 0, predictedValues[i]);
+    dataset.getData().set(i, 1, static_cast<double>(i));
+    dataset.getTargets()[i] = std::cos(static_cast<double>(i));
+  }
+
+  const double reference = MSE().measure(predictedValues, dataset.getTargets());
+  FirstCoordinateModel model;
+
+  // the last chunk is smaller than the others, so the chunk buffers are shrunk
+  Scorer chunkedScorer(new MSE(), 30);
+  BOOST_CHECK_CLOSE(chunkedScorer.test(model, dataset), reference, 1e-10);
+  BOOST_CHECK(model.chunkSizes == std::vector<size_t>({30, 30, 30, 10}));
+
+  // chunks which divide the dataset
+  model.reset();
+  Scorer evenScorer(new MSE(), 25);
+  BOOST_CHECK_CLOSE(evenScorer.test(model, dataset), reference, 1e-10);
+  BOOST_CHECK(model.chunkSizes == std::vector<size_t>({25, 25, 25, 25}));
+
+  // the whole dataset at once
+  model.reset();
+  Scorer scorer(new MSE());
+  BOOST_CHECK_CLOSE(scorer.test(model, dataset), reference, 1e-10);
+  BOOST_CHECK(model.chunkSizes == std::vector<size_t>({numInstances}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -365,6 +365,7 @@ const bool UMFPACK_ENABLED;
 %include "optimization/src/sgpp/optimization/sle/solver/Eigen.hpp"
 %include "optimization/src/sgpp/optimization/sle/solver/GaussianElimination.hpp"
 %include "optimization/src/sgpp/optimization/sle/solver/Gmmpp.hpp"
+%include "optimization/src/sgpp/optimization/sle/solver/LUDecomposition.hpp"
 %include "optimization/src/sgpp/optimization/sle/solver/UMFPACK.hpp"
 
 %include "optimization/src/sgpp/optimization/optimizer/unconstrained/UnconstrainedOptimizer.hpp"
@@ -0,0 +1,37 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/optimization/function/scalar/InterpolantScalarFunction.hpp>
+
+#include <memory>
+
+namespace sgpp {
+namespace optimization {
+
+void InterpolantScalarFunction::evalBatch(const base::DataMatrix& x, base::DataVector& value) {
+  evalBatchInDomain(x, value, [this](const base::DataMatrix& points,
+                                     base::DataVector& pointValues) {
+    // the operation takes the points by non-const reference
+    base::DataMatrix dataset(points);
+    std::unique_ptr<base::OperationMultipleEval> opMultipleEval;
+
+    try {
+      opMultipleEval.reset(op_factory::createOperationMultipleEval(grid, dataset));
+    } catch (const base::factory_exception&) {
+      // grid type not supported, e.g., B-splines
+    }
+
+    if (opMultipleEval != nullptr) {
+      opMultipleEval->mult(alpha, pointValues);
+    } else {
+      ScalarFunction::evalBatch(points, pointValues);
+    }
+  });
+}
+}  // namespace optimization
+}  // namespace sgpp
@@ -70,6 +70,20 @@ class InterpolantScalarFunction : public ScalarFunction {
     return opEval->eval(alpha, x);
   }
 
+  /**
+   * Evaluation of the function at multiple points.
+   * If the grid type is supported by base::OperationMultipleEval,
+   * all points in the domain are evaluated by one operation.
+   * Otherwise, the points are evaluated in parallel by
+   * ScalarFunction::evalBatch.
+   * Points outside of \f$[0, 1]^d\f$ yield \f$\infty\f$
+   * as in eval().
+   *
+   * @param      x      matrix whose rows are the evaluation points
+   * @param[out] value  vector of function values
+   */
+  void evalBatch(const base::DataMatrix& x, base::DataVector& value) override;
+
   /**
    * @param[out] clone pointer to cloned object
    */
@@ -0,0 +1,99 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+void ScalarFunction::evalBatch(const base::DataMatrix& x, base::DataVector& value) {
+  const size_t numberOfPoints = x.getNrows();
+  value.resize(numberOfPoints);
+
+  if (numberOfPoints == 0) {
+    return;
+  }
+
+#pragma omp parallel shared(x, value)
+  {
+    base::DataVector curX(d);
+    ScalarFunction* curFPtr = this;
+#ifdef _OPENMP
+    std::unique_ptr<ScalarFunction> curF;
+
+    if (omp_get_num_threads() > 1) {
+      clone(curF);
+      curFPtr = curF.get();
+    }
+
+#endif /* _OPENMP */
+
+#pragma omp for schedule(dynamic)
+
+    for (size_t k = 0; k < numberOfPoints; k++) {
+      x.getRow(k, curX);
+      value[k] = curFPtr->eval(curX);
+    }
+  }
+}
+
+void ScalarFunction::evalBatchInDomain(
+    const base::DataMatrix& x, base::DataVector& value,
+    const std::function<void(const base::DataMatrix&, base::DataVector&)>& evalBatchInDomain) {
+  const size_t numberOfPoints = x.getNrows();
+  const size_t d = x.getNcols();
+  std::vector<size_t> inDomainIndices;
+
+  value.resize(numberOfPoints);
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    bool inDomain = true;
+
+    for (size_t t = 0; t < d; t++) {
+      if ((x(k, t) < 0.0) || (x(k, t) > 1.0)) {
+        inDomain = false;
+        break;
+      }
+    }
+
+    if (inDomain) {
+      inDomainIndices.push_back(k);
+    } else {
+      value[k] = INFINITY;
+    }
+  }
+
+  if (inDomainIndices.empty()) {
+    return;
+  } else if (inDomainIndices.size() == numberOfPoints) {
+    evalBatchInDomain(x, value);
+    return;
+  }
+
+  base::DataMatrix inDomainX(inDomainIndices.size(), d);
+  base::DataVector inDomainValue(inDomainIndices.size());
+
+  for (size_t i = 0; i < inDomainIndices.size(); i++) {
+    for (size_t t = 0; t < d; t++) {
+      inDomainX(i, t) = x(inDomainIndices[i], t);
+    }
+  }
+
+  evalBatchInDomain(inDomainX, inDomainValue);
+
+  for (size_t i = 0; i < inDomainIndices.size(); i++) {
+    value[inDomainIndices[i]] = inDomainValue[i];
+  }
+}
+}  // namespace optimization
+}  // namespace sgpp
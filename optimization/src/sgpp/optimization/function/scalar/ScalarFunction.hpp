@@ -7,9 +7,11 @@
 #define SGPP_OPTIMIZATION_FUNCTION_SCALAR_SCALARFUNCTION_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
+#include <functional>
 #include <memory>
 
 namespace sgpp {
@@ -42,6 +44,34 @@ class ScalarFunction {
    */
   virtual double eval(const base::DataVector& x) = 0;
 
+  /**
+   * Evaluation of the function at multiple points.
+   * The default implementation distributes the points to OpenMP threads,
+   * each of which evaluates a clone of the function.
+   * Implementations may override this to evaluate all points at once
+   * (e.g., by one sparse grid operation for interpolants).
+   * The result must not depend on the number of threads.
+   *
+   * @param      x      matrix whose rows are the evaluation points
+   *                    \f$\vec{x}_k \in [0, 1]^d\f$
+   * @param[out] value  vector of function values \f$f(\vec{x}_k)\f$
+   */
+  virtual void evalBatch(const base::DataMatrix& x, base::DataVector& value);
+
+  /**
+   * Evaluates a function at multiple points, of which only those in
+   * \f$[0, 1]^d\f$ are passed to the given batch evaluation.
+   * The other points get the value \f$\infty\f$.
+   * If all points are in the domain, \f$x\f$ is passed without copying.
+   *
+   * @param      x                  matrix whose rows are the evaluation points
+   * @param[out] value              vector of function values
+   * @param      evalBatchInDomain  batch evaluation for points in the domain
+   */
+  static void evalBatchInDomain(
+      const base::DataMatrix& x, base::DataVector& value,
+      const std::function<void(const base::DataMatrix&, base::DataVector&)>& evalBatchInDomain);
+
   /**
    * @return dimension \f$d\f$ of the domain
    */
@@ -10,6 +10,9 @@
 
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace sgpp {
 namespace optimization {
 
@@ -109,6 +112,21 @@ class HashRefinementMultiple : public base::HashRefinement {
     }
   }
 
+  /**
+   * Refines the given grid points directly, i.e., without examining
+   * the indicator values of all grid points as free_refine() does.
+   * The points are refined in the given order, new points are
+   * appended to the storage.
+   *
+   * @param storage   grid storage
+   * @param indices   indices of the grid points to be refined
+   */
+  void refineGridpoints(base::GridStorage& storage, const std::vector<size_t>& indices) {
+    for (size_t i : indices) {
+      refineGridpoint(storage, i);
+    }
+  }
+
  protected:
   /**
    * Examine the grid points and stores the indices those that can be
@@ -125,16 +143,18 @@ class HashRefinementMultiple : public base::HashRefinement {
       base::GridStorage& storage,
       base::RefinementFunctor& functor,
       base::AbstractRefinement::refinement_container_type& collection) override {
-    size_t refinements_num = functor.getRefinementsNum();
-
-    // max value equals min value
-    base::GridStorage::grid_map_iterator end_iter = storage.end();
-
-    // start iterating over whole grid
-    for (base::GridStorage::grid_map_iterator iter = storage.begin(); iter != end_iter; iter++) {
-      AbstractRefinement::refinement_list_type current_value_list =
-          getIndicator(storage, iter, functor);
-      addElementToCollection(iter, current_value_list, refinements_num, collection);
+    // every grid point is a candidate
+    std::vector<refinement_candidate_type> candidates = collectCandidates(
+        storage, functor, functor.getRefinementsNum(),
+        [&storage, &functor](base::GridPoint& point, size_t seq,
+                             refinement_candidate_heap_type& heap) {
+          heap.push(seq, 0, functor(storage, seq));
+        });
+
+    for (const refinement_candidate_type& candidate : candidates) {
+      collection.emplace_back(
+          std::make_shared<refinement_key_type>(storage.getPoint(candidate.seq), candidate.seq),
+          candidate.value);
     }
   }
 };
@@ -3,10 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGenerator.hpp>
 
@@ -38,33 +34,23 @@ void IterativeGridGenerator::evalFunction(size_t oldGridSize) {
   const size_t curGridSize = gridStorage.getSize();
   base::DataVector& fX = functionValues;
 
-#pragma omp parallel shared(fX, oldGridSize, gridStorage) default(none)
-  {
-    base::DataVector x(d);
-    ScalarFunction* curFPtr = &f;
-#ifdef _OPENMP
-    std::unique_ptr<ScalarFunction> curF;
-
-    if (omp_get_max_threads() > 1) {
-      f.clone(curF);
-      curFPtr = curF.get();
-    }
-
-#endif /* _OPENMP */
+  // collect the new grid points to evaluate them at once
+  base::DataMatrix x(curGridSize - oldGridSize, d);
+  base::DataVector fxNew(curGridSize - oldGridSize);
 
-#pragma omp for
+  for (size_t i = oldGridSize; i < curGridSize; i++) {
+    // convert grid point to coordinate vector
+    const base::GridPoint& gp = gridStorage[i];
 
-    for (size_t i = oldGridSize; i < curGridSize; i++) {
-      // convert grid point to coordinate vector
-      const base::GridPoint& gp = gridStorage[i];
+    for (size_t t = 0; t < d; t++) {
+      x(i - oldGridSize, t) = gridStorage.getCoordinate(gp, t);
+    }
+  }
 
-      for (size_t t = 0; t < d; t++) {
-        x[t] = gridStorage.getCoordinate(gp, t);
-      }
+  f.evalBatch(x, fxNew);
 
-      const double fx = curFPtr->eval(x);
-      fX[i] = fx;
-    }
+  for (size_t i = oldGridSize; i < curGridSize; i++) {
+    fX[i] = fxNew[i - oldGridSize];
   }
 }
 }  // namespace optimization
@@ -77,6 +77,7 @@ class IterativeGridGenerator {
    * Evaluates the objective function at grid points with indices
    * [oldGridSize, oldGridSize + 1, ..., grid.getSize() - 1]
    * and saves values in functionValues.
+   * The points are evaluated with one call of ScalarFunction::evalBatch.
    *
    * @param oldGridSize   number of grid points already evaluated
    */
@@ -8,12 +8,14 @@
 #include <sgpp/optimization/gridgen/IterativeGridGeneratorRitterNovak.hpp>
 #include <sgpp/optimization/gridgen/HashRefinementMultiple.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
-#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <algorithm>
+#include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -41,12 +43,13 @@ inline double fastPow(double a, double b) {
 
 IterativeGridGeneratorRitterNovak::IterativeGridGeneratorRitterNovak(
     ScalarFunction& f, base::Grid& grid, size_t N, double adaptivity, base::level_t initialLevel,
-    base::level_t maxLevel, PowMethod powMethod)
+    base::level_t maxLevel, PowMethod powMethod, size_t batchSize)
     : IterativeGridGenerator(f, grid, N),
       gamma(adaptivity),
       initialLevel(initialLevel),
       maxLevel(maxLevel),
-      powMethod(powMethod) {}
+      powMethod(powMethod),
+      batchSize(batchSize) {}
 
 IterativeGridGeneratorRitterNovak::~IterativeGridGeneratorRitterNovak() {}
 
@@ -78,6 +81,12 @@ void IterativeGridGeneratorRitterNovak::setPowMethod(
   this->powMethod = powMethod;
 }
 
+size_t IterativeGridGeneratorRitterNovak::getBatchSize() const { return batchSize; }
+
+void IterativeGridGeneratorRitterNovak::setBatchSize(size_t batchSize) {
+  this->batchSize = batchSize;
+}
+
 bool IterativeGridGeneratorRitterNovak::generate() {
   Printer::getInstance().printStatusBegin("Adaptive grid generation (Ritter-Novak)...");
 
@@ -109,15 +118,6 @@ bool IterativeGridGeneratorRitterNovak::generate() {
   std::vector<size_t> levelSum(fX.getSize(), 0);
   // rank fulfills rank[i] = #{j | fX[j] <= fX[i]}
   std::vector<size_t> rank(fX.getSize(), 0);
-  // for those grid points with ignore[i] == true the refinement
-  // criterion won't be evaluated
-  std::vector<bool> ignore(fX.getSize(), false);
-
-  // refinementAlpha will be a standard basis vector
-  // (e.g. refinementAlpha[i] == 1.0 for exactly one i) to refine
-  // exactly one grid point
-  base::DataVector refinementAlpha(currentN);
-  refinementAlpha.setAll(0.0);
 
   for (size_t i = 0; i < currentN; i++) {
     base::GridPoint& gp = gridStorage[i];
@@ -145,6 +145,82 @@ bool IterativeGridGeneratorRitterNovak::generate() {
     fXSorted[i] = fX[fXOrder[i]];
   }
 
+  // refinement criterion of the i-th grid point
+  auto criterion = [&](size_t i) {
+    if (powMethod == STD_POW) {
+      return std::pow(static_cast<double>(levelSum[i] + degree[i]) + 1.0, gamma) *
+             std::pow(static_cast<double>(rank[i]) + 1.0, 1.0 - gamma);
+    } else {
+      return fastPow(static_cast<double>(levelSum[i] + degree[i]) + 1.0, gamma) *
+             fastPow(static_cast<double>(rank[i]) + 1.0, 1.0 - gamma);
+    }
+  };
+
+  // check if a refinement of the i-th grid point would generate
+  // children with a level greater than max_level (in one coordinate)
+  auto childrenTooDeep = [&](size_t i) {
+    base::GridPoint& gp = gridStorage[i];
+    base::index_t sourceIndex, childIndex;
+    base::level_t sourceLevel, childLevel;
+
+    // for each dimension
+    for (size_t t = 0; t < d; t++) {
+      gp.get(t, sourceLevel, sourceIndex);
+
+      // inspect the left child to be generated
+      if ((sourceLevel > 0) || (sourceIndex == 1)) {
+        childIndex = sourceIndex;
+        childLevel = sourceLevel;
+
+        while (gridStorage.isContaining(gp)) {
+          childIndex *= 2;
+          childLevel++;
+          gp.set(t, childLevel, childIndex - 1);
+        }
+
+        gp.set(t, sourceLevel, sourceIndex);
+
+        if (childLevel > maxLevel) {
+          return true;
+        }
+      }
+
+      // inspect the right child to be generated
+      if ((sourceLevel > 0) || (sourceIndex == 0)) {
+        childIndex = sourceIndex;
+        childLevel = sourceLevel;
+
+        while (gridStorage.isContaining(gp)) {
+          childIndex *= 2;
+          childLevel++;
+          gp.set(t, childLevel, childIndex + 1);
+        }
+
+        gp.set(t, sourceLevel, sourceIndex);
+
+        if (childLevel > maxLevel) {
+          return true;
+        }
+      }
+    }
+
+    return false;
+  };
+
+  // candidates for refinement as pairs (criterion, index), the smallest
+  // pair is on top (the criterion values may be outdated, but they are
+  // always lower bounds as ranks and degrees never decrease)
+  typedef std::pair<double, size_t> Candidate;
+  std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates;
+
+  for (size_t i = 0; i < currentN; i++) {
+    candidates.push(Candidate(criterion(i), i));
+  }
+
+  // grid points to be refined in the current iteration
+  std::vector<size_t> selected;
+  // number of grid points to be refined per iteration
+  size_t currentBatchSize = std::max(batchSize, static_cast<size_t>(1));
   // iteration counter
   size_t k = 0;
 
@@ -159,97 +235,40 @@ bool IterativeGridGeneratorRitterNovak::generate() {
                                                std::to_string(k) + ")");
     }
 
-    // determine the best i (i.e. i_best = argmin_i g_i)
-    size_t iBest = 0;
-    double gBest = INFINITY;
+    // determine the best candidates (i.e. the smallest g_i, ties are
+    // broken by the smaller index)
+    selected.clear();
 
-    for (size_t i = 0; i < currentN; i++) {
-      if (ignore[i]) {
-        continue;
-      }
+    while ((selected.size() < currentBatchSize) && !candidates.empty()) {
+      const size_t i = candidates.top().second;
+      candidates.pop();
 
-      // refinement criterion
-      double g;
+      const Candidate current(criterion(i), i);
 
-      if (powMethod == STD_POW) {
-        g = std::pow(static_cast<double>(levelSum[i] + degree[i]) + 1.0, gamma) *
-            std::pow(static_cast<double>(rank[i]) + 1.0, 1.0 - gamma);
-      } else {
-        g = fastPow(static_cast<double>(levelSum[i] + degree[i]) + 1.0, gamma) *
-            fastPow(static_cast<double>(rank[i]) + 1.0, 1.0 - gamma);
+      if (!candidates.empty() && (candidates.top() < current)) {
+        // outdated criterion value ==> reinsert with the current one
+        candidates.push(current);
+        continue;
       }
 
-      if (g < gBest) {
-        // so far the best value
-        // ==> check if a refinement of this point would generate
-        // children with a level greater than max_level
-        // (in one coordinate), if yes ignore the point
-        base::GridPoint& gp = gridStorage[i];
-
-        {
-          base::index_t sourceIndex, childIndex;
-          base::level_t sourceLevel, childLevel;
-
-          // for each dimension
-          for (size_t t = 0; t < d; t++) {
-            gp.get(t, sourceLevel, sourceIndex);
-
-            // inspect the left child to be generated
-            if ((sourceLevel > 0) || (sourceIndex == 1)) {
-              childIndex = sourceIndex;
-              childLevel = sourceLevel;
-
-              while (gridStorage.isContaining(gp)) {
-                childIndex *= 2;
-                childLevel++;
-                gp.set(t, childLevel, childIndex - 1);
-              }
-
-              gp.set(t, sourceLevel, sourceIndex);
-
-              if (childLevel > maxLevel) {
-                ignore[i] = true;
-                break;
-              }
-            }
-
-            // inspect the right child to be generated
-            if ((sourceLevel > 0) || (sourceIndex == 0)) {
-              childIndex = sourceIndex;
-              childLevel = sourceLevel;
-
-              while (gridStorage.isContaining(gp)) {
-                childIndex *= 2;
-                childLevel++;
-                gp.set(t, childLevel, childIndex + 1);
-              }
-
-              gp.set(t, sourceLevel, sourceIndex);
-
-              if (childLevel > maxLevel) {
-                ignore[i] = true;
-                break;
-              }
-            }
-          }
-        }
+      // children would be too "deep" ==> ignore the point from now on
+      // (the grid only grows, so they will always be too deep)
+      if (childrenTooDeep(i)) {
+        continue;
+      }
 
-        // children were too "deep" ==> ignore the point
-        if (ignore[i]) {
-          continue;
-        }
+      selected.push_back(i);
+    }
 
-        // no ignore ==> new candidate for the point to be refined
-        iBest = i;
-        gBest = g;
-      }
+    if (selected.empty()) {
+      Printer::getInstance().printStatusEnd(
+          "error: no refinable point in IterativeGridGeneratorRitterNovak");
+      result = false;
+      break;
     }
 
-    // refine point no. i_best
-    degree[iBest]++;
-    refinementAlpha[iBest] = 1.0;
-    base::SurplusRefinementFunctor refineFunc(refinementAlpha, 1);
-    refinement.free_refine(gridStorage, refineFunc);
+    // refine the selected points
+    refinement.refineGridpoints(gridStorage, selected);
 
     // new grid size
     const size_t newN = gridStorage.getSize();
@@ -263,19 +282,28 @@ bool IterativeGridGeneratorRitterNovak::generate() {
     }
 
     if (newN > N) {
-      // too many new points ==> undo refinement and exit
+      // too many new points ==> undo refinement
       undoRefinement(currentN);
+
+      if (selected.size() > 1) {
+        // refine the remaining points one by one
+        for (size_t i : selected) {
+          candidates.push(Candidate(criterion(i), i));
+        }
+
+        currentBatchSize = 1;
+        continue;
+      }
+
       break;
     }
 
-    // resize refinement vector and set to all zeros
-    // (in the following loop)
-    refinementAlpha.resize(newN);
-    refinementAlpha[iBest] = 0.0;
+    for (size_t i : selected) {
+      degree[i]++;
+    }
 
     for (size_t i = currentN; i < newN; i++) {
       base::GridPoint& gp = gridStorage[i];
-      refinementAlpha[i] = 0.0;
 
       // calculate sum of levels
       for (size_t t = 0; t < d; t++) {
@@ -314,6 +342,15 @@ bool IterativeGridGeneratorRitterNovak::generate() {
       }
     }
 
+    // (re-)insert the refined and the new points into the queue
+    for (size_t i : selected) {
+      candidates.push(Candidate(criterion(i), i));
+    }
+
+    for (size_t i = currentN; i < newN; i++) {
+      candidates.push(Candidate(criterion(i), i));
+    }
+
     // next round
     currentN = newN;
     k++;
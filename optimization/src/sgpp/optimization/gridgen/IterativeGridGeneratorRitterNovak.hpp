@@ -27,6 +27,15 @@ namespace optimization {
  * Computational Methods and Applications, Vol. 7. Springer 1996.
  * DOI: 10.1007/978-1-4613-3437-8_2
  *
+ * The candidates are kept in a priority queue keyed by the refinement
+ * criterion. As the criterion of a grid point can only grow during the
+ * generation (its rank and its degree never decrease), outdated keys are
+ * lower bounds and only have to be recomputed when they reach the top of
+ * the queue.
+ * If the batch size is greater than one, the best candidates are refined
+ * together in each iteration and the objective function is evaluated at
+ * all new grid points with one call of ScalarFunction::evalBatch.
+ *
  * @see HashRefinementMultiple
  */
 class IterativeGridGeneratorRitterNovak : public IterativeGridGenerator {
@@ -37,6 +46,8 @@ class IterativeGridGeneratorRitterNovak : public IterativeGridGenerator {
   static const base::level_t DEFAULT_INITIAL_LEVEL = 3;
   /// default maximal level of grid points
   static const base::level_t DEFAULT_MAX_LEVEL = 20;
+  /// default number of grid points refined per iteration
+  static const size_t DEFAULT_BATCH_SIZE = 1;
 
   /// exponentiation methods
   enum PowMethod { STD_POW, FAST_POW };
@@ -54,12 +65,14 @@ class IterativeGridGeneratorRitterNovak : public IterativeGridGenerator {
    * @param powMethod     exponentiation method
    *                      (fastPow is faster than std::pow,
    *                      but only approximative)
+   * @param batchSize     number of grid points refined per iteration
    */
   IterativeGridGeneratorRitterNovak(ScalarFunction& f, base::Grid& grid, size_t N,
                                     double adaptivity = DEFAULT_ADAPTIVITY,
                                     base::level_t initialLevel = DEFAULT_INITIAL_LEVEL,
                                     base::level_t maxLevel = DEFAULT_MAX_LEVEL,
-                                    PowMethod powMethod = STD_POW);
+                                    PowMethod powMethod = STD_POW,
+                                    size_t batchSize = DEFAULT_BATCH_SIZE);
 
   /**
    * Destructor.
@@ -113,6 +126,18 @@ class IterativeGridGeneratorRitterNovak : public IterativeGridGenerator {
    */
   void setPowMethod(PowMethod powMethod);
 
+  /**
+   * @return          number of grid points refined per iteration
+   */
+  size_t getBatchSize() const;
+
+  /**
+   * @param batchSize number of grid points refined per iteration
+   *                  (values greater than one refine the best candidates
+   *                  together and evaluate their children at once)
+   */
+  void setBatchSize(size_t batchSize);
+
  protected:
   /// adaptivity
   double gamma;
@@ -122,6 +147,8 @@ class IterativeGridGeneratorRitterNovak : public IterativeGridGenerator {
   base::level_t maxLevel;
   /// exponentiation method
   PowMethod powMethod;
+  /// number of grid points refined per iteration
+  size_t batchSize;
 };
 }  // namespace optimization
 }  // namespace sgpp
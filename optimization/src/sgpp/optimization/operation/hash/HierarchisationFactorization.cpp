@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/operation/hash/HierarchisationFactorization.hpp>
+#include <sgpp/optimization/sle/solver/Auto.hpp>
+#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/optimization/tools/ScopedLock.hpp>
+
+namespace sgpp {
+namespace optimization {
+
+HierarchisationFactorization::HierarchisationFactorization(base::Grid& grid)
+    : grid(grid), gridSize(0), gridHash(0), factorizationFailed(false), numberOfFallbacks(0) {}
+
+HierarchisationFactorization::~HierarchisationFactorization() {}
+
+bool HierarchisationFactorization::solve(base::DataVector& nodeValues) {
+  ScopedLock lock(mutex);
+
+  if (update() && lu.solveFactorized(nodeValues, nodeValues)) {
+    return true;
+  }
+
+  numberOfFallbacks++;
+  HierarchisationSLE system(grid);
+  sle_solver::Auto solver;
+  base::DataVector b(nodeValues);
+  return solver.solve(system, b, nodeValues);
+}
+
+bool HierarchisationFactorization::solve(base::DataMatrix& nodeValues) {
+  ScopedLock lock(mutex);
+
+  if (update() && lu.solveFactorized(nodeValues, nodeValues)) {
+    return true;
+  }
+
+  numberOfFallbacks++;
+  HierarchisationSLE system(grid);
+  sle_solver::Auto solver;
+  base::DataMatrix B(nodeValues);
+  return solver.solve(system, B, nodeValues);
+}
+
+bool HierarchisationFactorization::isUpToDate() const {
+  return lu.isFactorized() && (grid.getSize() == gridSize) &&
+         (grid.getStorage().computeHash() == gridHash);
+}
+
+size_t HierarchisationFactorization::getNumberOfFallbacks() const { return numberOfFallbacks; }
+
+void HierarchisationFactorization::clear() {
+  ScopedLock lock(mutex);
+  lu.clear();
+  gridSize = 0;
+  gridHash = 0;
+  factorizationFailed = false;
+  numberOfFallbacks = 0;
+}
+
+bool HierarchisationFactorization::update() {
+  const size_t n = grid.getSize();
+
+  if ((n == 0) || (n > MAX_DIM_FOR_FACTORIZATION)) {
+    return false;
+  }
+
+  const size_t hash = grid.getStorage().computeHash();
+
+  if ((n == gridSize) && (hash == gridHash)) {
+    // grid unchanged ==> don't retry if factorizing failed before
+    if (lu.isFactorized() || factorizationFailed) {
+      return lu.isFactorized();
+    }
+  }
+
+  HierarchisationSLE system(grid);
+  lu.clear();
+  gridSize = n;
+  gridHash = hash;
+  factorizationFailed = !lu.factorize(system);
+  return !factorizationFailed;
+}
+}  // namespace optimization
+}  // namespace sgpp
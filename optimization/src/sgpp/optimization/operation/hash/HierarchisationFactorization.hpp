@@ -0,0 +1,121 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_OPERATION_HASH_HIERARCHISATIONFACTORIZATION_HPP
+#define SGPP_OPTIMIZATION_OPERATION_HASH_HIERARCHISATIONFACTORIZATION_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/optimization/sle/solver/LUDecomposition.hpp>
+#include <sgpp/optimization/tools/MutexType.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace optimization {
+
+/**
+ * Solver for the hierarchisation systems of a grid which keeps the
+ * LU factorization of the system matrix (see HierarchisationSLE)
+ * between calls.
+ *
+ * The factorization is recomputed only if the grid has changed since the
+ * last call (detected by the number and the hashes of the grid points).
+ * Hence, repeated hierarchisation on the same grid (e.g., of the time
+ * steps of a time-dependent function) costs only the triangular solves,
+ * which are done for all columns of a matrix at once.
+ * If the grid is too large for a dense factorization or if the
+ * factorization fails, the system is solved by sle_solver::Auto
+ * as usual.
+ *
+ * The calls of solve() and clear() are serialized by a lock, as they
+ * may replace the stored factorization. Hence, an operation holding an
+ * object of this class may be shared by multiple threads, but concurrent
+ * hierarchisations on the same object do not run in parallel
+ * (the right-hand sides of one call are solved in parallel, though).
+ * The grid must not be modified during a call.
+ */
+class HierarchisationFactorization {
+ public:
+  /// maximal number of grid points for which the matrix is factorized
+  static const size_t MAX_DIM_FOR_FACTORIZATION = sle_solver::LUDecomposition::MAX_DIM;
+
+  /**
+   * Constructor.
+   * Do not destruct the grid before this object!
+   *
+   * @param grid  sparse grid
+   */
+  explicit HierarchisationFactorization(base::Grid& grid);
+
+  /**
+   * Destructor.
+   */
+  ~HierarchisationFactorization();
+
+  /**
+   * @param[in,out] nodeValues before: vector of function values at
+   *                           the grid points,
+   *                           after: vector of hierarchical coefficients
+   * @return                   whether hierarchisation was successful
+   */
+  bool solve(base::DataVector& nodeValues);
+
+  /**
+   * @param[in,out] nodeValues before: matrix of function values at
+   *                           the grid points,
+   *                           after: matrix of hierarchical coefficients
+   * @return                   whether hierarchisation was successful
+   */
+  bool solve(base::DataMatrix& nodeValues);
+
+  /**
+   * @return  whether a factorization for the current grid is stored
+   *          (without recomputing it)
+   */
+  bool isUpToDate() const;
+
+  /**
+   * @return  number of calls of solve() since the construction or the
+   *          last call of clear() that did not use the factorization,
+   *          but fell back to sle_solver::Auto
+   */
+  size_t getNumberOfFallbacks() const;
+
+  /**
+   * Discards the stored factorization.
+   */
+  void clear();
+
+ protected:
+  /**
+   * Factorizes the system matrix if the grid has changed.
+   *
+   * @return  whether a factorization for the current grid is available
+   */
+  bool update();
+
+  /// sparse grid
+  base::Grid& grid;
+  /// LU factorization of the system matrix
+  sle_solver::LUDecomposition lu;
+  /// number of grid points when the matrix was factorized
+  size_t gridSize;
+  /// hash of the grid points when the matrix was factorized
+  size_t gridHash;
+  /// whether factorizing failed for the grid with gridSize and gridHash
+  bool factorizationFailed;
+  /// number of calls of solve() that fell back to sle_solver::Auto
+  size_t numberOfFallbacks;
+  /// lock serializing solve() and clear()
+  MutexType mutex;
+};
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_OPERATION_HASH_HIERARCHISATIONFACTORIZATION_HPP */
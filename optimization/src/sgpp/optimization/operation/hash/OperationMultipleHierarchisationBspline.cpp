@@ -7,23 +7,18 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBspline.hpp>
 #include <sgpp/base/operation/hash/OperationEvalBsplineNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationBspline::OperationMultipleHierarchisationBspline(
     base::BsplineGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationBspline::~OperationMultipleHierarchisationBspline() {}
 
 bool OperationMultipleHierarchisationBspline::doHierarchisation(base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationBspline::doDehierarchisation(base::DataVector& alpha) {
@@ -43,10 +38,7 @@ void OperationMultipleHierarchisationBspline::doDehierarchisation(base::DataVect
 }
 
 bool OperationMultipleHierarchisationBspline::doHierarchisation(base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationBspline::doDehierarchisation(base::DataMatrix& alpha) {
@@ -7,25 +7,20 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationEvalBsplineBoundaryNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationBsplineBoundary::OperationMultipleHierarchisationBsplineBoundary(
     base::BsplineBoundaryGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationBsplineBoundary::
     ~OperationMultipleHierarchisationBsplineBoundary() {}
 
 bool OperationMultipleHierarchisationBsplineBoundary::doHierarchisation(
     base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationBsplineBoundary::doDehierarchisation(base::DataVector& alpha) {
@@ -46,10 +41,7 @@ void OperationMultipleHierarchisationBsplineBoundary::doDehierarchisation(base::
 
 bool OperationMultipleHierarchisationBsplineBoundary::doHierarchisation(
     base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationBsplineBoundary::doDehierarchisation(base::DataMatrix& alpha) {
@@ -11,6 +11,7 @@
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisation.hpp>
 #include <sgpp/base/grid/type/BsplineBoundaryGrid.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/optimization/operation/hash/HierarchisationFactorization.hpp>
 
 namespace sgpp {
 namespace optimization {
@@ -66,6 +67,8 @@ class OperationMultipleHierarchisationBsplineBoundary : public OperationMultiple
  protected:
   /// storage of the sparse grid
   base::BsplineBoundaryGrid& grid;
+  /// cached factorization of the hierarchisation matrix
+  HierarchisationFactorization factorization;
 };
 }  // namespace optimization
 }  // namespace sgpp
@@ -7,25 +7,20 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineClenshawCurtis.hpp>
 #include <sgpp/base/operation/hash/OperationEvalBsplineClenshawCurtisNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationBsplineClenshawCurtis::
     OperationMultipleHierarchisationBsplineClenshawCurtis(base::BsplineClenshawCurtisGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationBsplineClenshawCurtis::
     ~OperationMultipleHierarchisationBsplineClenshawCurtis() {}
 
 bool OperationMultipleHierarchisationBsplineClenshawCurtis::doHierarchisation(
     base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationBsplineClenshawCurtis::doDehierarchisation(
@@ -47,10 +42,7 @@ void OperationMultipleHierarchisationBsplineClenshawCurtis::doDehierarchisation(
 
 bool OperationMultipleHierarchisationBsplineClenshawCurtis::doHierarchisation(
     base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationBsplineClenshawCurtis::doDehierarchisation(
@@ -11,6 +11,7 @@
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisation.hpp>
 #include <sgpp/base/grid/type/BsplineClenshawCurtisGrid.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/optimization/operation/hash/HierarchisationFactorization.hpp>
 
 namespace sgpp {
 namespace optimization {
@@ -68,6 +69,8 @@ class OperationMultipleHierarchisationBsplineClenshawCurtis
  protected:
   /// storage of the sparse grid
   base::BsplineClenshawCurtisGrid& grid;
+  /// cached factorization of the hierarchisation matrix
+  HierarchisationFactorization factorization;
 };
 }  // namespace optimization
 }  // namespace sgpp
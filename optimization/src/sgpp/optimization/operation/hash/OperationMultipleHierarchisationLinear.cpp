@@ -7,23 +7,18 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationLinear.hpp>
 #include <sgpp/base/operation/hash/OperationEvalLinearNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationLinear::OperationMultipleHierarchisationLinear(
     base::LinearGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationLinear::~OperationMultipleHierarchisationLinear() {}
 
 bool OperationMultipleHierarchisationLinear::doHierarchisation(base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationLinear::doDehierarchisation(base::DataVector& alpha) {
@@ -43,10 +38,7 @@ void OperationMultipleHierarchisationLinear::doDehierarchisation(base::DataVecto
 }
 
 bool OperationMultipleHierarchisationLinear::doHierarchisation(base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationLinear::doDehierarchisation(base::DataMatrix& alpha) {
@@ -7,24 +7,19 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationLinearBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationEvalLinearBoundaryNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationLinearBoundary::OperationMultipleHierarchisationLinearBoundary(
     base::LinearBoundaryGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationLinearBoundary::~OperationMultipleHierarchisationLinearBoundary() {}
 
 bool OperationMultipleHierarchisationLinearBoundary::doHierarchisation(
     base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationLinearBoundary::doDehierarchisation(base::DataVector& alpha) {
@@ -45,10 +40,7 @@ void OperationMultipleHierarchisationLinearBoundary::doDehierarchisation(base::D
 
 bool OperationMultipleHierarchisationLinearBoundary::doHierarchisation(
     base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationLinearBoundary::doDehierarchisation(base::DataMatrix& alpha) {
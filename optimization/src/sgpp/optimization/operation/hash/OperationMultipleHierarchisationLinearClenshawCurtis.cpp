@@ -6,8 +6,6 @@
 #include <sgpp/globaldef.hpp>
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationLinearClenshawCurtis.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/base/operation/hash/OperationEvalLinearClenshawCurtisBoundaryNaive.hpp>
 
 namespace sgpp {
@@ -16,17 +14,14 @@ namespace optimization {
 OperationMultipleHierarchisationLinearClenshawCurtis::
     OperationMultipleHierarchisationLinearClenshawCurtis(
         base::LinearClenshawCurtisBoundaryGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationLinearClenshawCurtis::
     ~OperationMultipleHierarchisationLinearClenshawCurtis() {}
 
 bool OperationMultipleHierarchisationLinearClenshawCurtis::doHierarchisation(
     base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationLinearClenshawCurtis::doDehierarchisation(
@@ -48,10 +43,7 @@ void OperationMultipleHierarchisationLinearClenshawCurtis::doDehierarchisation(
 
 bool OperationMultipleHierarchisationLinearClenshawCurtis::doHierarchisation(
     base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationLinearClenshawCurtis::doDehierarchisation(
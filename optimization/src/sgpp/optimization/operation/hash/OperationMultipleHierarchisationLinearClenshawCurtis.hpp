@@ -10,6 +10,7 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisation.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/optimization/operation/hash/HierarchisationFactorization.hpp>
 #include "../../../../../../base/src/sgpp/base/grid/type/LinearClenshawCurtisBoundaryGrid.hpp"
 
 namespace sgpp {
@@ -68,6 +69,8 @@ class OperationMultipleHierarchisationLinearClenshawCurtis
  protected:
   /// storage of the sparse grid
   base::LinearClenshawCurtisBoundaryGrid& grid;
+  /// cached factorization of the hierarchisation matrix
+  HierarchisationFactorization factorization;
 };
 }  // namespace optimization
 }  // namespace sgpp
@@ -7,23 +7,18 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModBspline.hpp>
 #include <sgpp/base/operation/hash/OperationEvalModBsplineNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationModBspline::OperationMultipleHierarchisationModBspline(
     base::ModBsplineGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationModBspline::~OperationMultipleHierarchisationModBspline() {}
 
 bool OperationMultipleHierarchisationModBspline::doHierarchisation(base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModBspline::doDehierarchisation(base::DataVector& alpha) {
@@ -43,10 +38,7 @@ void OperationMultipleHierarchisationModBspline::doDehierarchisation(base::DataV
 }
 
 bool OperationMultipleHierarchisationModBspline::doHierarchisation(base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModBspline::doDehierarchisation(base::DataMatrix& alpha) {
@@ -7,8 +7,6 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModBsplineClenshawCurtis.hpp>
 #include <sgpp/base/operation/hash/OperationEvalModBsplineClenshawCurtisNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
@@ -16,17 +14,14 @@ namespace optimization {
 OperationMultipleHierarchisationModBsplineClenshawCurtis::
     OperationMultipleHierarchisationModBsplineClenshawCurtis(
         base::ModBsplineClenshawCurtisGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationModBsplineClenshawCurtis::
     ~OperationMultipleHierarchisationModBsplineClenshawCurtis() {}
 
 bool OperationMultipleHierarchisationModBsplineClenshawCurtis::doHierarchisation(
     base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModBsplineClenshawCurtis::doDehierarchisation(
@@ -48,10 +43,7 @@ void OperationMultipleHierarchisationModBsplineClenshawCurtis::doDehierarchisati
 
 bool OperationMultipleHierarchisationModBsplineClenshawCurtis::doHierarchisation(
     base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModBsplineClenshawCurtis::doDehierarchisation(
@@ -7,23 +7,18 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModLinear.hpp>
 #include <sgpp/base/operation/hash/OperationEvalModLinearNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationModLinear::OperationMultipleHierarchisationModLinear(
     base::ModLinearGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationModLinear::~OperationMultipleHierarchisationModLinear() {}
 
 bool OperationMultipleHierarchisationModLinear::doHierarchisation(base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModLinear::doDehierarchisation(base::DataVector& alpha) {
@@ -43,10 +38,7 @@ void OperationMultipleHierarchisationModLinear::doDehierarchisation(base::DataVe
 }
 
 bool OperationMultipleHierarchisationModLinear::doHierarchisation(base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModLinear::doDehierarchisation(base::DataMatrix& alpha) {
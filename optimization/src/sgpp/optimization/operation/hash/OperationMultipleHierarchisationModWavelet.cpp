@@ -7,23 +7,18 @@
 
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationModWavelet.hpp>
 #include <sgpp/base/operation/hash/OperationEvalModWaveletNaive.hpp>
-#include <sgpp/optimization/sle/solver/Auto.hpp>
-#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 namespace sgpp {
 namespace optimization {
 
 OperationMultipleHierarchisationModWavelet::OperationMultipleHierarchisationModWavelet(
     base::ModWaveletGrid& grid)
-    : grid(grid) {}
+    : grid(grid), factorization(grid) {}
 
 OperationMultipleHierarchisationModWavelet::~OperationMultipleHierarchisationModWavelet() {}
 
 bool OperationMultipleHierarchisationModWavelet::doHierarchisation(base::DataVector& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataVector b(nodeValues);
-  return solver.solve(system, b, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModWavelet::doDehierarchisation(base::DataVector& alpha) {
@@ -43,10 +38,7 @@ void OperationMultipleHierarchisationModWavelet::doDehierarchisation(base::DataV
 }
 
 bool OperationMultipleHierarchisationModWavelet::doHierarchisation(base::DataMatrix& nodeValues) {
-  HierarchisationSLE system(grid);
-  sle_solver::Auto solver;
-  base::DataMatrix B(nodeValues);
-  return solver.solve(system, B, nodeValues);
+  return factorization.solve(nodeValues);
 }
 
 void OperationMultipleHierarchisationModWavelet::doDehierarchisation(base::DataMatrix& alpha) {
@@ -79,6 +79,8 @@ void CMAES::optimize() {
   double sigma = 0.3;
 
   base::DataMatrix X(d, lambda), Y(d, lambda);
+  // transposed copy of X (one point per row) for the batch evaluation
+  base::DataMatrix XT(lambda, d);
   base::DataVector x(d), y(d), tmp(d);
   base::DataVector fX(lambda);
   std::vector<size_t> fXOrder(lambda);
@@ -119,22 +121,13 @@ void CMAES::optimize() {
       x.mult(sigma);
       x.add(m);
       X.setColumn(j, x);
-
-      {
-        bool inDomain = true;
-
-        for (size_t t = 0; t < d; t++) {
-          if ((x[t] < 0.0) || (x[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
-        }
-
-        fX[j] = (inDomain ? f->eval(x) : INFINITY);
-        fXOrder[j] = j;
-      }
+      XT.setRow(j, x);
+      fXOrder[j] = j;
     }
 
+    // evaluate the whole generation at once
+    evalPopulation(XT, fX);
+
     numberOfFcnEvals += lambda;
 
     std::sort(fXOrder.begin(), fXOrder.end(),
@@ -54,28 +54,28 @@ void DifferentialEvolution::optimize() {
   xHist.resize(0, d);
   fHist.resize(0);
 
-  // vector of individuals
-  std::vector<base::DataVector> x1(populationSize, base::DataVector(d, 0.0));
-  // another vector for the new population
-  std::vector<base::DataVector> x2(x1);
+  // matrix of individuals (one per row)
+  base::DataMatrix x1(populationSize, d);
+  // another matrix for the new population
+  base::DataMatrix x2(populationSize, d);
 
-  // pointers for swapping both vectors at the end of each iterations
-  std::vector<base::DataVector>* xOld = &x1;
-  std::vector<base::DataVector>* xNew = &x2;
+  // pointers for swapping both matrices at the end of each iterations
+  base::DataMatrix* xOld = &x1;
+  base::DataMatrix* xNew = &x2;
 
   // function values at the points of the populations
-  // (no need to swape those)
+  // (no need to swap those)
   base::DataVector fx(populationSize);
 
   // initial pseudorandom points
   for (size_t i = 0; i < populationSize; i++) {
     for (size_t t = 0; t < d; t++) {
-      (*xOld)[i][t] = RandomNumberGenerator::getInstance().getUniformRN();
+      (*xOld)(i, t) = RandomNumberGenerator::getInstance().getUniformRN();
     }
-
-    fx[i] = f->eval((*xOld)[i]);
   }
 
+  evalPopulation(*xOld, fx);
+
   // smallest function value in the population
   double fCurrentOpt = INFINITY;
   // index of the point with value fOpt
@@ -89,113 +89,68 @@ void DifferentialEvolution::optimize() {
   // number of iterations
   size_t maxK = std::max(static_cast<size_t>(2), N / populationSize) - 1;
 
-  std::vector<std::vector<size_t>> a(maxK, std::vector<size_t>(populationSize, 0)), b = a, c = a,
-                                                                                    j = a;
-  std::vector<std::vector<base::DataVector>> prob(
-      maxK, std::vector<base::DataVector>(populationSize, base::DataVector(d, 0)));
+  // current optimal point
+  base::DataVector xCurrentOpt(d);
+  // mutated points of the current generation (one per row)
+  base::DataMatrix y(populationSize, d);
+  // function values at the mutated points
+  base::DataVector fy(populationSize);
 
-  // pregenerate all pseudorandom numbers because the
-  // real algorithm is parallelized
-  // (for comparability of results, and maybe the
-  // RandomNumberGenerator isn't thread-safe)
+  // "real" algorithm loop
   for (size_t k = 0; k < maxK; k++) {
+    // generate the mutated points serially
+    // (the pseudorandom numbers are drawn in the same order as if
+    // the generations were evaluated one point after another)
     for (size_t i = 0; i < populationSize; i++) {
+      size_t a, b, c;
+
       do {
-        a[k][i] = RandomNumberGenerator::getInstance().getUniformIndexRN(populationSize);
-      } while (a[k][i] == i);
+        a = RandomNumberGenerator::getInstance().getUniformIndexRN(populationSize);
+      } while (a == i);
 
       do {
-        b[k][i] = RandomNumberGenerator::getInstance().getUniformIndexRN(populationSize);
-      } while ((b[k][i] == i) || (b[k][i] == a[k][i]));
+        b = RandomNumberGenerator::getInstance().getUniformIndexRN(populationSize);
+      } while ((b == i) || (b == a));
 
       do {
-        c[k][i] = RandomNumberGenerator::getInstance().getUniformIndexRN(populationSize);
-      } while ((c[k][i] == i) || (c[k][i] == a[k][i]) || (c[k][i] == b[k][i]));
+        c = RandomNumberGenerator::getInstance().getUniformIndexRN(populationSize);
+      } while ((c == i) || (c == a) || (c == b));
 
-      j[k][i] = RandomNumberGenerator::getInstance().getUniformIndexRN(d);
+      const size_t j = RandomNumberGenerator::getInstance().getUniformIndexRN(d);
 
+      // for each dimension
       for (size_t t = 0; t < d; t++) {
-        if (t != j[k][i]) {
-          prob[k][i][t] = RandomNumberGenerator::getInstance().getUniformRN();
+        if ((t == j) ||
+            (RandomNumberGenerator::getInstance().getUniformRN() < crossoverProbability)) {
+          // mutate point in this dimension
+          y(i, t) = (*xOld)(a, t) + scalingFactor * ((*xOld)(b, t) - (*xOld)(c, t));
+        } else {
+          // don't mutate point in this dimension
+          y(i, t) = (*xOld)(i, t);
         }
       }
     }
-  }
-
-  // "real" algorithm loop
-  for (size_t k = 0; k < maxK; k++) {
-    // abbreviations
-    const std::vector<size_t> &a_k = a[k], &b_k = b[k], &c_k = c[k];
-    const std::vector<size_t>& j_k = j[k];
-    const std::vector<base::DataVector>& prob_k = prob[k];
-
-#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, \
-                            xNew) default(none)
-    {  // NOLINT(whitespace/braces)
-      base::DataVector y(d);
-      ScalarFunction* curFPtr = f.get();
-#ifdef _OPENMP
-      std::unique_ptr<ScalarFunction> curF;
-
-      if (omp_get_max_threads() > 1) {
-        f->clone(curF);
-        curFPtr = curF.get();
-      }
 
-#endif /* _OPENMP */
+    // evaluate the whole generation at once
+    // (mutated points which are out of bounds are discarded)
+    evalPopulation(y, fy);
 
-// for each point in the population
-#pragma omp for schedule(dynamic)
+    // selection
+    for (size_t i = 0; i < populationSize; i++) {
+      const base::DataMatrix& source = ((fy[i] < fx[i]) ? y : *xOld);
 
-      for (size_t i = 0; i < populationSize; i++) {
-        const size_t &cur_a = a_k[i], &cur_b = b_k[i], &cur_c = c_k[i];
-        const size_t& cur_j = j_k[i];
-        const base::DataVector& prob_ki = prob_k[i];
-        bool inDomain = true;
+      if (fy[i] < fx[i]) {
+        // function_value is better ==> replace point with mutated one
+        fx[i] = fy[i];
 
-        // for each dimension
-        for (size_t t = 0; t < d; t++) {
-          const double& curProb = prob_ki[t];
-
-          if ((t == cur_j) || (curProb < crossoverProbability)) {
-            // mutate point in this dimension
-            y[t] = (*xOld)[cur_a][t] + scalingFactor * ((*xOld)[cur_b][t] - (*xOld)[cur_c][t]);
-          } else {
-            // don't mutate point in this dimension
-            y[t] = (*xOld)[i][t];
-          }
-
-          // mutated point is out of bounds ==> discard
-          if ((y[t] < 0.0) || (y[t] > 1.0)) {
-            inDomain = false;
-            break;
-          }
+        if (fy[i] < fCurrentOpt) {
+          xOptIndex = i;
+          fCurrentOpt = fy[i];
         }
+      }
 
-        // evaluate mutated point (if not out of bounds)
-        const double fy = (inDomain ? curFPtr->eval(y) : INFINITY);
-
-        if (fy < fx[i]) {
-// function_value is better ==> replace point with mutated one
-#pragma omp critical
-          {
-            fx[i] = fy;
-
-            if (fy < fCurrentOpt) {
-              xOptIndex = i;
-              fCurrentOpt = fy;
-            }
-          }
-
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = y[t];
-          }
-        } else {
-          // function value not better ==> keep old point
-          for (size_t t = 0; t < d; t++) {
-            (*xNew)[i][t] = (*xOld)[i][t];
-          }
-        }
+      for (size_t t = 0; t < d; t++) {
+        (*xNew)(i, t) = source(i, t);
       }
     }
 
@@ -228,7 +183,7 @@ void DifferentialEvolution::optimize() {
 
         for (size_t t = 0; t < d; t++) {
           distance2 +=
-              ((*xOld)[i][t] - (*xOld)[xOptIndex][t]) * ((*xOld)[i][t] - (*xOld)[xOptIndex][t]);
+              ((*xOld)(i, t) - (*xOld)(xOptIndex, t)) * ((*xOld)(i, t) - (*xOld)(xOptIndex, t));
         }
 
         if (distance2 > maxDistance2) {
@@ -251,13 +206,14 @@ void DifferentialEvolution::optimize() {
                                                std::to_string(fCurrentOpt));
     }
 
-    xHist.appendRow((*xOld)[xOptIndex]);
+    xOld->getRow(xOptIndex, xCurrentOpt);
+    xHist.appendRow(xCurrentOpt);
     fHist.append(fCurrentOpt);
   }
 
   // optimal point
   xOpt.resize(d);
-  xOpt = (*xOld)[xOptIndex];
+  xOld->getRow(xOptIndex, xOpt);
   fOpt = fCurrentOpt;
 
   Printer::getInstance().printStatusUpdate(std::to_string(maxK) + " steps, f(x) = " +
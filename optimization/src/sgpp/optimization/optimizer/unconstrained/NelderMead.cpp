@@ -49,13 +49,21 @@ void NelderMead::optimize() {
   base::DataVector fPoints(d + 1);
   base::DataVector fPointsNew(d + 1);
 
+  // vertices which are evaluated at once (one per row)
+  base::DataMatrix batchPoints(d + 1, d);
+  base::DataMatrix shrunkPoints(d, d);
+  base::DataVector fShrunkPoints(d);
+
   // construct starting simplex
   for (size_t t = 0; t < d; t++) {
     points[t + 1][t] = std::min(points[t + 1][t] + STARTING_SIMPLEX_EDGE_LENGTH, 1.0);
-    fPoints[t + 1] = f->eval(points[t + 1]);
   }
 
-  fPoints[0] = f->eval(points[0]);
+  for (size_t i = 0; i < d + 1; i++) {
+    batchPoints.setRow(i, points[i]);
+  }
+
+  evalPopulation(batchPoints, fPoints);
 
   std::vector<size_t> index(d + 1, 0);
   base::DataVector pointO(d);
@@ -177,19 +185,19 @@ void NelderMead::optimize() {
     }
 
     if (shrink) {
-      // shrink all points but the first
+      // shrink all points but the first and evaluate them at once
       for (size_t i = 1; i < d + 1; i++) {
-        bool in_domain = true;
-
         for (size_t t = 0; t < d; t++) {
           points[i][t] = points[0][t] + delta * (points[i][t] - points[0][t]);
-
-          if ((points[i][t] < 0.0) || (points[i][t] > 1.0)) {
-            in_domain = false;
-          }
         }
 
-        fPoints[i] = (in_domain ? f->eval(points[i]) : INFINITY);
+        shrunkPoints.setRow(i - 1, points[i]);
+      }
+
+      evalPopulation(shrunkPoints, fShrunkPoints);
+
+      for (size_t i = 1; i < d + 1; i++) {
+        fPoints[i] = fShrunkPoints[i - 1];
       }
 
       numberOfFcnEvals += d;
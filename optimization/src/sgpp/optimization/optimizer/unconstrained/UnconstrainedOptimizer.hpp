@@ -128,6 +128,20 @@ class UnconstrainedOptimizer {
   virtual void clone(std::unique_ptr<UnconstrainedOptimizer>& clone) const = 0;
 
  protected:
+  /**
+   * Evaluates the objective function at a whole population of points
+   * with one call of ScalarFunction::evalBatch.
+   * Points outside of \f$[0, 1]^d\f$ are not evaluated and get the
+   * value \f$\infty\f$.
+   *
+   * @param      x      matrix whose rows are the points
+   * @param[out] fx     vector of function values
+   */
+  void evalPopulation(const base::DataMatrix& x, base::DataVector& fx) const {
+    ScalarFunction::evalBatchInDomain(
+        x, fx, [this](const base::DataMatrix& y, base::DataVector& fy) { f->evalBatch(y, fy); });
+  }
+
   /// objective function
   std::unique_ptr<ScalarFunction> f;
   /// maximal number of iterations or function evaluations
@@ -19,6 +19,7 @@ typedef arma::mat ArmadilloMatrix;
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -46,54 +47,24 @@ bool Armadillo::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) con
 
   const arma::uword n = static_cast<arma::uword>(system.getDimension());
   ArmadilloMatrix A(n, n);
-  size_t nnz = 0;
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
 
   A.zeros();
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz) default(none)
-  {
-    SLE* system2 = &system;
-#ifdef _OPENMP
-    std::unique_ptr<CloneableSLE> clonedSLE;
-
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-      dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-      system2 = clonedSLE.get();
-    }
-
-#endif /* _OPENMP */
-
-// copy system matrix to Armadillo matrix object
-#pragma omp for ordered schedule(dynamic)
+  // only the non-zero entries are computed
+  Printer::getInstance().printStatusUpdate("constructing matrix");
+  system.getSparseMatrix(rowPointers, columnIndices, values);
+  const size_t nnz = values.size();
 
-    for (arma::uword i = 0; i < n; i++) {
-      for (arma::uword j = 0; j < n; j++) {
-        A(i, j) = system2->getMatrixEntry(i, j);
-
-        // count nonzero entries
-        // (not necessary, you can also remove that if you like)
-        if (A(i, j) != 0) {
-#pragma omp atomic
-          nnz++;
-        }
-      }
-
-      // status message
-      if (i % 100 == 0) {
-#pragma omp ordered
-        {
-          char str[10];
-          snprintf(str, sizeof(str), "%.1f%%",
-                   static_cast<double>(i) / static_cast<double>(n) * 100.0);
-          Printer::getInstance().printStatusUpdate("constructing matrix (" + std::string(str) +
-                                                   ")");
-        }
-      }
+  // copy system matrix to Armadillo matrix object
+  for (arma::uword i = 0; i < n; i++) {
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      A(i, static_cast<arma::uword>(columnIndices[k])) = values[k];
     }
   }
 
-  Printer::getInstance().printStatusUpdate("constructing matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
   // print ratio of nonzero entries
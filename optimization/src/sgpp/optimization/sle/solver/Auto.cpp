@@ -107,16 +107,17 @@ bool Auto::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
     size_t nnz = 0;
     size_t inc = static_cast<size_t>(ESTIMATE_NNZ_ROWS_SAMPLE_SIZE * static_cast<double>(n)) + 1;
 
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
+
     Printer::getInstance().printStatusUpdate("estimating sparsity pattern");
 
     for (size_t i = 0; i < n; i += inc) {
       nrows++;
-
-      for (size_t j = 0; j < n; j++) {
-        if (system.isMatrixEntryNonZero(i, j)) {
-          nnz++;
-        }
-      }
+      columnIndices.clear();
+      values.clear();
+      system.getMatrixRow(i, columnIndices, values);
+      nnz += columnIndices.size();
     }
 
     // calculate estimate ratio nonzero entries
@@ -16,6 +16,7 @@
 #include <cstddef>
 #include <iostream>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -73,52 +74,22 @@ bool Eigen::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
 
   const size_t n = system.getDimension();
   EigenMatrix A = EigenMatrix::Zero(n, n);
-  size_t nnz = 0;
-
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz) default(none)
-  {
-    SLE* system2 = &system;
-#ifdef _OPENMP
-    std::unique_ptr<CloneableSLE> clonedSLE;
-
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-      dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-      system2 = clonedSLE.get();
-    }
-
-#endif /* _OPENMP */
-
-// copy system matrix to Eigen matrix object
-#pragma omp for ordered schedule(dynamic)
-
-    for (size_t i = 0; i < n; i++) {
-      for (size_t j = 0; j < n; j++) {
-        A(i, j) = system2->getMatrixEntry(i, j);
-
-        // count nonzero entries
-        // (not necessary, you can also remove that if you like)
-        if (A(i, j) != 0) {
-#pragma omp atomic
-          nnz++;
-        }
-      }
-
-      // status message
-      if (i % 100 == 0) {
-#pragma omp ordered
-        {
-          char str[10];
-          snprintf(str, sizeof(str), "%.1f%%",
-                   static_cast<double>(i) / static_cast<double>(n) * 100.0);
-          Printer::getInstance().printStatusUpdate("constructing matrix (" + std::string(str) +
-                                                   ")");
-        }
-      }
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
+
+  // only the non-zero entries are computed
+  Printer::getInstance().printStatusUpdate("constructing matrix");
+  system.getSparseMatrix(rowPointers, columnIndices, values);
+  const size_t nnz = values.size();
+
+  // copy system matrix to Eigen matrix object
+  for (size_t i = 0; i < n; i++) {
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      A(i, columnIndices[k]) = values[k];
     }
   }
 
-  Printer::getInstance().printStatusUpdate("constructing matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
   // print ratio of nonzero entries
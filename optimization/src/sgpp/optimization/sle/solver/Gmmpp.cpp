@@ -114,53 +114,23 @@ bool Gmmpp::solve(SLE& system, base::DataVector& b, base::DataVector& x) const {
   Printer::getInstance().printStatusBegin("Solving linear system (Gmm++)...");
 
   const size_t n = system.getDimension();
-  size_t nnz = 0;
   gmm::csr_matrix<double> A2;
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
+
+  // only the non-zero entries are computed
+  Printer::getInstance().printStatusUpdate("constructing sparse matrix");
+  system.getSparseMatrix(rowPointers, columnIndices, values);
+  const size_t nnz = values.size();
 
   {
     gmm::row_matrix<gmm::rsvector<double>> A(n, n);
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz) default(none)
-    {
-      SLE* system2 = &system;
-#ifdef _OPENMP
-      std::unique_ptr<CloneableSLE> clonedSLE;
-
-      if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-        dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-        system2 = clonedSLE.get();
-      }
-
-#endif /* _OPENMP */
-
-// copy system matrix to Gmm++ matrix object
-#pragma omp for ordered schedule(dynamic)
-
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          double entry = system2->getMatrixEntry(i, j);
-
-          if (entry != 0) {
-#pragma omp critical
-            {
-              A(i, j) = entry;
-              nnz++;
-            }
-          }
-        }
-
-        // status message
-        if (i % 100 == 0) {
-#pragma omp ordered
-          {
-            char str[10];
-            snprintf(str, sizeof(str), "%.1f%%",
-                     static_cast<double>(i) / static_cast<double>(n) * 100.0);
-            Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
-                                                     std::string(str) + ")");
-          }
-        }
+    // copy system matrix to Gmm++ matrix object
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+        A(i, columnIndices[k]) = values[k];
       }
     }
 
@@ -169,7 +139,6 @@ bool Gmmpp::solve(SLE& system, base::DataVector& b, base::DataVector& x) const {
     gmm::copy(A, A2);
   }
 
-  Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
   // print ratio of nonzero entries
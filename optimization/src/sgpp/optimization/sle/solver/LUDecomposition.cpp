@@ -0,0 +1,341 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/sle/solver/LUDecomposition.hpp>
+#include <sgpp/optimization/tools/Printer.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+namespace sle_solver {
+
+LUDecomposition::LUDecomposition(double pivotThreshold, double tolerance)
+    : pivotThreshold(pivotThreshold), tolerance(tolerance), n(0), factorized(false) {}
+
+LUDecomposition::~LUDecomposition() {}
+
+bool LUDecomposition::solve(SLE& system, base::DataVector& b, base::DataVector& x) const {
+  base::DataMatrix B(b.getPointer(), b.getSize(), 1);
+  base::DataMatrix X(B.getNrows(), B.getNcols());
+
+  // call version for multiple RHSs
+  if (solve(system, B, X)) {
+    x.resize(X.getNrows());
+    X.getColumn(0, x);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+bool LUDecomposition::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const {
+  Printer::getInstance().printStatusBegin("Solving linear system (LU decomposition)...");
+
+  LUDecomposition lu(pivotThreshold, tolerance);
+
+  if (!lu.factorize(system)) {
+    Printer::getInstance().printStatusEnd("error: Could not factorize linear system!");
+    return false;
+  }
+
+  if (!lu.solveFactorized(B, X)) {
+    Printer::getInstance().printStatusEnd("error: Could not solve linear system!");
+    return false;
+  }
+
+  Printer::getInstance().printStatusEnd();
+  return true;
+}
+
+bool LUDecomposition::factorize(SLE& system) {
+  clear();
+  Printer::getInstance().printStatusBegin("Factorizing linear system (LU decomposition)...");
+
+  const size_t dim = system.getDimension();
+
+  if (dim > MAX_DIM) {
+    Printer::getInstance().printStatusEnd("error: Matrix is too large for the dense working "
+                                          "matrix (dimension " + std::to_string(dim) + ")!");
+    return false;
+  }
+
+  // only the non-zero entries are computed
+  system.getSparseMatrix(aRowPointers, aColumnIndices, aValues);
+
+  // dense working matrix, overwritten by L (below the diagonal) and U
+  base::DataMatrix W(dim, dim, 0.0);
+  double* const data = W.getPointer();
+
+  for (size_t i = 0; i < dim; i++) {
+    for (size_t p = aRowPointers[i]; p < aRowPointers[i + 1]; p++) {
+      data[i * dim + aColumnIndices[p]] = aValues[p];
+    }
+  }
+
+  rowPermutation.resize(dim);
+  std::iota(rowPermutation.begin(), rowPermutation.end(), 0);
+  // column indices of the non-zero entries of the pivot row right of the diagonal
+  std::vector<size_t> pivotRowNonZeros;
+
+  for (size_t k = 0; k < dim; k++) {
+    if (k % 100 == 0) {
+      Printer::getInstance().printStatusUpdate("k = " + std::to_string(k));
+    }
+
+    // threshold partial pivoting: keep the diagonal entry if it's large
+    // enough compared to the maximal entry (this preserves the sparsity
+    // of nearly triangular matrices)
+    double maxEntry = 0.0;
+    size_t maxRow = k;
+
+    for (size_t i = k; i < dim; i++) {
+      const double entry = std::abs(data[i * dim + k]);
+
+      if (entry > maxEntry) {
+        maxEntry = entry;
+        maxRow = i;
+      }
+    }
+
+    // all entries are zero ==> matrix is singular
+    if (maxEntry == 0.0) {
+      clear();
+      Printer::getInstance().printStatusEnd("error: Matrix is singular!");
+      return false;
+    }
+
+    if (std::abs(data[k * dim + k]) < pivotThreshold * maxEntry) {
+      std::swap_ranges(data + k * dim, data + (k + 1) * dim, data + maxRow * dim);
+      std::swap(rowPermutation[k], rowPermutation[maxRow]);
+    }
+
+    const double* const pivotRow = data + k * dim;
+    const double pivot = pivotRow[k];
+
+    pivotRowNonZeros.clear();
+
+    for (size_t j = k + 1; j < dim; j++) {
+      if (pivotRow[j] != 0.0) {
+        pivotRowNonZeros.push_back(j);
+      }
+    }
+
+    // loop over the non-zero entries only if the pivot row is sparse
+    const bool sparsePivotRow = (4 * pivotRowNonZeros.size() < dim - k);
+
+#pragma omp parallel for schedule(static) if (dim - k > 256)
+    for (size_t i = k + 1; i < dim; i++) {
+      double* const row = data + i * dim;
+
+      if (row[k] == 0.0) {
+        continue;
+      }
+
+      const double factor = row[k] / pivot;
+      row[k] = factor;
+
+      if (sparsePivotRow) {
+        for (size_t j : pivotRowNonZeros) {
+          row[j] -= factor * pivotRow[j];
+        }
+      } else {
+        for (size_t j = k + 1; j < dim; j++) {
+          row[j] -= factor * pivotRow[j];
+        }
+      }
+    }
+  }
+
+  // store the factors in sparse form
+  lRowPointers.assign(1, 0);
+  uRowPointers.assign(1, 0);
+  uDiagonal.resize(dim);
+
+  for (size_t i = 0; i < dim; i++) {
+    const double* const row = data + i * dim;
+
+    for (size_t j = 0; j < i; j++) {
+      if (row[j] != 0.0) {
+        lColumnIndices.push_back(j);
+        lValues.push_back(row[j]);
+      }
+    }
+
+    uDiagonal[i] = row[i];
+
+    for (size_t j = i + 1; j < dim; j++) {
+      if (row[j] != 0.0) {
+        uColumnIndices.push_back(j);
+        uValues.push_back(row[j]);
+      }
+    }
+
+    lRowPointers.push_back(lValues.size());
+    uRowPointers.push_back(uValues.size());
+  }
+
+  n = dim;
+  factorized = true;
+
+  Printer::getInstance().printStatusUpdate("k = " + std::to_string(dim));
+  Printer::getInstance().printStatusEnd();
+  return true;
+}
+
+bool LUDecomposition::solveFactorized(const base::DataMatrix& B, base::DataMatrix& X) const {
+  if (!factorized || (B.getNrows() != n)) {
+    return false;
+  }
+
+  const size_t m = B.getNcols();
+  base::DataMatrix Y(n, m);
+
+  // apply row permutation
+  for (size_t i = 0; i < n; i++) {
+    std::copy(B.getPointer() + rowPermutation[i] * m, B.getPointer() + (rowPermutation[i] + 1) * m,
+              Y.getPointer() + i * m);
+  }
+
+  // blocks of columns are processed independently by the threads
+  size_t numberOfBlocks = 1;
+#ifdef _OPENMP
+  numberOfBlocks = static_cast<size_t>(omp_get_max_threads());
+#endif
+  numberOfBlocks = std::max(std::min(numberOfBlocks, m), static_cast<size_t>(1));
+
+  bool residualsSmall = true;
+  double* const y = Y.getPointer();
+  const double* const b = B.getPointer();
+
+#pragma omp parallel for schedule(static) reduction(&& : residualsSmall)
+  for (size_t block = 0; block < numberOfBlocks; block++) {
+    const size_t c0 = block * m / numberOfBlocks;
+    const size_t c1 = (block + 1) * m / numberOfBlocks;
+
+    // forward substitution (L has unit diagonal)
+    for (size_t i = 0; i < n; i++) {
+      double* const yi = y + i * m;
+
+      for (size_t p = lRowPointers[i]; p < lRowPointers[i + 1]; p++) {
+        const double value = lValues[p];
+        const double* const yk = y + lColumnIndices[p] * m;
+
+        for (size_t c = c0; c < c1; c++) {
+          yi[c] -= value * yk[c];
+        }
+      }
+    }
+
+    // backward substitution
+    for (size_t i = n; i-- > 0;) {
+      double* const yi = y + i * m;
+
+      for (size_t p = uRowPointers[i]; p < uRowPointers[i + 1]; p++) {
+        const double value = uValues[p];
+        const double* const yk = y + uColumnIndices[p] * m;
+
+        for (size_t c = c0; c < c1; c++) {
+          yi[c] -= value * yk[c];
+        }
+      }
+
+      for (size_t c = c0; c < c1; c++) {
+        yi[c] /= uDiagonal[i];
+      }
+    }
+
+    // check residuals ||A*x - b||_2 <= tolerance * ||b||_2
+    std::vector<double> residualNorms2(c1 - c0, 0.0);
+    std::vector<double> rhsNorms2(c1 - c0, 0.0);
+    std::vector<double> residual(c1 - c0);
+
+    for (size_t i = 0; i < n; i++) {
+      const double* const bi = b + i * m;
+
+      for (size_t c = c0; c < c1; c++) {
+        residual[c - c0] = -bi[c];
+      }
+
+      for (size_t p = aRowPointers[i]; p < aRowPointers[i + 1]; p++) {
+        const double value = aValues[p];
+        const double* const yj = y + aColumnIndices[p] * m;
+
+        for (size_t c = c0; c < c1; c++) {
+          residual[c - c0] += value * yj[c];
+        }
+      }
+
+      for (size_t c = c0; c < c1; c++) {
+        residualNorms2[c - c0] += residual[c - c0] * residual[c - c0];
+        rhsNorms2[c - c0] += bi[c] * bi[c];
+      }
+    }
+
+    for (size_t c = c0; c < c1; c++) {
+      if (!(std::sqrt(residualNorms2[c - c0]) <= tolerance * std::sqrt(rhsNorms2[c - c0]))) {
+        residualsSmall = false;
+      }
+    }
+  }
+
+  if (!residualsSmall) {
+    return false;
+  }
+
+  X = Y;
+  return true;
+}
+
+bool LUDecomposition::solveFactorized(const base::DataVector& b, base::DataVector& x) const {
+  base::DataMatrix B(b.data(), b.getSize(), 1);
+  base::DataMatrix X(0, 0);
+
+  if (solveFactorized(B, X)) {
+    x.resize(X.getNrows());
+    X.getColumn(0, x);
+    return true;
+  } else {
+    return false;
+  }
+}
+
+bool LUDecomposition::isFactorized() const { return factorized; }
+
+size_t LUDecomposition::getDimension() const { return n; }
+
+size_t LUDecomposition::getNumberOfNonZeros() const {
+  return (factorized ? (lValues.size() + uValues.size() + n) : 0);
+}
+
+void LUDecomposition::clear() {
+  n = 0;
+  factorized = false;
+  rowPermutation.clear();
+  lRowPointers.clear();
+  lColumnIndices.clear();
+  lValues.clear();
+  uRowPointers.clear();
+  uColumnIndices.clear();
+  uValues.clear();
+  uDiagonal.clear();
+  aRowPointers.clear();
+  aColumnIndices.clear();
+  aValues.clear();
+}
+}  // namespace sle_solver
+}  // namespace optimization
+}  // namespace sgpp
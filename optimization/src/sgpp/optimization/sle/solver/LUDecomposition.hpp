@@ -0,0 +1,171 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SGPP_OPTIMIZATION_SLE_SOLVER_LUDECOMPOSITION_HPP
+#define SGPP_OPTIMIZATION_SLE_SOLVER_LUDECOMPOSITION_HPP
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/optimization/sle/solver/SLESolver.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+namespace sle_solver {
+
+/**
+ * Linear system solver using an LU factorization with threshold
+ * partial pivoting.
+ *
+ * The matrix is factorized in a dense working matrix, but zero entries
+ * are skipped during the elimination. This keeps the factorization of
+ * hierarchisation matrices cheap, which are nearly triangular if the
+ * grid points are ordered by level.
+ * The factors are stored in sparse form.
+ *
+ * Besides the SLESolver interface, the factorization can be computed
+ * once with factorize() and reused for arbitrarily many right-hand sides
+ * with solveFactorized().
+ * The right-hand sides are distributed in blocks of columns to OpenMP
+ * threads.
+ */
+class LUDecomposition : public SLESolver {
+ public:
+  /// maximal dimension of systems that are factorized (the dense working
+  /// matrix needs \f$8 n^2\f$ bytes, i.e., 72 MB for the maximum)
+  static const size_t MAX_DIM = 3000;
+  /// default pivot threshold
+  static constexpr double DEFAULT_PIVOT_THRESHOLD = 0.1;
+  /// default tolerance for the relative residual of the solutions
+  static constexpr double DEFAULT_TOLERANCE = 1e-10;
+
+  /**
+   * Constructor.
+   *
+   * @param pivotThreshold  the diagonal entry is kept as pivot if its
+   *                        absolute value is at least pivotThreshold
+   *                        times the largest absolute value in the
+   *                        column (1 means standard partial pivoting)
+   * @param tolerance       solutions whose relative residual
+   *                        (Euclidean norm) is greater than this
+   *                        tolerance are rejected
+   */
+  explicit LUDecomposition(double pivotThreshold = DEFAULT_PIVOT_THRESHOLD,
+                           double tolerance = DEFAULT_TOLERANCE);
+
+  /**
+   * Destructor.
+   */
+  ~LUDecomposition() override;
+
+  /**
+   * @param       system  system to be solved
+   * @param       b       right-hand side
+   * @param[out]  x       solution to the system
+   * @return              whether all went well
+   *                      (false if errors occurred)
+   */
+  bool solve(SLE& system, base::DataVector& b, base::DataVector& x) const override;
+
+  /**
+   * @param       system  system to be solved
+   * @param       B       matrix of right-hand sides
+   * @param[out]  X       matrix of solutions to the systems
+   * @return              whether all went well
+   *                      (false if errors occurred)
+   */
+  bool solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const override;
+
+  /**
+   * Computes and stores the LU factorization of the matrix of a system.
+   * A previously stored factorization is discarded.
+   *
+   * @param system    system whose matrix should be factorized
+   * @return          whether the matrix could be factorized
+   *                  (false if it is singular or if its dimension
+   *                  exceeds MAX_DIM)
+   */
+  bool factorize(SLE& system);
+
+  /**
+   * Solves the factorized system for multiple right-hand sides.
+   *
+   * @param       B   matrix of right-hand sides
+   * @param[out]  X   matrix of solutions (may be the same object as B)
+   * @return          whether all went well
+   *                  (false if there is no factorization or if the
+   *                  residual of a solution is too large)
+   */
+  bool solveFactorized(const base::DataMatrix& B, base::DataMatrix& X) const;
+
+  /**
+   * Solves the factorized system for one right-hand side.
+   *
+   * @param       b   right-hand side
+   * @param[out]  x   solution (may be the same object as b)
+   * @return          whether all went well
+   *                  (false if there is no factorization or if the
+   *                  residual of the solution is too large)
+   */
+  bool solveFactorized(const base::DataVector& b, base::DataVector& x) const;
+
+  /**
+   * @return  whether a factorization is stored
+   */
+  bool isFactorized() const;
+
+  /**
+   * @return  dimension of the factorized system (0 if there is none)
+   */
+  size_t getDimension() const;
+
+  /**
+   * @return  number of non-zero entries in both factors
+   */
+  size_t getNumberOfNonZeros() const;
+
+  /**
+   * Discards the stored factorization.
+   */
+  void clear();
+
+ protected:
+  /// pivot threshold
+  double pivotThreshold;
+  /// tolerance for the relative residual
+  double tolerance;
+  /// dimension of the factorized system
+  size_t n;
+  /// whether a factorization is stored
+  bool factorized;
+  /// row i of the factors corresponds to row rowPermutation[i] of the matrix
+  std::vector<size_t> rowPermutation;
+  /// row pointers of the strictly lower triangular part of L (unit diagonal)
+  std::vector<size_t> lRowPointers;
+  /// column indices of the strictly lower triangular part of L
+  std::vector<size_t> lColumnIndices;
+  /// values of the strictly lower triangular part of L
+  std::vector<double> lValues;
+  /// row pointers of the strictly upper triangular part of U
+  std::vector<size_t> uRowPointers;
+  /// column indices of the strictly upper triangular part of U
+  std::vector<size_t> uColumnIndices;
+  /// values of the strictly upper triangular part of U
+  std::vector<double> uValues;
+  /// diagonal of U
+  std::vector<double> uDiagonal;
+  /// row pointers of the original matrix (for checking residuals)
+  std::vector<size_t> aRowPointers;
+  /// column indices of the original matrix
+  std::vector<size_t> aColumnIndices;
+  /// values of the original matrix
+  std::vector<double> aValues;
+};
+}  // namespace sle_solver
+}  // namespace optimization
+}  // namespace sgpp
+
+#endif /* SGPP_OPTIMIZATION_SLE_SOLVER_LUDECOMPOSITION_HPP */
@@ -74,59 +74,15 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
 
   const size_t n = system.getDimension();
 
-  size_t nnz = 0;
-  std::vector<uint32_t> Ti;
-  std::vector<uint32_t> Tj;
-  std::vector<double> Tx;
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, Ti, Tj, Tx, nnz) default(none)
-  {
-    SLE* system2 = &system;
-#ifdef _OPENMP
-    std::unique_ptr<CloneableSLE> clonedSLE;
-
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
-      dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
-      system2 = clonedSLE.get();
-    }
-
-#endif /* _OPENMP */
-
-// get indices and values of nonzero entries
-#pragma omp for ordered schedule(dynamic)
-
-    for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
+  // only the non-zero entries are computed
+  Printer::getInstance().printStatusUpdate("constructing sparse matrix");
+  system.getSparseMatrix(rowPointers, columnIndices, values);
+  const size_t nnz = values.size();
 
-        if (entry != 0) {
-#pragma omp critical
-          {
-            Ti.push_back(i);
-            Tj.push_back(j);
-            Tx.push_back(entry);
-            nnz++;
-          }
-        }
-      }
-
-      // status message
-      if (i % 100 == 0) {
-#pragma omp ordered
-
-        {
-          char str[10];
-          snprintf(str, sizeof(str), "%.1f%%",
-                   static_cast<double>(i) / static_cast<double>(n) * 100.0);
-          Printer::getInstance().printStatusUpdate("constructing sparse matrix (" +
-                                                   std::string(str) + ")");
-        }
-      }
-    }
-  }
-
-  Printer::getInstance().printStatusUpdate("constructing sparse matrix (100.0%)");
   Printer::getInstance().printStatusNewLine();
 
   // print ratio of nonzero entries
@@ -144,28 +100,26 @@ bool UMFPACK::solve(SLE& system, base::DataMatrix& B, base::DataMatrix& X) const
 
   sslong result;
 
-  // convert matrix to CCS
-  {
-    std::vector<sslong> TiArray(nnz, 0);
-    std::vector<sslong> TjArray(nnz, 0);
+  // convert matrix from CSR to CCS (the row indices of each column are sorted)
+  Printer::getInstance().printStatusUpdate("step 1: conversion to CCS");
 
-    for (size_t k = 0; k < nnz; k++) {
-      TiArray[k] = static_cast<sslong>(Ti[k]);
-      TjArray[k] = static_cast<sslong>(Tj[k]);
-    }
+  for (size_t k = 0; k < nnz; k++) {
+    Ap[columnIndices[k] + 1]++;
+  }
 
-    Printer::getInstance().printStatusUpdate("step 1: umfpack_dl_triplet_to_col");
+  for (size_t j = 0; j < n; j++) {
+    Ap[j + 1] += Ap[j];
+  }
 
-    result = umfpack_dl_triplet_to_col(static_cast<sslong>(n), static_cast<sslong>(n),
-                                       static_cast<sslong>(nnz), &TiArray[0], &TjArray[0], &Tx[0],
-                                       &Ap[0], &Ai[0], &Ax[0], NULL);
+  {
+    std::vector<sslong> nextPosition(Ap.begin(), Ap.end() - 1);
 
-    if (result != UMFPACK_OK) {
-      Printer::getInstance().printStatusEnd(
-          "error: Could not convert to CCS via "
-          "umfpack_dl_triplet_to_col, error code " +
-          std::to_string(result));
-      return false;
+    for (size_t i = 0; i < n; i++) {
+      for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+        const sslong position = nextPosition[columnIndices[k]]++;
+        Ai[position] = static_cast<sslong>(i);
+        Ax[position] = values[k];
+      }
     }
   }
 
@@ -40,10 +40,15 @@
 #include <sgpp/base/grid/type/ModFundamentalSplineGrid.hpp>
 #include <sgpp/base/grid/type/NakBsplineBoundaryCombigridGrid.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <map>
 #include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -71,7 +76,12 @@ class HierarchisationSLE : public CloneableSLE {
    *                          grid points according to gridStorage)
    */
   HierarchisationSLE(base::Grid& grid, base::GridStorage& gridStorage)
-      : CloneableSLE(), grid(grid), gridStorage(gridStorage), basisType(INVALID) {
+      : CloneableSLE(),
+        grid(grid),
+        gridStorage(gridStorage),
+        basisType(INVALID),
+        supportHalfWidth(0.0),
+        clenshawCurtisSupport(false) {
     // initialize the correct basis (according to the grid)
     if (grid.getType() == base::GridType::Bspline) {
       bsplineBasis = std::unique_ptr<base::SBsplineBase>(
@@ -143,6 +153,22 @@ class HierarchisationSLE : public CloneableSLE {
     } else {
       throw std::invalid_argument("Grid type not supported.");
     }
+
+    // supports of the basis functions in terms of the index (zero means: unknown/global)
+    if (basisType == BSPLINE) {
+      supportHalfWidth = static_cast<double>(bsplineBasis->getDegree() + 1) / 2.0;
+    } else if (basisType == BSPLINE_BOUNDARY) {
+      supportHalfWidth = static_cast<double>(bsplineBoundaryBasis->getDegree() + 1) / 2.0;
+    } else if (basisType == BSPLINE_MODIFIED) {
+      supportHalfWidth = static_cast<double>(modBsplineBasis->getDegree() + 1) / 2.0;
+    } else if ((basisType == LINEAR) || (basisType == LINEAR_BOUNDARY) ||
+               (basisType == LINEAR_MODIFIED)) {
+      supportHalfWidth = 1.0;
+    } else if ((basisType == LINEAR_CLENSHAW_CURTIS) ||
+               (basisType == LINEAR_CLENSHAW_CURTIS_BOUNDARY)) {
+      supportHalfWidth = 1.0;
+      clenshawCurtisSupport = true;
+    }
   }
 
   /**
@@ -164,6 +190,163 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * Append the non-zero entries of the i-th row, i.e., the values of all
+   * basis functions whose support contains the i-th grid point.
+   * Instead of evaluating all basis functions, the grid points are
+   * grouped by their level (one group per subspace) and, for every
+   * subspace, only the indices whose support may contain the grid point
+   * are looked up in the grid storage. This results in
+   * \f$\mathcal{O}(\text{\#subspaces} + \text{nnz in row})\f$
+   * evaluations per row for bases with local support.
+   *
+   * @param       i               row index
+   * @param[out]  columnIndices   column indices of the non-zero entries
+   *                              are appended to this vector
+   * @param[out]  values          corresponding matrix entries are
+   *                              appended to this vector
+   */
+  void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                    std::vector<double>& values) override {
+    if (subspaces.empty()) {
+      createSubspaceIndex();
+    }
+
+    const size_t d = gridStorage.getDimension();
+    const base::GridPoint& gpPoint = gridStorage[i];
+    std::vector<double> x(d);
+    std::vector<base::index_t> lower(d);
+    std::vector<base::index_t> upper(d);
+    std::vector<base::index_t> step(d);
+    std::vector<base::index_t> index(d);
+    std::vector<std::pair<size_t, double>> entries;
+    base::GridPoint gp(d);
+
+    for (size_t t = 0; t < d; t++) {
+      x[t] = gridStorage.getUnitCoordinate(gpPoint, t);
+    }
+
+    for (const Subspace& subspace : subspaces) {
+      // number of candidate indices in the subspace
+      size_t numCandidates = 1;
+
+      for (size_t t = 0; t < d; t++) {
+        getSupportIndexRange(subspace.level[t], x[t], lower[t], upper[t], step[t]);
+
+        if (lower[t] > upper[t]) {
+          numCandidates = 0;
+          break;
+        }
+
+        numCandidates *= (upper[t] - lower[t]) / step[t] + 1;
+
+        if (numCandidates >= subspace.points.size()) {
+          break;
+        }
+      }
+
+      if (numCandidates == 0) {
+        continue;
+      } else if (numCandidates >= subspace.points.size()) {
+        // cheaper to evaluate all basis functions of the subspace
+        for (size_t j : subspace.points) {
+          const double entry = evalBasisFunctionAtGridPoint(j, i);
+
+          if (entry != 0.0) {
+            entries.push_back(std::make_pair(j, entry));
+          }
+        }
+      } else {
+        // look up all candidates in the grid storage
+        index = lower;
+
+        while (true) {
+          for (size_t t = 0; t < d; t++) {
+            gp.push(t, subspace.level[t], index[t]);
+          }
+
+          gp.rehash();
+          const size_t j = gridStorage.getSequenceNumber(gp);
+
+          if (!gridStorage.isInvalidSequenceNumber(j)) {
+            const double entry = evalBasisFunctionAtGridPoint(j, i);
+
+            if (entry != 0.0) {
+              entries.push_back(std::make_pair(j, entry));
+            }
+          }
+
+          size_t t = 0;
+
+          while ((t < d) && (index[t] + step[t] > upper[t])) {
+            index[t] = lower[t];
+            t++;
+          }
+
+          if (t == d) {
+            break;
+          }
+
+          index[t] += step[t];
+        }
+      }
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    for (const std::pair<size_t, double>& entry : entries) {
+      columnIndices.push_back(entry.first);
+      values.push_back(entry.second);
+    }
+  }
+
+  /**
+   * Multiply the matrix with a vector, using getMatrixRow().
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const base::DataVector& x, base::DataVector& y) override {
+    const size_t n = getDimension();
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
+    y.resize(n);
+
+    for (size_t i = 0; i < n; i++) {
+      columnIndices.clear();
+      values.clear();
+      getMatrixRow(i, columnIndices, values);
+      double yi = 0.0;
+
+      for (size_t k = 0; k < columnIndices.size(); k++) {
+        yi += values[k] * x[columnIndices[k]];
+      }
+
+      y[i] = yi;
+    }
+  }
+
+  /**
+   * Count all non-zero entries, using getMatrixRow().
+   *
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override {
+    const size_t n = getDimension();
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      columnIndices.clear();
+      values.clear();
+      getMatrixRow(i, columnIndices, values);
+      nnz += columnIndices.size();
+    }
+
+    return nnz;
+  }
+
   /**
    * @return          sparse grid
    */
@@ -222,6 +405,17 @@ class HierarchisationSLE : public CloneableSLE {
   /// not-a-knot B-spline Boundary basis
   std::unique_ptr<base::SNakBsplineBoundaryCombigridBase> nakBsplineBoundaryCombigridBasis;
 
+  /// grid points of one level (subspace)
+  struct Subspace {
+    /// level of the grid points
+    std::vector<base::level_t> level;
+    /// indices of the grid points in the grid storage
+    std::vector<size_t> points;
+  };
+
+  /// grid points grouped by level, created on first use by getMatrixRow()
+  std::vector<Subspace> subspaces;
+
   /// type of grid/basis functions
   enum {
     INVALID,
@@ -243,6 +437,86 @@ class HierarchisationSLE : public CloneableSLE {
     NAK_BSPLINEBOUNDARY_COMBIGRID
   } basisType;
 
+  /// 1D support of basis function (l,i) is the open interval between the
+  /// (possibly non-existing) points with indices i-supportHalfWidth and
+  /// i+supportHalfWidth (zero if the support is global or not known)
+  double supportHalfWidth;
+  /// whether the grid points are Clenshaw-Curtis points (otherwise equidistant)
+  bool clenshawCurtisSupport;
+
+  /**
+   * Groups the grid points by level.
+   */
+  void createSubspaceIndex() {
+    const size_t d = gridStorage.getDimension();
+    std::map<std::vector<base::level_t>, size_t> subspaceIndices;
+    std::vector<base::level_t> level(d);
+
+    for (size_t j = 0; j < gridStorage.getSize(); j++) {
+      const base::GridPoint& gp = gridStorage[j];
+
+      for (size_t t = 0; t < d; t++) {
+        level[t] = gp.getLevel(t);
+      }
+
+      auto it = subspaceIndices.find(level);
+
+      if (it == subspaceIndices.end()) {
+        it = subspaceIndices.insert(std::make_pair(level, subspaces.size())).first;
+        subspaces.push_back(Subspace());
+        subspaces.back().level = level;
+      }
+
+      subspaces[it->second].points.push_back(j);
+    }
+  }
+
+  /**
+   * Determine the 1D indices of the basis functions of a given level
+   * whose support may contain a given point.
+   *
+   * @param       l       level
+   * @param       x       coordinate in the unit interval
+   * @param[out]  lower   smallest candidate index
+   * @param[out]  upper   largest candidate index
+   *                      (lower > upper if there are no candidates)
+   * @param[out]  step    step between the candidate indices
+   *                      (2 for levels > 0, as the indices are odd)
+   */
+  inline void getSupportIndexRange(base::level_t l, double x, base::index_t& lower,
+                                   base::index_t& upper, base::index_t& step) const {
+    const base::index_t hInv = static_cast<base::index_t>(1) << l;
+    step = ((l == 0) ? 1 : 2);
+
+    if (supportHalfWidth == 0.0) {
+      lower = ((l == 0) ? 0 : 1);
+      upper = ((l == 0) ? 1 : hInv - 1);
+      return;
+    }
+
+    x = std::max(0.0, std::min(x, 1.0));
+    const double position =
+        (clenshawCurtisSupport ? std::acos(1.0 - 2.0 * x) / M_PI : x) * static_cast<double>(hInv);
+    // i has to satisfy |position - i| < supportHalfWidth, allow for rounding errors
+    const double tolerance = 1e-8;
+    const double lowerDbl = std::floor(position - supportHalfWidth - tolerance) + 1.0;
+    const double upperDbl = std::ceil(position + supportHalfWidth + tolerance) - 1.0;
+
+    lower = ((lowerDbl <= 0.0) ? 0 : static_cast<base::index_t>(lowerDbl));
+    upper = std::min(static_cast<base::index_t>(upperDbl), hInv);
+
+    if (l > 0) {
+      // only odd indices
+      if (lower % 2 == 0) {
+        lower++;
+      }
+
+      if ((upper % 2 == 0) && (upper > 0)) {
+        upper--;
+      }
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
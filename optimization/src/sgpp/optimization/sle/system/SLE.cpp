@@ -0,0 +1,88 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/optimization/sle/system/CloneableSLE.hpp>
+#include <sgpp/optimization/sle/system/SLE.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif /* _OPENMP */
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace optimization {
+
+void SLE::getSparseMatrix(std::vector<size_t>& rowPointers, std::vector<size_t>& columnIndices,
+                          std::vector<double>& values) {
+  const size_t n = getDimension();
+  // for each row: thread whose buffers contain the row and offset in these buffers
+  std::vector<size_t> rowThread(n, 0);
+  std::vector<size_t> rowOffset(n, 0);
+  size_t numThreads = 1;
+
+#ifdef _OPENMP
+  if (isCloneable()) {
+    numThreads = static_cast<size_t>(omp_get_max_threads());
+  }
+#endif /* _OPENMP */
+
+  std::vector<std::vector<size_t>> threadColumnIndices(numThreads);
+  std::vector<std::vector<double>> threadValues(numThreads);
+  rowPointers.assign(n + 1, 0);
+
+// parallelize only if the system is cloneable
+#pragma omp parallel num_threads(static_cast<int>(numThreads)) if (numThreads > 1)
+  {
+    SLE* system = this;
+    size_t thread = 0;
+#ifdef _OPENMP
+    std::unique_ptr<CloneableSLE> clonedSLE;
+
+    if (numThreads > 1) {
+      thread = static_cast<size_t>(omp_get_thread_num());
+      dynamic_cast<CloneableSLE*>(this)->clone(clonedSLE);
+      system = clonedSLE.get();
+    }
+#endif /* _OPENMP */
+
+    std::vector<size_t>& myColumnIndices = threadColumnIndices[thread];
+    std::vector<double>& myValues = threadValues[thread];
+
+#pragma omp for schedule(dynamic, 16)
+    for (size_t i = 0; i < n; i++) {
+      rowThread[i] = thread;
+      rowOffset[i] = myColumnIndices.size();
+      system->getMatrixRow(i, myColumnIndices, myValues);
+      rowPointers[i + 1] = myColumnIndices.size() - rowOffset[i];
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    rowPointers[i + 1] += rowPointers[i];
+  }
+
+  const size_t nnz = rowPointers[n];
+  columnIndices.resize(nnz);
+  values.resize(nnz);
+
+#pragma omp parallel for schedule(static) if (numThreads > 1)
+  for (size_t i = 0; i < n; i++) {
+    const size_t count = rowPointers[i + 1] - rowPointers[i];
+    const size_t* sourceIndices = threadColumnIndices[rowThread[i]].data() + rowOffset[i];
+    const double* sourceValues = threadValues[rowThread[i]].data() + rowOffset[i];
+
+    std::copy(sourceIndices, sourceIndices + count, columnIndices.begin() + rowPointers[i]);
+    std::copy(sourceValues, sourceValues + count, values.begin() + rowPointers[i]);
+  }
+}
+
+}  // namespace optimization
+}  // namespace sgpp
@@ -10,6 +10,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace optimization {
@@ -48,6 +49,49 @@ class SLE {
    */
   virtual double getMatrixEntry(size_t i, size_t j) = 0;
 
+  /**
+   * Append the non-zero entries of a matrix row.
+   * Standard implementation with \f$\mathcal{O}(n)\f$ calls of
+   * getMatrixEntry(); systems that know their sparsity pattern should
+   * override this to enumerate only the entries that may be non-zero.
+   *
+   * @param       i               row index
+   * @param[out]  columnIndices   column indices of the non-zero entries
+   *                              of the i-th row (in ascending order)
+   *                              are appended to this vector
+   * @param[out]  values          corresponding matrix entries are
+   *                              appended to this vector
+   */
+  virtual void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                            std::vector<double>& values) {
+    const size_t n = getDimension();
+
+    for (size_t j = 0; j < n; j++) {
+      const double entry = getMatrixEntry(i, j);
+
+      if (entry != 0.0) {
+        columnIndices.push_back(j);
+        values.push_back(entry);
+      }
+    }
+  }
+
+  /**
+   * Assemble the matrix in compressed sparse row (CSR) format by
+   * calling getMatrixRow() for every row.
+   * If the system is cloneable, the rows are distributed among the
+   * OpenMP threads, each of which works on its own clone of the system
+   * and collects its rows in its own buffers.
+   *
+   * @param[out]  rowPointers     entries of the i-th row are stored in
+   *                              positions rowPointers[i] to
+   *                              rowPointers[i+1]-1 (size n+1)
+   * @param[out]  columnIndices   column indices of the non-zero entries
+   * @param[out]  values          non-zero entries
+   */
+  void getSparseMatrix(std::vector<size_t>& rowPointers, std::vector<size_t>& columnIndices,
+                       std::vector<double>& values);
+
   /**
    * Multiply the matrix with a vector.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ scalar
@@ -38,6 +38,7 @@
 #include <sgpp/optimization/gridgen/IterativeGridGeneratorSOO.hpp>
 
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
+#include <sgpp/optimization/operation/hash/HierarchisationFactorization.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisation.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineBoundary.hpp>
 #include <sgpp/optimization/operation/hash/OperationMultipleHierarchisationBsplineClenshawCurtis.hpp>
@@ -80,6 +81,7 @@
 #include <sgpp/optimization/sle/solver/Eigen.hpp>
 #include <sgpp/optimization/sle/solver/GaussianElimination.hpp>
 #include <sgpp/optimization/sle/solver/Gmmpp.hpp>
+#include <sgpp/optimization/sle/solver/LUDecomposition.hpp>
 #include <sgpp/optimization/sle/solver/SLESolver.hpp>
 #include <sgpp/optimization/sle/solver/UMFPACK.hpp>
 #include <sgpp/optimization/sle/system/CloneableSLE.hpp>
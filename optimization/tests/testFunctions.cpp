@@ -343,6 +343,37 @@ BOOST_AUTO_TEST_CASE(TestWrapperScalarFunction) {
   checkEqualFunction(f1, *f2Clone);
 }
 
+BOOST_AUTO_TEST_CASE(TestScalarFunctionEvalBatch) {
+  // Test default implementation of sgpp::optimization::ScalarFunction::evalBatch.
+  const size_t d = 3;
+  const size_t numberOfPoints = 50;
+  ScalarTestFunction f(d);
+  DataMatrix x(numberOfPoints, d);
+  DataVector fx(0);
+  DataVector xk(d);
+
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    for (size_t t = 0; t < d; t++) {
+      x(k, t) = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+  }
+
+  f.evalBatch(x, fx);
+  BOOST_CHECK_EQUAL(fx.getSize(), numberOfPoints);
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    x.getRow(k, xk);
+    BOOST_CHECK_EQUAL(fx[k], f.eval(xk));
+  }
+
+  // empty batch
+  x.resize(0, d);
+  f.evalBatch(x, fx);
+  BOOST_CHECK_EQUAL(fx.getSize(), 0U);
+}
+
 BOOST_AUTO_TEST_CASE(TestWrapperScalarFunctionGradient) {
   // Test sgpp::optimization::TestWrapperScalarFunctionGradient.
   const size_t d = 3;
@@ -7,16 +7,22 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/optimization/test_problems/unconstrained/Rosenbrock.hpp>
+#include <sgpp/optimization/gridgen/HashRefinementMultiple.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGeneratorRitterNovak.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGeneratorLinearSurplus.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGeneratorSOO.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "GridCreator.hpp"
 
+using sgpp::optimization::HashRefinementMultiple;
 using sgpp::optimization::IterativeGridGenerator;
 using sgpp::optimization::IterativeGridGeneratorLinearSurplus;
 using sgpp::optimization::IterativeGridGeneratorRitterNovak;
@@ -61,6 +67,10 @@ BOOST_AUTO_TEST_CASE(TestIterativeGridGenerators) {
       IterativeGridGeneratorRitterNovak::PowMethod::FAST_POW;
     gridGen.setPowMethod(powMethod);
     BOOST_CHECK_EQUAL(gridGen.getPowMethod(), powMethod);
+
+    const size_t batchSize = 7;
+    gridGen.setBatchSize(batchSize);
+    BOOST_CHECK_EQUAL(gridGen.getBatchSize(), batchSize);
   }
 
   {
@@ -94,6 +104,10 @@ BOOST_AUTO_TEST_CASE(TestIterativeGridGenerators) {
     // repeat for grid generators
     IterativeGridGeneratorRitterNovak gridGenRN(f, *grid, N, 0.85);
     IterativeGridGeneratorRitterNovak gridGenRNFastPow(f, *grid, N, 0.85);
+    IterativeGridGeneratorRitterNovak gridGenRNBatch(
+      f, *grid, N, 0.85, IterativeGridGeneratorRitterNovak::DEFAULT_INITIAL_LEVEL,
+      IterativeGridGeneratorRitterNovak::DEFAULT_MAX_LEVEL,
+      IterativeGridGeneratorRitterNovak::PowMethod::STD_POW, 5);
     IterativeGridGeneratorLinearSurplus gridGenLS(f, *grid, N, 0.85);
     IterativeGridGeneratorSOO gridGenSOO(f, *grid, N, 0.85);
 
@@ -101,7 +115,7 @@ BOOST_AUTO_TEST_CASE(TestIterativeGridGenerators) {
       IterativeGridGeneratorRitterNovak::PowMethod::FAST_POW);
 
     std::vector<IterativeGridGenerator*> gridGens = {
-      &gridGenRN, &gridGenRNFastPow, &gridGenLS, &gridGenSOO
+      &gridGenRN, &gridGenRNFastPow, &gridGenRNBatch, &gridGenLS, &gridGenSOO
     };
 
     for (auto& gridGen : gridGens) {
@@ -127,3 +141,212 @@ BOOST_AUTO_TEST_CASE(TestIterativeGridGenerators) {
     }
   }
 }
+
+/**
+ * Ritter-Novak grid generation as before the candidate queue: in each iteration, the criterion of
+ * all grid points is evaluated and the best one is refined with free_refine.
+ */
+class RitterNovakSequentialReference : public IterativeGridGeneratorRitterNovak {
+ public:
+  RitterNovakSequentialReference(ScalarFunction& f, sgpp::base::Grid& grid, size_t N,
+                                 double adaptivity, sgpp::base::level_t maxLevel)
+      : IterativeGridGeneratorRitterNovak(f, grid, N, adaptivity, DEFAULT_INITIAL_LEVEL,
+                                          maxLevel) {}
+
+  bool generate() override {
+    sgpp::base::GridStorage& gridStorage = grid.getStorage();
+    const size_t d = f.getNumberOfParameters();
+    HashRefinementMultiple refinement;
+
+    grid.getGenerator().regular(initialLevel);
+    size_t currentN = gridStorage.getSize();
+
+    sgpp::base::DataVector& fX = functionValues;
+    sgpp::base::DataVector fXSorted(currentN);
+    std::vector<size_t> fXOrder(currentN);
+
+    fX.resize(std::max(N, currentN));
+    fX.setAll(0.0);
+    std::vector<size_t> degree(fX.getSize(), 0);
+    std::vector<size_t> levelSum(fX.getSize(), 0);
+    std::vector<size_t> rank(fX.getSize(), 0);
+    std::vector<bool> ignore(fX.getSize(), false);
+    sgpp::base::DataVector refinementAlpha(currentN, 0.0);
+
+    for (size_t i = 0; i < currentN; i++) {
+      fXOrder[i] = i;
+      rank[i] = i + 1;
+
+      for (size_t t = 0; t < d; t++) {
+        levelSum[i] += gridStorage[i].getLevel(t);
+      }
+    }
+
+    evalFunction();
+
+    std::sort(fXOrder.begin(), fXOrder.begin() + currentN,
+              [&fX](size_t a, size_t b) { return (fX[a] < fX[b]); });
+    std::sort(rank.begin(), rank.begin() + currentN,
+              [&fXOrder](size_t a, size_t b) { return (fXOrder[a - 1] < fXOrder[b - 1]); });
+
+    for (size_t i = 0; i < currentN; i++) {
+      fXSorted[i] = fX[fXOrder[i]];
+    }
+
+    while (currentN < N) {
+      size_t iBest = 0;
+      double gBest = INFINITY;
+
+      for (size_t i = 0; i < currentN; i++) {
+        if (ignore[i]) {
+          continue;
+        }
+
+        const double g = std::pow(static_cast<double>(levelSum[i] + degree[i]) + 1.0, gamma) *
+                         std::pow(static_cast<double>(rank[i]) + 1.0, 1.0 - gamma);
+
+        if (g < gBest) {
+          // ignore the point if its children would be deeper than maxLevel
+          sgpp::base::GridPoint& gp = gridStorage[i];
+          sgpp::base::index_t sourceIndex, childIndex;
+          sgpp::base::level_t sourceLevel, childLevel;
+
+          for (size_t t = 0; (t < d) && !ignore[i]; t++) {
+            gp.get(t, sourceLevel, sourceIndex);
+
+            for (int direction : {-1, 1}) {
+              if ((sourceLevel == 0) && (sourceIndex != ((direction == -1) ? 1 : 0))) {
+                continue;
+              }
+
+              childIndex = sourceIndex;
+              childLevel = sourceLevel;
+
+              while (gridStorage.isContaining(gp)) {
+                childIndex *= 2;
+                childLevel++;
+                gp.set(t, childLevel, childIndex + direction);
+              }
+
+              gp.set(t, sourceLevel, sourceIndex);
+
+              if (childLevel > maxLevel) {
+                ignore[i] = true;
+                break;
+              }
+            }
+          }
+
+          if (!ignore[i]) {
+            iBest = i;
+            gBest = g;
+          }
+        }
+      }
+
+      degree[iBest]++;
+      refinementAlpha[iBest] = 1.0;
+      sgpp::base::SurplusRefinementFunctor refineFunc(refinementAlpha, 1);
+      refinement.free_refine(gridStorage, refineFunc);
+
+      const size_t newN = gridStorage.getSize();
+
+      if (newN == currentN) {
+        return false;
+      }
+
+      if (newN > N) {
+        undoRefinement(currentN);
+        break;
+      }
+
+      refinementAlpha.resize(newN);
+      refinementAlpha[iBest] = 0.0;
+
+      for (size_t i = currentN; i < newN; i++) {
+        refinementAlpha[i] = 0.0;
+
+        for (size_t t = 0; t < d; t++) {
+          levelSum[i] += gridStorage[i].getLevel(t);
+        }
+      }
+
+      evalFunction(currentN);
+
+      // update rank and fXOrder by insertion sort
+      for (size_t i = currentN; i < newN; i++) {
+        const double fXi = fX[i];
+
+        for (size_t j = i; j-- > 0;) {
+          if (fXSorted[j] < fXi) {
+            fXOrder.insert(fXOrder.begin() + (j + 1), i);
+            fXSorted.insert(j + 1, fXi);
+            rank[i] = j + 1;
+            break;
+          } else {
+            rank[fXOrder[j]]++;
+          }
+        }
+
+        if (fXOrder.size() == i) {
+          fXOrder.insert(fXOrder.begin(), i);
+          fXSorted.insert(0, fXi);
+          rank[i] = 0;
+        }
+      }
+
+      currentN = newN;
+    }
+
+    fX.resize(currentN);
+    return true;
+  }
+};
+
+BOOST_AUTO_TEST_CASE(TestRitterNovakSequentialReference) {
+  // With a batch size of one, the candidate queue must generate the same grids as the previous
+  // sequential refinement.
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 2;
+  const size_t p = 3;
+  const size_t N = 500;
+
+  Rosenbrock testProblem(d);
+  testProblem.generateDisplacement();
+  ScalarFunction& f = testProblem.getObjectiveFunction();
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  std::vector<std::unique_ptr<sgpp::base::Grid>> referenceGrids;
+  createSupportedGrids(d, p, grids);
+  createSupportedGrids(d, p, referenceGrids);
+
+  for (size_t k = 0; k < grids.size(); k++) {
+    // the small maximal level lets points be ignored
+    for (sgpp::base::level_t maxLevel : {sgpp::base::level_t(6),
+                                         IterativeGridGeneratorRitterNovak::DEFAULT_MAX_LEVEL}) {
+      sgpp::base::Grid& grid = *grids[k];
+      sgpp::base::Grid& referenceGrid = *referenceGrids[k];
+      grid.getStorage().clear();
+      referenceGrid.getStorage().clear();
+
+      IterativeGridGeneratorRitterNovak gridGen(
+          f, grid, N, 0.85, IterativeGridGeneratorRitterNovak::DEFAULT_INITIAL_LEVEL, maxLevel);
+      RitterNovakSequentialReference referenceGridGen(f, referenceGrid, N, 0.85, maxLevel);
+      BOOST_CHECK_EQUAL(gridGen.getBatchSize(), 1);
+      BOOST_CHECK(gridGen.generate());
+      BOOST_CHECK(referenceGridGen.generate());
+
+      // same points in the same order
+      const size_t n = grid.getSize();
+      BOOST_REQUIRE_EQUAL(n, referenceGrid.getSize());
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK(grid.getStorage()[i].equals(referenceGrid.getStorage()[i]));
+        BOOST_CHECK_EQUAL(gridGen.getFunctionValues()[i],
+                          referenceGridGen.getFunctionValues()[i]);
+      }
+    }
+  }
+}
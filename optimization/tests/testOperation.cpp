@@ -8,6 +8,9 @@
 
 #include <sgpp/optimization/test_problems/unconstrained/Sphere.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
+#include <sgpp/optimization/operation/hash/HierarchisationFactorization.hpp>
+#include <sgpp/optimization/sle/solver/Auto.hpp>
+#include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 #include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
@@ -15,6 +18,8 @@
 
 #include "GridCreator.hpp"
 
+using sgpp::optimization::HierarchisationFactorization;
+using sgpp::optimization::HierarchisationSLE;
 using sgpp::optimization::OperationMultipleHierarchisation;
 using sgpp::optimization::Printer;
 using sgpp::optimization::RandomNumberGenerator;
@@ -75,3 +80,91 @@ BOOST_AUTO_TEST_CASE(TestOperationMultipleHierarchisation) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationFactorization) {
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t d = 2;
+  const size_t p = 3;
+  const size_t l = 3;
+  const size_t m = 3;
+  const double tol = 1e-6;
+
+  Sphere testProblem(d);
+  ScalarFunction& f = testProblem.getObjectiveFunction();
+  sgpp::optimization::sle_solver::Auto solver;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGrids(d, p, grids);
+
+  for (auto& grid : grids) {
+    sgpp::base::DataVector functionValues(0);
+    testProblem.generateDisplacement();
+    HierarchisationFactorization factorization(*grid);
+    BOOST_CHECK(!factorization.isUpToDate());
+
+    for (size_t k = 0; k < 2; k++) {
+      // (re-)create the grid ==> factorization has to be recomputed
+      createSampleGrid(*grid, l + k, f, functionValues);
+      BOOST_CHECK(!factorization.isUpToDate());
+
+      // compare with solution of the hierarchisation system
+      HierarchisationSLE system(*grid);
+      sgpp::base::DataVector alpha(0);
+      BOOST_CHECK(solver.solve(system, functionValues, alpha));
+
+      sgpp::base::DataMatrix B(grid->getSize(), m);
+
+      for (size_t j = 0; j < m; j++) {
+        sgpp::base::DataVector column(functionValues);
+        column.mult(static_cast<double>(j + 1));
+        B.setColumn(j, column);
+      }
+
+      // second solve reuses the factorization
+      for (size_t t = 0; t < 2; t++) {
+        sgpp::base::DataVector alpha2(functionValues);
+        BOOST_CHECK(factorization.solve(alpha2));
+        BOOST_CHECK(factorization.isUpToDate());
+
+        sgpp::base::DataMatrix alphas(B);
+        BOOST_CHECK(factorization.solve(alphas));
+
+        for (size_t i = 0; i < grid->getSize(); i++) {
+          BOOST_CHECK_SMALL(alpha[i] - alpha2[i], tol);
+
+          for (size_t j = 0; j < m; j++) {
+            BOOST_CHECK_SMALL(static_cast<double>(j + 1) * alpha[i] - alphas(i, j), tol);
+          }
+        }
+      }
+
+      // all systems have been solved by the factorization
+      BOOST_CHECK_EQUAL(factorization.getNumberOfFallbacks(), 0U);
+
+      // concurrent calls on the same object (one of them refactorizes)
+      factorization.clear();
+      const size_t numberOfCalls = 4;
+      std::vector<sgpp::base::DataVector> concurrentAlphas(numberOfCalls, functionValues);
+      std::vector<int> success(numberOfCalls);
+
+#pragma omp parallel for num_threads(numberOfCalls)
+      for (size_t t = 0; t < numberOfCalls; t++) {
+        success[t] = factorization.solve(concurrentAlphas[t]);
+      }
+
+      for (size_t t = 0; t < numberOfCalls; t++) {
+        BOOST_CHECK(success[t]);
+
+        for (size_t i = 0; i < grid->getSize(); i++) {
+          BOOST_CHECK_SMALL(alpha[i] - concurrentAlphas[t][i], tol);
+        }
+      }
+    }
+
+    BOOST_CHECK_EQUAL(factorization.getNumberOfFallbacks(), 0U);
+    factorization.clear();
+    BOOST_CHECK(!factorization.isUpToDate());
+  }
+}
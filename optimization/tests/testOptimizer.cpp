@@ -5,6 +5,7 @@
 
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
+#include <omp.h>
 
 #include <sgpp/optimization/function/scalar/ScalarFunction.hpp>
 #include <sgpp/optimization/function/scalar/InterpolantScalarFunction.hpp>
@@ -31,7 +32,9 @@
 #include <sgpp/optimization/optimizer/constrained/LogBarrier.hpp>
 #include <sgpp/optimization/optimizer/constrained/SquaredPenalty.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
+#include <sgpp/optimization/tools/RandomNumberGenerator.hpp>
 
+#include <cmath>
 #include <vector>
 
 #include "CheckEqualFunction.hpp"
@@ -380,6 +383,108 @@ BOOST_AUTO_TEST_CASE(TestUnconstrainedOptimizers) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestInterpolantEvalBatch) {
+  // Test batch evaluation of sgpp::optimization::InterpolantScalarFunction.
+  Printer::getInstance().setVerbosity(-1);
+  sgpp::optimization::RandomNumberGenerator::getInstance().setSeed(42);
+
+  ExampleFunction f;
+  const size_t d = f.getNumberOfParameters();
+  const size_t p = 3;
+  const size_t l = 4;
+  const size_t numberOfPoints = 100;
+
+  std::vector<std::unique_ptr<sgpp::base::Grid>> grids;
+  createSupportedGrids(d, p, grids);
+
+  // some points are outside of the domain
+  sgpp::base::DataMatrix x(numberOfPoints, d);
+
+  for (size_t k = 0; k < numberOfPoints; k++) {
+    for (size_t t = 0; t < d; t++) {
+      x(k, t) = sgpp::optimization::RandomNumberGenerator::getInstance().getUniformRN(-0.1, 1.1);
+    }
+  }
+
+  for (auto& grid : grids) {
+    sgpp::base::DataVector alpha(0);
+    createSampleGrid(*grid, l, f, alpha);
+    std::unique_ptr<OperationMultipleHierarchisation> op(
+      sgpp::op_factory::createOperationMultipleHierarchisation(*grid));
+    op->doHierarchisation(alpha);
+    InterpolantScalarFunction ft(*grid, alpha);
+
+    sgpp::base::DataVector fx(0);
+    sgpp::base::DataVector xk(d);
+    ft.evalBatch(x, fx);
+    BOOST_CHECK_EQUAL(fx.getSize(), numberOfPoints);
+
+    for (size_t k = 0; k < numberOfPoints; k++) {
+      x.getRow(k, xk);
+      const double fxk = ft.eval(xk);
+
+      if (std::isinf(fxk)) {
+        BOOST_CHECK(std::isinf(fx[k]));
+      } else {
+        BOOST_CHECK_CLOSE(fx[k], fxk, 1e-8);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestPopulationOptimizersDeterministic) {
+  // Test that population-based optimizers yield the same results
+  // for the same seed, independently of the number of threads.
+  Printer::getInstance().setVerbosity(-1);
+
+  ExampleFunction f;
+  const size_t N = 1000;
+  const int maxNumberOfThreads = omp_get_max_threads();
+  const std::vector<int> numbersOfThreads = {1, 2, 4};
+
+  std::vector<std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>> optimizers;
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::DifferentialEvolution(f, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::CMAES(f, N)));
+  optimizers.push_back(std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>(
+                           new sgpp::optimization::optimizer::NelderMead(f, N)));
+
+  sgpp::base::DataVector x0(2);
+  x0[0] = 0.8;
+  x0[1] = 0.5;
+
+  for (auto& optimizer : optimizers) {
+    optimizer->setStartingPoint(x0);
+    sgpp::base::DataVector xOptReference(0);
+    double fOptReference = 0.0;
+
+    for (int numberOfThreads : numbersOfThreads) {
+      omp_set_num_threads(numberOfThreads);
+      sgpp::optimization::RandomNumberGenerator::getInstance().setSeed(42);
+      optimizer->optimize();
+      const sgpp::base::DataVector& xOpt = optimizer->getOptimalPoint();
+      const double fOpt = optimizer->getOptimalValue();
+
+      if (numberOfThreads == numbersOfThreads[0]) {
+        xOptReference = xOpt;
+        fOptReference = fOpt;
+        BOOST_CHECK_CLOSE(fOpt, -2.0, 1e-2);
+        continue;
+      }
+
+      BOOST_CHECK_EQUAL(fOpt, fOptReference);
+      BOOST_CHECK_EQUAL(xOpt.getSize(), xOptReference.getSize());
+
+      for (size_t t = 0; t < xOpt.getSize(); t++) {
+        BOOST_CHECK_EQUAL(xOpt[t], xOptReference[t]);
+      }
+    }
+  }
+
+  omp_set_num_threads(maxNumberOfThreads);
+}
+
 BOOST_AUTO_TEST_CASE(TestLeastSquaresOptimizers) {
   // Test least squares optimizers in sgpp::optimization::optimizer.
   Printer::getInstance().setVerbosity(-1);
@@ -13,6 +13,7 @@
 #include <sgpp/optimization/sle/solver/Eigen.hpp>
 #include <sgpp/optimization/sle/solver/GaussianElimination.hpp>
 #include <sgpp/optimization/sle/solver/Gmmpp.hpp>
+#include <sgpp/optimization/sle/solver/LUDecomposition.hpp>
 #include <sgpp/optimization/sle/solver/UMFPACK.hpp>
 #include <sgpp/optimization/sle/system/FullSLE.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
@@ -61,6 +62,33 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x,
   for (size_t i = 0; i < n; i++) {
     BOOST_CHECK_CLOSE(Ax[i], Ax2[i], 1e-10);
   }
+
+  // test getSparseMatrix (and thus getMatrixRow) and countNNZ
+  std::vector<size_t> rowPointers;
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
+  system.getSparseMatrix(rowPointers, columnIndices, values);
+  BOOST_CHECK_EQUAL(rowPointers.size(), n + 1);
+  BOOST_CHECK_EQUAL(system.countNNZ(), values.size());
+  size_t nnz = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    size_t k = rowPointers[i];
+
+    for (size_t j = 0; j < n; j++) {
+      if (A(i, j) != 0.0) {
+        nnz++;
+        BOOST_REQUIRE_LT(k, rowPointers[i + 1]);
+        BOOST_CHECK_EQUAL(columnIndices[k], j);
+        BOOST_CHECK_EQUAL(values[k], A(i, j));
+        k++;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(k, rowPointers[i + 1]);
+  }
+
+  BOOST_CHECK_EQUAL(values.size(), nnz);
 }
 
 void testSLESolution(const sgpp::base::DataMatrix& A,
@@ -101,6 +129,8 @@ BOOST_AUTO_TEST_CASE(TestSLESolvers) {
                                 new sgpp::optimization::sle_solver::GaussianElimination()));
   solvers.push_back(std::unique_ptr<sgpp::optimization::sle_solver::SLESolver>(
                                 new sgpp::optimization::sle_solver::Auto()));
+  solvers.push_back(std::unique_ptr<sgpp::optimization::sle_solver::SLESolver>(
+                                new sgpp::optimization::sle_solver::LUDecomposition()));
 
   // additional solvers if sgpp::opt was compiled with them
 #ifdef USE_ARMADILLO
@@ -199,6 +229,96 @@ BOOST_AUTO_TEST_CASE(TestSLESolvers) {
   }
 }
 
+/**
+ * Identity matrix, only the dimension is relevant.
+ */
+class IdentitySLE : public SLE {
+ public:
+  explicit IdentitySLE(size_t n) : n(n) {}
+
+  bool isMatrixEntryNonZero(size_t i, size_t j) override { return (i == j); }
+
+  double getMatrixEntry(size_t i, size_t j) override { return ((i == j) ? 1.0 : 0.0); }
+
+  size_t getDimension() const override { return n; }
+
+ protected:
+  size_t n;
+};
+
+BOOST_AUTO_TEST_CASE(TestLUDecomposition) {
+  // Test reusing the factorization of sgpp::optimization::sle_solver::LUDecomposition.
+  Printer::getInstance().setVerbosity(-1);
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  const size_t n = 50;
+  const size_t m = 7;
+
+  sgpp::base::DataMatrix A(n, n, 0.0);
+  sgpp::base::DataMatrix B(n, m);
+
+  // sparse matrix with zero diagonal entries to enforce pivoting
+  for (size_t i = 0; i < n; i++) {
+    A(i, (i + 1) % n) = RandomNumberGenerator::getInstance().getUniformRN(1.0, 2.0);
+    A(i, (3 * i) % n) += RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+
+    for (size_t j = 0; j < m; j++) {
+      B(i, j) = RandomNumberGenerator::getInstance().getUniformRN(-1.0, 1.0);
+    }
+  }
+
+  FullSLE system(A);
+  sgpp::optimization::sle_solver::LUDecomposition lu;
+  BOOST_CHECK(!lu.isFactorized());
+  BOOST_CHECK(!lu.solveFactorized(B, B));
+
+  BOOST_CHECK(lu.factorize(system));
+  BOOST_CHECK(lu.isFactorized());
+  BOOST_CHECK_EQUAL(lu.getDimension(), n);
+  BOOST_CHECK_GE(lu.getNumberOfNonZeros(), system.countNNZ());
+
+  // multiple RHSs at once (in-place)
+  sgpp::base::DataMatrix X(B);
+  BOOST_CHECK(lu.solveFactorized(X, X));
+  sgpp::base::DataVector x(n);
+  sgpp::base::DataVector b(n);
+
+  for (size_t j = 0; j < m; j++) {
+    X.getColumn(j, x);
+    B.getColumn(j, b);
+    testSLESolution(A, x, b);
+
+    // single RHS with the same factorization
+    sgpp::base::DataVector x2(0);
+    BOOST_CHECK(lu.solveFactorized(b, x2));
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_CLOSE(x[i], x2[i], 1e-10);
+    }
+  }
+
+  // wrong dimension
+  sgpp::base::DataVector b2(n + 1, 1.0);
+  BOOST_CHECK(!lu.solveFactorized(b2, x));
+
+  // singular matrix
+  A.setColumn(0, sgpp::base::DataVector(n, 0.0));
+  FullSLE singularSystem(A);
+  BOOST_CHECK(!lu.factorize(singularSystem));
+  BOOST_CHECK(!lu.isFactorized());
+
+  lu.clear();
+  BOOST_CHECK_EQUAL(lu.getDimension(), 0U);
+
+  // the dense working matrix limits the dimension
+  const size_t maxDim = sgpp::optimization::sle_solver::LUDecomposition::MAX_DIM;
+  IdentitySLE smallSystem(n);
+  BOOST_CHECK(lu.factorize(smallSystem));
+  IdentitySLE largeSystem(maxDim + 1);
+  BOOST_CHECK(!lu.factorize(largeSystem));
+  BOOST_CHECK(!lu.isFactorized());
+}
+
 BOOST_AUTO_TEST_CASE(TestFullSLE) {
   // Test sgpp::optimization::FullSLE.
   sgpp::base::DataMatrix A(3, 3, 0.0);
@@ -39,6 +39,11 @@ HeatEquationParabolicPDESolverSystem::HeatEquationParabolicPDESolverSystem(
   this->OpLaplaceInner = op_factory::createOperationLaplace(*this->InnerGrid);
   this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProduct(*this->InnerGrid);
 
+  this->OpLaplaceWithMassBound =
+      UpDownOneOpDim::getLaplaceWithMassSweeps(SparseGrid, this->OpLaplaceBound);
+  this->OpLaplaceWithMassInner =
+      UpDownOneOpDim::getLaplaceWithMassSweeps(*this->InnerGrid, this->OpLaplaceInner);
+
   // right hand side if System
   this->rhs = new sgpp::base::DataVector(1);
 }
@@ -109,6 +114,30 @@ void HeatEquationParabolicPDESolverSystem::applyLOperatorInner(sgpp::base::DataV
   result.axpy((-1.0) * this->a, temp);
 }
 
+void HeatEquationParabolicPDESolverSystem::applyMassMatrixAndLOperatorComplete(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lFactor) {
+  if (this->OpLaplaceWithMassBound == NULL) {
+    OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorComplete(alpha, result,
+                                                                                    lFactor);
+    return;
+  }
+
+  // the L-Operator is -a times the Laplacian
+  this->OpLaplaceWithMassBound->multWithMassMatrix(alpha, result, (-1.0) * this->a * lFactor);
+}
+
+void HeatEquationParabolicPDESolverSystem::applyMassMatrixAndLOperatorInner(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lFactor) {
+  if (this->OpLaplaceWithMassInner == NULL) {
+    OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorInner(alpha, result,
+                                                                                 lFactor);
+    return;
+  }
+
+  // the L-Operator is -a times the Laplacian
+  this->OpLaplaceWithMassInner->multWithMassMatrix(alpha, result, (-1.0) * this->a * lFactor);
+}
+
 void HeatEquationParabolicPDESolverSystem::finishTimestep() {
   // Replace the inner coefficients on the boundary grid
   this->GridConverter->updateBoundaryCoefs(*this->alpha_complete, *this->alpha_inner);
@@ -8,6 +8,7 @@
 
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
 #include <sgpp/pde/operation/hash/OperationParabolicPDESolverSystemDirichlet.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -33,6 +34,10 @@ class HeatEquationParabolicPDESolverSystem : public OperationParabolicPDESolverS
   sgpp::base::OperationMatrix* OpLaplaceInner;
   /// the LTwoDotProduct Operation (Mass Matrix), on inner grid
   sgpp::base::OperationMatrix* OpMassInner;
+  /// OpLaplaceBound if it can apply the mass matrix in the same traversal, NULL otherwise
+  UpDownOneOpDim* OpLaplaceWithMassBound;
+  /// OpLaplaceInner if it can apply the mass matrix in the same traversal, NULL otherwise
+  UpDownOneOpDim* OpLaplaceWithMassInner;
 
   void applyMassMatrixComplete(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
@@ -42,6 +47,12 @@ class HeatEquationParabolicPDESolverSystem : public OperationParabolicPDESolverS
 
   void applyLOperatorInner(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
+  void applyMassMatrixAndLOperatorComplete(sgpp::base::DataVector& alpha,
+                                           sgpp::base::DataVector& result, double lFactor);
+
+  void applyMassMatrixAndLOperatorInner(sgpp::base::DataVector& alpha,
+                                        sgpp::base::DataVector& result, double lFactor);
+
  public:
   /**
    * Std-Constructor
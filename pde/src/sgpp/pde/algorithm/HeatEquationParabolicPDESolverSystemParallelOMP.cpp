@@ -11,10 +11,6 @@
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 
 #include <vector>
@@ -48,6 +44,11 @@ HeatEquationParabolicPDESolverSystemParallelOMP::HeatEquationParabolicPDESolverS
   this->OpLaplaceInner = op_factory::createOperationLaplace(*this->InnerGrid);
   this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProduct(*this->InnerGrid);
 
+  this->OpLaplaceWithMassBound =
+      UpDownOneOpDim::getLaplaceWithMassSweeps(SparseGrid, this->OpLaplaceBound);
+  this->OpLaplaceWithMassInner =
+      UpDownOneOpDim::getLaplaceWithMassSweeps(*this->InnerGrid, this->OpLaplaceInner);
+
   // right hand side if System
   this->rhs = NULL;
 }
@@ -90,44 +91,30 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector temp(alpha.getSize());
-  temp.setAll(0.0);
-
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+
+  UpDownWorkspace workspace;
+  workspace.resetAccumulators();
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, algoDims, workspace)
     {
-      sgpp::base::DataVector myResult(result.getSize());
+      UpDownWorkspace::ScratchVector myResult(result.getSize());
 
       /// discuss methods in order to avoid this cast
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+          ->multParallelBuildingBlock(alpha, *myResult, algoDims[i]);
+
+      // summed without locks, see UpDownWorkspace
+      workspace.accumulate((-1.0) * this->a, *myResult);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
-
-  result.axpy((-1.0) * this->a, temp);
+  workspace.reduceAccumulators(result);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixInner(
@@ -145,44 +132,54 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
     sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector temp(alpha.getSize());
-  temp.setAll(0.0);
-
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+
+  UpDownWorkspace workspace;
+  workspace.resetAccumulators();
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, algoDims, workspace)
     {
-      sgpp::base::DataVector myResult(result.getSize());
+      UpDownWorkspace::ScratchVector myResult(result.getSize());
 
       /// discuss methods in order to avoid this cast
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
-          ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
-
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+          ->multParallelBuildingBlock(alpha, *myResult, algoDims[i]);
+
+      // summed without locks, see UpDownWorkspace
+      workspace.accumulate((-1.0) * this->a, *myResult);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  workspace.reduceAccumulators(result);
+}
+
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixAndLOperatorComplete(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lFactor) {
+  if (this->OpLaplaceWithMassBound == NULL) {
+    OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorComplete(alpha, result,
+                                                                                    lFactor);
+    return;
+  }
+
+  // the L-Operator is -a times the Laplacian
+  this->OpLaplaceWithMassBound->multWithMassMatrix(alpha, result, (-1.0) * this->a * lFactor);
+}
+
+void HeatEquationParabolicPDESolverSystemParallelOMP::applyMassMatrixAndLOperatorInner(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lFactor) {
+  if (this->OpLaplaceWithMassInner == NULL) {
+    OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorInner(alpha, result,
+                                                                                 lFactor);
+    return;
+  }
 
-  result.axpy((-1.0) * this->a, temp);
+  // the L-Operator is -a times the Laplacian
+  this->OpLaplaceWithMassInner->multWithMassMatrix(alpha, result, (-1.0) * this->a * lFactor);
 }
 
 void HeatEquationParabolicPDESolverSystemParallelOMP::finishTimestep() {
@@ -201,45 +198,9 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::mult(sgpp::base::DataVecto
   if (this->tOperationMode == "ExEul") {
     applyMassMatrixInner(alpha, result);
   } else if (this->tOperationMode == "ImEul") {
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
-
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
-
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result.add(temp);
-    result.axpy((-1.0) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorInner(alpha, result, (-1.0) * this->TimestepSize);
   } else if (this->tOperationMode == "CrNic") {
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
-
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
-
-#pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result.add(temp);
-    result.axpy((-0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorInner(alpha, result, (-0.5) * this->TimestepSize);
   } else {
     throw sgpp::base::algorithm_exception(
         " HeatEquationParabolicPDESolverSystemParallelOMP::mult : An unknown operation mode was "
@@ -253,26 +214,7 @@ sgpp::base::DataVector* HeatEquationParabolicPDESolverSystemParallelOMP::generat
   if (this->tOperationMode == "ExEul") {
     rhs_complete.setAll(0.0);
 
-    sgpp::base::DataVector temp(rhs_complete.getSize());
-    sgpp::base::DataVector temp2(rhs_complete.getSize());
-    sgpp::base::DataVector myAlpha(*this->alpha_complete);
-
-#pragma omp parallel shared(myAlpha, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(myAlpha, temp)
-        { applyMassMatrixComplete(myAlpha, temp); }
-
-#pragma omp task shared(myAlpha, temp2)
-        { applyLOperatorComplete(myAlpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    rhs_complete.add(temp);
-    rhs_complete.axpy(this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(*this->alpha_complete, rhs_complete, this->TimestepSize);
   } else if (this->tOperationMode == "ImEul") {
     rhs_complete.setAll(0.0);
 
@@ -280,26 +222,8 @@ sgpp::base::DataVector* HeatEquationParabolicPDESolverSystemParallelOMP::generat
   } else if (this->tOperationMode == "CrNic") {
     rhs_complete.setAll(0.0);
 
-    sgpp::base::DataVector temp(rhs_complete.getSize());
-    sgpp::base::DataVector temp2(rhs_complete.getSize());
-    sgpp::base::DataVector myAlpha(*this->alpha_complete);
-
-#pragma omp parallel shared(myAlpha, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(myAlpha, temp)
-        { applyMassMatrixComplete(myAlpha, temp); }
-
-#pragma omp task shared(myAlpha, temp2)
-        { applyLOperatorComplete(myAlpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    rhs_complete.add(temp);
-    rhs_complete.axpy((0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(*this->alpha_complete, rhs_complete,
+                                        (0.5) * this->TimestepSize);
   } else {
     throw sgpp::base::algorithm_exception(
         "HeatEquationParabolicPDESolverSystemParallelOMP::generateRHS : An unknown operation mode "
@@ -320,45 +244,9 @@ sgpp::base::DataVector* HeatEquationParabolicPDESolverSystemParallelOMP::generat
   if (this->tOperationMode == "ExEul") {
     applyMassMatrixComplete(alpha_bound, result_complete);
   } else if (this->tOperationMode == "ImEul") {
-    sgpp::base::DataVector temp(alpha_bound.getSize());
-    sgpp::base::DataVector temp2(alpha_bound.getSize());
-
-#pragma omp parallel shared(alpha_bound, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha_bound, temp)
-        { applyMassMatrixComplete(alpha_bound, temp); }
-
-#pragma omp task shared(alpha_bound, temp2)
-        { applyLOperatorComplete(alpha_bound, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result_complete.add(temp);
-    result_complete.axpy((-1.0) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(alpha_bound, result_complete, (-1.0) * this->TimestepSize);
   } else if (this->tOperationMode == "CrNic") {
-    sgpp::base::DataVector temp(alpha_bound.getSize());
-    sgpp::base::DataVector temp2(alpha_bound.getSize());
-
-#pragma omp parallel shared(alpha_bound, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha_bound, temp)
-        { applyMassMatrixComplete(alpha_bound, temp); }
-
-#pragma omp task shared(alpha_bound, temp2)
-        { applyLOperatorComplete(alpha_bound, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result_complete.add(temp);
-    result_complete.axpy((-0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(alpha_bound, result_complete, (-0.5) * this->TimestepSize);
   } else {
     throw sgpp::base::algorithm_exception(
         "HeatEquationParabolicPDESolverSystemParallelOMP::generateRHS : An unknown operation mode "
@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownWorkspace.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -79,31 +79,25 @@ void UpDownFourOpDims::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVec
 
 void UpDownFourOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
+  UpDownWorkspace workspace;
 
-#pragma omp parallel
+#pragma omp parallel shared(workspace)
   {
 #pragma omp single nowait
     {
+      workspace.resetAccumulators();
+
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
         for (size_t j = 0; j < this->numAlgoDims_; j++) {
           for (size_t k = 0; k < this->numAlgoDims_; k++) {
             for (size_t l = 0; l < this->numAlgoDims_; l++) {
-#pragma omp task firstprivate(i, j) shared(alpha, result)
+#pragma omp task firstprivate(i, j, k, l) shared(alpha, result, workspace)
               {
-                sgpp::base::DataVector beta(result.getSize());
-
-                if (this->coefs != NULL) {
-                  if (this->coefs[i][j][k][l] != 0.0) {
-                    this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
-
-#pragma omp critical
-                    { result.axpy(this->coefs[i][j][k][l], beta); }
-                  }
-                } else {
-                  this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
-
-#pragma omp critical
-                  { result.add(beta); }
+                if (this->coefs == NULL || this->coefs[i][j][k][l] != 0.0) {
+                  UpDownWorkspace::ScratchVector beta(result.getSize());
+                  this->updown(alpha, *beta, this->numAlgoDims_ - 1, i, j, k, l);
+                  workspace.accumulate((this->coefs != NULL) ? this->coefs[i][j][k][l] : 1.0,
+                                       *beta);
                 }
               }
             }
@@ -112,6 +106,8 @@ void UpDownFourOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
       }
 
 #pragma omp taskwait
+
+      workspace.reduceAccumulators(result);
     }
   }
 }
@@ -129,40 +125,40 @@ void UpDownFourOpDims::specialOpX(
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      (this->*pt2UpFunc)(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two, op_dim_three, op_dim_four);
+      (this->*pt2UpFunc)(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two, op_dim_three, op_dim_four);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two, op_dim_three, op_dim_four);
-      (this->*pt2DownFunc)(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two, op_dim_three, op_dim_four);
+      (this->*pt2DownFunc)(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     (this->*pt2UpFunc)(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    (this->*pt2DownFunc)(alpha, temp, this->algoDims[dim]);
+    (this->*pt2DownFunc)(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 
@@ -26,33 +26,28 @@ UpDownOneOpDim::~UpDownOneOpDim() {}
 
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
+  UpDownWorkspace workspace;
 
-#pragma omp parallel
+#pragma omp parallel shared(workspace)
   {
 #pragma omp single nowait
     {
+      workspace.resetAccumulators();
+
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
-#pragma omp task firstprivate(i) shared(alpha, result)
+#pragma omp task firstprivate(i) shared(alpha, result, workspace)
         {
-          sgpp::base::DataVector beta(result.getSize());
-
-          if (this->coefs != NULL) {
-            if (this->coefs->get(i) != 0.0) {
-              this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-              { result.axpy(this->coefs->get(i), beta); }
-            }
-          } else {
-            this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-            { result.add(beta); }
+          if (this->coefs == NULL || this->coefs->get(i) != 0.0) {
+            UpDownWorkspace::ScratchVector beta(result.getSize());
+            this->updown(alpha, *beta, this->numAlgoDims_ - 1, i);
+            workspace.accumulate((this->coefs != NULL) ? this->coefs->get(i) : 1.0, *beta);
           }
         }
       }
 
 #pragma omp taskwait
+
+      workspace.reduceAccumulators(result);
     }
   }
 }
@@ -62,18 +57,110 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                size_t operationDim) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector beta(result.getSize());
-
   if (this->coefs != NULL) {
     if (this->coefs->get(operationDim) != 0.0) {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+      UpDownWorkspace::ScratchVector beta(result.getSize());
+      this->updown(alpha, *beta, this->numAlgoDims_ - 1, operationDim);
+
+      result.axpy(this->coefs->get(operationDim), *beta);
+    }
+  } else {
+    this->updown(alpha, result, this->numAlgoDims_ - 1, operationDim);
+  }
+}
+
+UpDownOneOpDim* UpDownOneOpDim::getLaplaceWithMassSweeps(sgpp::base::Grid& grid,
+                                                         sgpp::base::OperationMatrix* opLaplace) {
+  sgpp::base::GridType type = grid.getType();
+
+  if (type == sgpp::base::GridType::Linear || type == sgpp::base::GridType::LinearL0Boundary ||
+      type == sgpp::base::GridType::LinearBoundary ||
+      type == sgpp::base::GridType::LinearStretched ||
+      type == sgpp::base::GridType::LinearStretchedBoundary) {
+    return dynamic_cast<UpDownOneOpDim*>(opLaplace);
+  }
+
+  return NULL;
+}
+
+void UpDownOneOpDim::multWithMassMatrix(sgpp::base::DataVector& alpha,
+                                        sgpp::base::DataVector& result, double operatorFactor) {
+#pragma omp parallel
+  {
+#pragma omp single nowait
+    { this->multWithMassMatrixParallelBuildingBlock(alpha, result, operatorFactor); }
+  }
+}
+
+void UpDownOneOpDim::multWithMassMatrixParallelBuildingBlock(sgpp::base::DataVector& alpha,
+                                                             sgpp::base::DataVector& result,
+                                                             double operatorFactor) {
+  result.setAll(0.0);
+
+  if (this->numAlgoDims_ == 0) {
+    result.add(alpha);
+    return;
+  }
 
-      result.axpy(this->coefs->get(operationDim), beta);
+  this->updownWithMassMatrix(alpha, result, this->numAlgoDims_ - 1, operatorFactor);
+}
+
+void UpDownOneOpDim::updownWithMassMatrix(sgpp::base::DataVector& alpha,
+                                          sgpp::base::DataVector& result, size_t dim,
+                                          double operatorFactor) {
+  size_t curNumAlgoDims = this->numAlgoDims_;
+  size_t curMaxParallelDims = this->maxParallelDims_;
+
+  // factor of the term with the special operation in dim, only up/down operations are left below
+  double factor = operatorFactor * ((this->coefs != NULL) ? this->coefs->get(dim) : 1.0);
+
+  // the mass term and the terms of the lower dimensions share the up/down in dim
+  if (dim > 0) {
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
+    {
+      up(alpha, *temp, this->algoDims[dim]);
+      updownWithMassMatrix(*temp, result, dim - 1, operatorFactor);
     }
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
+                                                                        result_temp)
+    {  // NOLINT(whitespace/braces)
+      updownWithMassMatrix(alpha, *temp_two, dim - 1, operatorFactor);
+      down(*temp_two, *result_temp, this->algoDims[dim]);
+
+      // temp_two is free again and holds the special operation's term
+      if (factor != 0.0) {
+        temp_two->setAll(0.0);
+        specialOP(alpha, *temp_two, dim, dim);
+        result_temp->axpy(factor, *temp_two);
+      }
+    }
+
+#pragma omp taskwait
+
+    result.add(*result_temp);
   } else {
-    this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDim);
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
+    up(alpha, result, this->algoDims[dim]);
 
-    result.add(beta);
+#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
+    down(alpha, *temp, this->algoDims[dim]);
+
+#pragma omp taskwait
+
+    result.add(*temp);
+
+    if (factor != 0.0) {
+      temp->setAll(0.0);
+      specialOP(alpha, *temp, dim, dim);
+      result.axpy(factor, *temp);
+    }
   }
 }
 
@@ -88,40 +175,40 @@ void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
     // Unidirectional scheme
     if (dim > 0) {
       // Reordering ups and downs
-      sgpp::base::DataVector temp(alpha.getSize());
-      sgpp::base::DataVector result_temp(alpha.getSize());
-      sgpp::base::DataVector temp_two(alpha.getSize());
+      UpDownWorkspace::ScratchVector temp(alpha.getSize());
+      UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+      UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
       {
-        up(alpha, temp, this->algoDims[dim]);
-        updown(temp, result, dim - 1, op_dim);
+        up(alpha, *temp, this->algoDims[dim]);
+        updown(*temp, result, dim - 1, op_dim);
       }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
       {  // NOLINT(whitespace/braces)
-        updown(alpha, temp_two, dim - 1, op_dim);
-        down(temp_two, result_temp, this->algoDims[dim]);
+        updown(alpha, *temp_two, dim - 1, op_dim);
+        down(*temp_two, *result_temp, this->algoDims[dim]);
       }
 
 #pragma omp taskwait
 
-      result.add(result_temp);
+      result.add(*result_temp);
     } else {
       // Terminates dimension recursion
-      sgpp::base::DataVector temp(alpha.getSize());
+      UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
       up(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-      down(alpha, temp, this->algoDims[dim]);
+      down(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-      result.add(temp);
+      result.add(*temp);
     }
   }
 }
@@ -134,40 +221,40 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDim(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim);
+      upOpDim(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim);
-      downOpDim(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim);
+      downOpDim(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDim(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDim(alpha, temp, this->algoDims[dim]);
+    downOpDim(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 }  // namespace pde
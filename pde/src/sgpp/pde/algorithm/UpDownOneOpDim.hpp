@@ -6,9 +6,11 @@
 #ifndef UPDOWNONEOPDIM_HPP
 #define UPDOWNONEOPDIM_HPP
 
+#include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownWorkspace.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -24,7 +26,9 @@ namespace pde {
 /**
  * Implements the Up/Down scheme with one dimension with a special operation
  *
- * Parallelization with OpenMP 2 / 3 is supported!
+ * Parallelization with OpenMP 2 / 3 is supported! The terms of the different dimensions are
+ * computed by concurrent tasks and summed without locks, temporary vectors are reused between
+ * applications (see UpDownWorkspace).
  *
  */
 class UpDownOneOpDim : public sgpp::base::OperationMatrix {
@@ -74,6 +78,46 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   void multParallelBuildingBlock(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                  size_t operationDim);
 
+  /**
+   * Calculates (M + operatorFactor * A) * alpha, where A is this operator and M is the operator
+   * that applies the up/down operations in all dimensions, i.e. the mass matrix for the linear
+   * Laplace operators. Both are computed in one recursion: the terms whose special dimension
+   * has not been reached yet share their up/down operations with M, so fewer sweeps and no
+   * separate result vectors are needed.
+   *
+   * Parabolic PDE solvers use this to apply the system matrix of implicit time steps.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param operatorFactor factor of this operator
+   */
+  void multWithMassMatrix(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                          double operatorFactor);
+
+  /**
+   * Same as multWithMassMatrix, but without the OpenMP task initialization, see
+   * multParallelBuildingBlock.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param operatorFactor factor of this operator
+   */
+  void multWithMassMatrixParallelBuildingBlock(sgpp::base::DataVector& alpha,
+                                               sgpp::base::DataVector& result,
+                                               double operatorFactor);
+
+  /**
+   * For the linear grid types, the up/down operations of the Laplace operator are the ones of the
+   * mass matrix created by op_factory::createOperationLTwoDotProduct, hence both can be applied in
+   * one traversal by multWithMassMatrix.
+   *
+   * @param grid the grid the Laplace operator was created for
+   * @param opLaplace Laplace operator created by op_factory::createOperationLaplace
+   * @return opLaplace if multWithMassMatrix applies the mass matrix of grid, NULL otherwise
+   */
+  static UpDownOneOpDim* getLaplaceWithMassSweeps(sgpp::base::Grid& grid,
+                                                  sgpp::base::OperationMatrix* opLaplace);
+
  protected:
   typedef sgpp::base::GridStorage::grid_iterator grid_iterator;
 
@@ -99,6 +143,19 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   void updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
               size_t op_dim);
 
+  /**
+   * Recursive procedure for multWithMassMatrix(): applies the up/down operations for the
+   * dimensions 0, ..., dim and adds operatorFactor times the terms whose special dimension is
+   * one of them.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param dim the current dimension
+   * @param operatorFactor factor of the special operation terms
+   */
+  void updownWithMassMatrix(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                            size_t dim, double operatorFactor);
+
   /**
    * All calculations for gradient_dim, parallel version using OpenMP 3
    *
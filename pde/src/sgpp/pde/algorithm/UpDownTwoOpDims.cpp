@@ -26,31 +26,24 @@ UpDownTwoOpDims::~UpDownTwoOpDims() {}
 
 void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
+  UpDownWorkspace workspace;
 
-#pragma omp parallel
+#pragma omp parallel shared(workspace)
   {
 #pragma omp single nowait
     {
+      workspace.resetAccumulators();
+
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
         for (size_t j = 0; j < this->numAlgoDims_; j++) {
           // use the operator's symmetry
           if (j <= i) {
-#pragma omp task firstprivate(i, j) shared(alpha, result)
+#pragma omp task firstprivate(i, j) shared(alpha, result, workspace)
             {
-              sgpp::base::DataVector beta(result.getSize());
-
-              if (this->coefs != NULL) {
-                if (this->coefs->get(i, j) != 0.0) {
-                  this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                  { result.axpy(this->coefs->get(i, j), beta); }
-                }
-              } else {
-                this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                { result.add(beta); }
+              if (this->coefs == NULL || this->coefs->get(i, j) != 0.0) {
+                UpDownWorkspace::ScratchVector beta(result.getSize());
+                this->updown(alpha, *beta, this->numAlgoDims_ - 1, i, j);
+                workspace.accumulate((this->coefs != NULL) ? this->coefs->get(i, j) : 1.0, *beta);
               }
             }
           }
@@ -58,6 +51,8 @@ void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector
       }
 
 #pragma omp taskwait
+
+      workspace.reduceAccumulators(result);
     }
   }
 }
@@ -66,18 +61,17 @@ void UpDownTwoOpDims::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                 sgpp::base::DataVector& result,
                                                 size_t operationDimOne, size_t operationDimTwo) {
   result.setAll(0.0);
-  sgpp::base::DataVector beta(result.getSize());
 
   // use the operator's symmetry
   if (operationDimTwo <= operationDimOne) {
     if (this->coefs != NULL) {
       if (this->coefs->get(operationDimOne, operationDimTwo) != 0.0) {
-        this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
-        result.axpy(this->coefs->get(operationDimOne, operationDimTwo), beta);
+        UpDownWorkspace::ScratchVector beta(result.getSize());
+        this->updown(alpha, *beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
+        result.axpy(this->coefs->get(operationDimOne, operationDimTwo), *beta);
       }
     } else {
-      this->updown(alpha, beta, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
-      result.add(beta);
+      this->updown(alpha, result, this->numAlgoDims_ - 1, operationDimOne, operationDimTwo);
     }
   }
 }
@@ -101,40 +95,40 @@ void UpDownTwoOpDims::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVect
     // Unidirectional scheme
     if (dim > 0) {
       // Reordering ups and downs
-      sgpp::base::DataVector temp(alpha.getSize());
-      sgpp::base::DataVector result_temp(alpha.getSize());
-      sgpp::base::DataVector temp_two(alpha.getSize());
+      UpDownWorkspace::ScratchVector temp(alpha.getSize());
+      UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+      UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
       {
-        up(alpha, temp, this->algoDims[dim]);
-        updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+        up(alpha, *temp, this->algoDims[dim]);
+        updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
       }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
       {  // NOLINT(whitespace/braces)
-        updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-        down(temp_two, result_temp, this->algoDims[dim]);
+        updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+        down(*temp_two, *result_temp, this->algoDims[dim]);
       }
 
 #pragma omp taskwait
 
-      result.add(result_temp);
+      result.add(*result_temp);
     } else {
       // Terminates dimension recursion
-      sgpp::base::DataVector temp(alpha.getSize());
+      UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
       up(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-      down(alpha, temp, this->algoDims[dim]);
+      down(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-      result.add(temp);
+      result.add(*temp);
     }
   }
 }
@@ -147,40 +141,40 @@ void UpDownTwoOpDims::specialOpOne(sgpp::base::DataVector& alpha, sgpp::base::Da
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDimOne(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+      upOpDimOne(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-      downOpDimOne(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+      downOpDimOne(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDimOne(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDimOne(alpha, temp, this->algoDims[dim]);
+    downOpDimOne(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 
@@ -192,40 +186,40 @@ void UpDownTwoOpDims::specialOpTwo(sgpp::base::DataVector& alpha, sgpp::base::Da
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDimTwo(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+      upOpDimTwo(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-      downOpDimTwo(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+      downOpDimTwo(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDimTwo(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDimTwo(alpha, temp, this->algoDims[dim]);
+    downOpDimTwo(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 
@@ -238,40 +232,40 @@ void UpDownTwoOpDims::specialOpOneAndOpTwo(sgpp::base::DataVector& alpha,
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector result_temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp_two(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDimOneAndOpDimTwo(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim_one, op_dim_two);
+      upOpDimOneAndOpDimTwo(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim_one, op_dim_two);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim_one, op_dim_two);
-      downOpDimOneAndOpDimTwo(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim_one, op_dim_two);
+      downOpDimOneAndOpDimTwo(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDimOneAndOpDimTwo(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDimOneAndOpDimTwo(alpha, temp, this->algoDims[dim]);
+    downOpDimOneAndOpDimTwo(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 }  // namespace pde
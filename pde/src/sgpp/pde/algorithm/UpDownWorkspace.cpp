@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownWorkspace.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+namespace {
+
+size_t currentThread() {
+#ifdef _OPENMP
+  return static_cast<size_t>(omp_get_thread_num());
+#else
+  return 0;
+#endif
+}
+
+/// maximal number of unused scratch vectors kept per thread
+const size_t maxPoolSize = 16;
+
+/// unused scratch vectors of the current thread, all of the same size
+std::vector<std::unique_ptr<sgpp::base::DataVector>>& threadPool() {
+  thread_local std::vector<std::unique_ptr<sgpp::base::DataVector>> pool;
+  return pool;
+}
+
+size_t currentNumThreads() {
+#ifdef _OPENMP
+  return static_cast<size_t>(omp_get_num_threads());
+#else
+  return 1;
+#endif
+}
+
+}  // namespace
+
+UpDownWorkspace::ScratchVector::ScratchVector(size_t size) {
+  std::vector<std::unique_ptr<sgpp::base::DataVector>>& pool = threadPool();
+
+  // vectors of another size belong to a previous grid and are released
+  if (!pool.empty() && (pool.back()->getSize() != size)) {
+    pool.clear();
+  }
+
+  if (pool.empty()) {
+    vector.reset(new sgpp::base::DataVector(size));
+    return;
+  }
+
+  vector = std::move(pool.back());
+  pool.pop_back();
+  vector->setAll(0.0);
+}
+
+UpDownWorkspace::ScratchVector::~ScratchVector() {
+  std::vector<std::unique_ptr<sgpp::base::DataVector>>& pool = threadPool();
+
+  if (!pool.empty() && (pool.back()->getSize() != vector->getSize())) {
+    pool.clear();
+  }
+
+  if (pool.size() < maxPoolSize) {
+    pool.push_back(std::move(vector));
+  }
+}
+
+UpDownWorkspace::UpDownWorkspace() {}
+
+UpDownWorkspace::~UpDownWorkspace() {}
+
+void UpDownWorkspace::resetAccumulators() {
+  size_t numThreads = currentNumThreads();
+
+  if (accumulators.size() < numThreads) {
+    accumulators.resize(numThreads);
+  }
+
+  accumulatorUsed.assign(accumulators.size(), 0);
+}
+
+void UpDownWorkspace::accumulate(double factor, sgpp::base::DataVector& term) {
+  size_t thread = currentThread();
+  sgpp::base::DataVector& accumulator = accumulators[thread];
+
+  if (accumulatorUsed[thread]) {
+    accumulator.axpy(factor, term);
+  } else {
+    accumulator.resize(term.getSize());
+
+    for (size_t i = 0; i < term.getSize(); i++) {
+      accumulator[i] = factor * term[i];
+    }
+
+    accumulatorUsed[thread] = 1;
+  }
+}
+
+void UpDownWorkspace::reduceAccumulators(sgpp::base::DataVector& result) {
+  std::vector<double*> used;
+
+  for (size_t t = 0; t < accumulators.size(); t++) {
+    if (accumulatorUsed[t]) {
+      used.push_back(accumulators[t].getPointer());
+    }
+  }
+
+  if (used.empty()) {
+    return;
+  }
+
+  size_t size = result.getSize();
+  size_t numChunks = std::max<size_t>(std::min<size_t>(4 * currentNumThreads(), size), 1);
+  double* resultData = result.getPointer();
+
+  for (size_t chunk = 0; chunk < numChunks; chunk++) {
+#pragma omp task firstprivate(chunk) shared(used, resultData)
+    {
+      for (size_t i = chunk * size / numChunks; i < (chunk + 1) * size / numChunks; i++) {
+        double sum = resultData[i];
+
+        for (size_t t = 0; t < used.size(); t++) {
+          sum += used[t][i];
+        }
+
+        resultData[i] = sum;
+      }
+    }
+  }
+
+#pragma omp taskwait
+}
+
+}  // namespace pde
+}  // namespace sgpp
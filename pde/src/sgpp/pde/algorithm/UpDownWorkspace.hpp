@@ -0,0 +1,106 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNWORKSPACE_HPP
+#define UPDOWNWORKSPACE_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Reusable memory for the task-parallel Up/Down operators.
+ *
+ * Temporary vectors (ScratchVector) are taken from a pool of the calling thread instead of being
+ * allocated for every operator application. The pools are thread-local, so concurrent
+ * applications of the same operator never share a vector. A pool keeps at most 16 vectors, all
+ * of the size last requested; the vectors of a previous grid are released as soon as a vector of
+ * a different size is requested or given back.
+ *
+ * The terms that are computed by concurrent tasks (e.g. one term per dimension in
+ * UpDownOneOpDim::mult) are summed in one accumulator per thread of a workspace, which are
+ * combined by a chunked, task-parallel reduction afterwards. Hence, no locks are needed. A
+ * workspace is created for each operator application and relies on OpenMP tasks being tied to the
+ * thread that started them, which is the default.
+ */
+class UpDownWorkspace {
+ public:
+  /**
+   * Scratch vector that is taken from the pool of the current thread on construction and given
+   * back on destruction. The vector is initialized with zeros.
+   */
+  class ScratchVector {
+   public:
+    /**
+     * Constructor
+     *
+     * @param size size of the vector
+     */
+    explicit ScratchVector(size_t size);
+
+    /**
+     * Destructor, gives the vector back to the pool
+     */
+    ~ScratchVector();
+
+    ScratchVector(const ScratchVector&) = delete;
+    ScratchVector& operator=(const ScratchVector&) = delete;
+
+    sgpp::base::DataVector& operator*() { return *vector; }
+    sgpp::base::DataVector* operator->() { return vector.get(); }
+
+   private:
+    std::unique_ptr<sgpp::base::DataVector> vector;
+  };
+
+  /**
+   * Constructor
+   */
+  UpDownWorkspace();
+
+  /**
+   * Destructor
+   */
+  ~UpDownWorkspace();
+
+  /**
+   * Discards the accumulated terms and prepares one accumulator per thread of the current team.
+   * This has to be called before the tasks calling accumulate() are created.
+   */
+  void resetAccumulators();
+
+  /**
+   * Adds factor * term to the accumulator of the current thread.
+   *
+   * @param factor scaling factor of the term
+   * @param term the term that is added
+   */
+  void accumulate(double factor, sgpp::base::DataVector& term);
+
+  /**
+   * Adds the sum of all accumulators to result. The entries of result are distributed to OpenMP
+   * tasks in chunks; the accumulators are summed in a fixed order.
+   *
+   * @param result vector the accumulated terms are added to
+   */
+  void reduceAccumulators(sgpp::base::DataVector& result);
+
+ private:
+  /// one accumulator per thread
+  std::vector<sgpp::base::DataVector> accumulators;
+  /// whether a term has been added to the accumulator since the last reset
+  std::vector<char> accumulatorUsed;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNWORKSPACE_HPP */
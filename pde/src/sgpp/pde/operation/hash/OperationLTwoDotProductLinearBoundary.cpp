@@ -27,7 +27,7 @@ void OperationLTwoDotProductLinearBoundary::up(sgpp::base::DataVector& alpha,
   PhiPhiUpBBLinearBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
 
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 
 void OperationLTwoDotProductLinearBoundary::down(sgpp::base::DataVector& alpha,
@@ -36,7 +36,7 @@ void OperationLTwoDotProductLinearBoundary::down(sgpp::base::DataVector& alpha,
   PhiPhiDownBBLinearBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
 
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 }  // namespace pde
 }  // namespace sgpp
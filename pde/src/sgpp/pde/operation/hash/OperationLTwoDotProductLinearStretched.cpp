@@ -27,7 +27,7 @@ void OperationLTwoDotProductLinearStretched::up(sgpp::base::DataVector& alpha,
   PhiPhiUpBBLinearStretched func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearStretched> s(func, *this->storage);
 
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLTwoDotProductLinearStretched::down(sgpp::base::DataVector& alpha,
@@ -36,7 +36,7 @@ void OperationLTwoDotProductLinearStretched::down(sgpp::base::DataVector& alpha,
   PhiPhiDownBBLinearStretched func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearStretched> s(func, *this->storage);
 
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 }  // namespace pde
 }  // namespace sgpp
@@ -90,9 +90,9 @@ void OperationLaplaceExplicitLinear::specialOP(sgpp::base::DataVector& alpha,
   // In direction gradient_dim we only calculate the norm of the gradient
   // The up-part is empty, thus omitted
   if (dim > 0) {
-    sgpp::base::DataVector temp(alpha.getSize());
-    updown(alpha, temp, dim - 1, gradient_dim);
-    downOpDim(temp, result, gradient_dim);
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    updown(alpha, *temp, dim - 1, gradient_dim);
+    downOpDim(*temp, result, gradient_dim);
   } else {
     // Terminates dimension recursion
     downOpDim(alpha, result, gradient_dim);
@@ -32,9 +32,9 @@ void OperationLaplaceLinear::specialOP(sgpp::base::DataVector& alpha,
   // In direction gradient_dim we only calculate the norm of the gradient
   // The up-part is empty, thus omitted
   if (dim > 0) {
-    sgpp::base::DataVector temp(alpha.getSize());
-    updown(alpha, temp, dim - 1, gradient_dim);
-    downOpDim(temp, result, gradient_dim);
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    updown(alpha, *temp, dim - 1, gradient_dim);
+    downOpDim(*temp, result, gradient_dim);
   } else {
     // Terminates dimension recursion
     downOpDim(alpha, result, gradient_dim);
@@ -45,14 +45,14 @@ void OperationLaplaceLinear::up(sgpp::base::DataVector& alpha, sgpp::base::DataV
                                 size_t dim) {
   PhiPhiUpBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinear::down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
                                   size_t dim) {
   PhiPhiDownBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinear::downOpDim(sgpp::base::DataVector& alpha,
@@ -28,9 +28,9 @@ void OperationLaplaceLinearStretched::specialOP(sgpp::base::DataVector& alpha,
   // In direction gradient_dim we only calculate the norm of the gradient
   // The up-part is empty, thus omitted
   if (dim > 0) {
-    sgpp::base::DataVector temp(alpha.getSize());
-    updown(alpha, temp, dim - 1, gradient_dim);
-    downOpDim(temp, result, gradient_dim);
+    UpDownWorkspace::ScratchVector temp(alpha.getSize());
+    updown(alpha, *temp, dim - 1, gradient_dim);
+    downOpDim(*temp, result, gradient_dim);
   } else {
     // Terminates dimension recursion
     downOpDim(alpha, result, gradient_dim);
@@ -41,14 +41,14 @@ void OperationLaplaceLinearStretched::up(sgpp::base::DataVector& alpha,
                                          sgpp::base::DataVector& result, size_t dim) {
   PhiPhiUpBBLinearStretched func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearStretched> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearStretched::down(sgpp::base::DataVector& alpha,
                                            sgpp::base::DataVector& result, size_t dim) {
   PhiPhiDownBBLinearStretched func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearStretched> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearStretched::downOpDim(sgpp::base::DataVector& alpha,
@@ -27,7 +27,7 @@ void OperationLaplaceModLinear::up(sgpp::base::DataVector& alpha, sgpp::base::Da
   result.setAll(0.0);
   PhiPhiUpModLinear func(this->storage);
   sgpp::base::sweep<PhiPhiUpModLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceModLinear::down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
@@ -35,7 +35,7 @@ void OperationLaplaceModLinear::down(sgpp::base::DataVector& alpha, sgpp::base::
   result.setAll(0.0);
   PhiPhiDownModLinear func(this->storage);
   sgpp::base::sweep<PhiPhiDownModLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceModLinear::downOpDim(sgpp::base::DataVector& alpha,
@@ -43,7 +43,7 @@ void OperationLaplaceModLinear::downOpDim(sgpp::base::DataVector& alpha,
   result.setAll(0.0);
   dPhidPhiDownModLinear func(this->storage);
   sgpp::base::sweep<dPhidPhiDownModLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceModLinear::upOpDim(sgpp::base::DataVector& alpha,
@@ -51,7 +51,7 @@ void OperationLaplaceModLinear::upOpDim(sgpp::base::DataVector& alpha,
   result.setAll(0.0);
   dPhidPhiUpModLinear func(this->storage);
   sgpp::base::sweep<dPhidPhiUpModLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 }  // namespace pde
 }  // namespace sgpp
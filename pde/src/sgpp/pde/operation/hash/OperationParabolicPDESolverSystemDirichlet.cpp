@@ -18,56 +18,68 @@ OperationParabolicPDESolverSystemDirichlet::OperationParabolicPDESolverSystemDir
 
 OperationParabolicPDESolverSystemDirichlet::~OperationParabolicPDESolverSystemDirichlet() {}
 
-void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& alpha,
-                                                      sgpp::base::DataVector& result) {
-  result.setAll(0.0);
-
-  if (this->tOperationMode == "ExEul") {
-    applyMassMatrixInner(alpha, result);
-  } else if (this->tOperationMode == "ImEul") {
-    result.setAll(0.0);
-
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
+void OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorComplete(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lFactor) {
+  sgpp::base::DataVector temp(result.getSize());
+  sgpp::base::DataVector temp2(result.getSize());
 
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
+#pragma omp parallel shared(alpha, temp, temp2)
+  {
 #pragma omp single nowait
-      {
+    {
 #pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
+      { applyMassMatrixComplete(alpha, temp); }
 
 #pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
+      { applyLOperatorComplete(alpha, temp2); }
 
 #pragma omp taskwait
-      }
     }
+  }
 
-    result.add(temp);
-    result.axpy((-1.0) * this->TimestepSize, temp2);
-  } else if (this->tOperationMode == "CrNic") {
-    result.setAll(0.0);
+  result.setAll(0.0);
+  result.add(temp);
+  result.axpy(lFactor, temp2);
+}
 
-    sgpp::base::DataVector temp(result.getSize());
-    sgpp::base::DataVector temp2(result.getSize());
+void OperationParabolicPDESolverSystemDirichlet::applyMassMatrixAndLOperatorInner(
+    sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, double lFactor) {
+  sgpp::base::DataVector temp(result.getSize());
+  sgpp::base::DataVector temp2(result.getSize());
 
-#pragma omp parallel shared(alpha, result, temp, temp2)
-    {
+#pragma omp parallel shared(alpha, temp, temp2)
+  {
 #pragma omp single nowait
-      {
+    {
 #pragma omp task shared(alpha, temp)
-        { applyMassMatrixInner(alpha, temp); }
+      { applyMassMatrixInner(alpha, temp); }
 
 #pragma omp task shared(alpha, temp2)
-        { applyLOperatorInner(alpha, temp2); }
+      { applyLOperatorInner(alpha, temp2); }
 
 #pragma omp taskwait
-      }
     }
+  }
 
-    result.add(temp);
-    result.axpy((-0.5) * this->TimestepSize, temp2);
+  result.setAll(0.0);
+  result.add(temp);
+  result.axpy(lFactor, temp2);
+}
+
+void OperationParabolicPDESolverSystemDirichlet::mult(sgpp::base::DataVector& alpha,
+                                                      sgpp::base::DataVector& result) {
+  result.setAll(0.0);
+
+  if (this->tOperationMode == "ExEul") {
+    applyMassMatrixInner(alpha, result);
+  } else if (this->tOperationMode == "ImEul") {
+    result.setAll(0.0);
+
+    applyMassMatrixAndLOperatorInner(alpha, result, (-1.0) * this->TimestepSize);
+  } else if (this->tOperationMode == "CrNic") {
+    result.setAll(0.0);
+
+    applyMassMatrixAndLOperatorInner(alpha, result, (-0.5) * this->TimestepSize);
   } else if (this->tOperationMode == "AdBas" || this->tOperationMode == "AdBasC") {
     result.setAll(0.0);
 
@@ -108,26 +120,7 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS(
   if (this->tOperationMode == "ExEul") {
     rhs_complete.setAll(0.0);
 
-    sgpp::base::DataVector temp(rhs_complete.getSize());
-    sgpp::base::DataVector temp2(rhs_complete.getSize());
-    sgpp::base::DataVector myAlpha(*this->alpha_complete);
-
-#pragma omp parallel shared(myAlpha, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(myAlpha, temp)
-        { applyMassMatrixComplete(myAlpha, temp); }
-
-#pragma omp task shared(myAlpha, temp2)
-        { applyLOperatorComplete(myAlpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    rhs_complete.add(temp);
-    rhs_complete.axpy(this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(*this->alpha_complete, rhs_complete, this->TimestepSize);
   } else if (this->tOperationMode == "ImEul") {
     rhs_complete.setAll(0.0);
 
@@ -135,26 +128,8 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS(
   } else if (this->tOperationMode == "CrNic") {
     rhs_complete.setAll(0.0);
 
-    sgpp::base::DataVector temp(rhs_complete.getSize());
-    sgpp::base::DataVector temp2(rhs_complete.getSize());
-    sgpp::base::DataVector myAlpha(*this->alpha_complete);
-
-#pragma omp parallel shared(myAlpha, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(myAlpha, temp)
-        { applyMassMatrixComplete(myAlpha, temp); }
-
-#pragma omp task shared(myAlpha, temp2)
-        { applyLOperatorComplete(myAlpha, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    rhs_complete.add(temp);
-    rhs_complete.axpy((0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(*this->alpha_complete, rhs_complete,
+                                        (0.5) * this->TimestepSize);
   } else if (this->tOperationMode == "AdBas") {
     rhs_complete.setAll(0.0);
 
@@ -364,45 +339,9 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::generateRHS(
   if (this->tOperationMode == "ExEul") {
     applyMassMatrixComplete(alpha_bound, result_complete);
   } else if (this->tOperationMode == "ImEul") {
-    sgpp::base::DataVector temp(alpha_bound.getSize());
-    sgpp::base::DataVector temp2(alpha_bound.getSize());
-
-#pragma omp parallel shared(alpha_bound, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha_bound, temp)
-        { applyMassMatrixComplete(alpha_bound, temp); }
-
-#pragma omp task shared(alpha_bound, temp2)
-        { applyLOperatorComplete(alpha_bound, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result_complete.add(temp);
-    result_complete.axpy((-1.0) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(alpha_bound, result_complete, (-1.0) * this->TimestepSize);
   } else if (this->tOperationMode == "CrNic") {
-    sgpp::base::DataVector temp(alpha_bound.getSize());
-    sgpp::base::DataVector temp2(alpha_bound.getSize());
-
-#pragma omp parallel shared(alpha_bound, temp, temp2)
-    {
-#pragma omp single nowait
-      {
-#pragma omp task shared(alpha_bound, temp)
-        { applyMassMatrixComplete(alpha_bound, temp); }
-
-#pragma omp task shared(alpha_bound, temp2)
-        { applyLOperatorComplete(alpha_bound, temp2); }
-
-#pragma omp taskwait
-      }
-    }
-
-    result_complete.add(temp);
-    result_complete.axpy((-0.5) * this->TimestepSize, temp2);
+    applyMassMatrixAndLOperatorComplete(alpha_bound, result_complete, (-0.5) * this->TimestepSize);
   } else if (this->tOperationMode == "AdBas" || this->tOperationMode == "AdBasC") {
     applyMassMatrixComplete(alpha_bound, result_complete);
   } else if (this->tOperationMode == "MPR") {
@@ -82,6 +82,29 @@ class OperationParabolicPDESolverSystemDirichlet
   virtual void applyLOperatorInner(sgpp::base::DataVector& alpha,
                                    sgpp::base::DataVector& result) = 0;
 
+  /**
+   * applies the mass matrix plus a multiple of the system matrix, on complete grid - with
+   * boundaries. The default implementation applies both operators in parallel tasks and adds
+   * the results, derived classes may apply both in one traversal of the grid.
+   *
+   * @param alpha the coefficients of the sparse grid's ansatzfunctions
+   * @param result reference to the sgpp::base::DataVector into which the result is written
+   * @param lFactor factor of the system matrix
+   */
+  virtual void applyMassMatrixAndLOperatorComplete(sgpp::base::DataVector& alpha,
+                                                   sgpp::base::DataVector& result, double lFactor);
+
+  /**
+   * applies the mass matrix plus a multiple of the system matrix, on inner grid only,
+   * see applyMassMatrixAndLOperatorComplete
+   *
+   * @param alpha the coefficients of the sparse grid's ansatzfunctions
+   * @param result reference to the sgpp::base::DataVector into which the result is written
+   * @param lFactor factor of the system matrix
+   */
+  virtual void applyMassMatrixAndLOperatorInner(sgpp::base::DataVector& alpha,
+                                                sgpp::base::DataVector& result, double lFactor);
+
  public:
   /**
    * Constructor
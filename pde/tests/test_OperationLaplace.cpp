@@ -10,7 +10,22 @@
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/basis/linear/boundary/algorithm_sweep/PhiPhiDownBBLinearBoundary.hpp>
+#include <sgpp/pde/basis/linear/boundary/algorithm_sweep/PhiPhiUpBBLinearBoundary.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownBBLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpBBLinear.hpp>
+#include <sgpp/pde/basis/modlinear/algorithm_sweep/dPhidPhiDownModLinear.hpp>
+#include <sgpp/pde/basis/modlinear/algorithm_sweep/dPhidPhiUpModLinear.hpp>
+#include <sgpp/pde/basis/modlinear/algorithm_sweep/PhiPhiDownModLinear.hpp>
+#include <sgpp/pde/basis/modlinear/algorithm_sweep/PhiPhiUpModLinear.hpp>
+#include <sgpp/base/algorithm/sweep.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
 namespace sgpp {
 namespace pde {
   /*
@@ -398,6 +413,219 @@ namespace pde {
     }
   }
 
+
+  /*
+    Laplace operators with the sequential 1D sweeps (sweep1D, sweep1D_Boundary) of the original
+    implementation, used as reference for the task-parallel pole sweeps.
+   */
+  class SequentialLaplaceLinear : public OperationLaplaceLinear {
+   public:
+    explicit SequentialLaplaceLinear(sgpp::base::GridStorage* storage)
+        : OperationLaplaceLinear(storage) {}
+
+    void up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) override {
+      PhiPhiUpBBLinear func(this->storage);
+      sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
+      s.sweep1D(alpha, result, dim);
+    }
+
+    void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) override {
+      PhiPhiDownBBLinear func(this->storage);
+      sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
+      s.sweep1D(alpha, result, dim);
+    }
+  };
+
+  class SequentialLaplaceLinearBoundary : public OperationLaplaceLinearBoundary {
+   public:
+    explicit SequentialLaplaceLinearBoundary(sgpp::base::GridStorage* storage)
+        : OperationLaplaceLinearBoundary(storage) {}
+
+   protected:
+    void up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) override {
+      PhiPhiUpBBLinearBoundary func(this->storage);
+      sgpp::base::sweep<PhiPhiUpBBLinearBoundary> s(func, *this->storage);
+      s.sweep1D_Boundary(alpha, result, dim);
+    }
+
+    void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) override {
+      PhiPhiDownBBLinearBoundary func(this->storage);
+      sgpp::base::sweep<PhiPhiDownBBLinearBoundary> s(func, *this->storage);
+      s.sweep1D_Boundary(alpha, result, dim);
+    }
+  };
+
+  class SequentialLaplaceModLinear : public OperationLaplaceModLinear {
+   public:
+    explicit SequentialLaplaceModLinear(sgpp::base::GridStorage* storage)
+        : OperationLaplaceModLinear(storage) {}
+
+   protected:
+    void up(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) override {
+      result.setAll(0.0);
+      PhiPhiUpModLinear func(this->storage);
+      sgpp::base::sweep<PhiPhiUpModLinear> s(func, *this->storage);
+      s.sweep1D(alpha, result, dim);
+    }
+
+    void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim) override {
+      result.setAll(0.0);
+      PhiPhiDownModLinear func(this->storage);
+      sgpp::base::sweep<PhiPhiDownModLinear> s(func, *this->storage);
+      s.sweep1D(alpha, result, dim);
+    }
+
+    void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                   size_t dim) override {
+      result.setAll(0.0);
+      dPhidPhiDownModLinear func(this->storage);
+      sgpp::base::sweep<dPhidPhiDownModLinear> s(func, *this->storage);
+      s.sweep1D(alpha, result, dim);
+    }
+
+    void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                 size_t dim) override {
+      result.setAll(0.0);
+      dPhidPhiUpModLinear func(this->storage);
+      sgpp::base::sweep<dPhidPhiUpModLinear> s(func, *this->storage);
+      s.sweep1D(alpha, result, dim);
+    }
+  };
+
+  /*
+    The up/down operators sum the terms of the dimensions in parallel and sweep the 1D poles in
+    parallel. Compare with the terms of the sequential sweeps computed one after another outside
+    of a parallel region.
+   */
+  void checkUpDownOneOpDimParallel(sgpp::base::Grid& grid, UpDownOneOpDim& sequential) {
+    std::unique_ptr<sgpp::base::OperationMatrix> op(
+      sgpp::op_factory::createOperationLaplace(grid));
+
+    const size_t n = grid.getSize();
+    sgpp::base::DataVector alpha(n);
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = std::sin(static_cast<double>(i) + 1.0);
+    }
+
+    sgpp::base::DataVector reference(n, 0.0);
+    sgpp::base::DataVector term(n);
+    for (size_t d = 0; d < grid.getDimension(); d++) {
+      sequential.multParallelBuildingBlock(alpha, term, d);
+      reference.add(term);
+    }
+
+    // the second application reuses the pooled vectors
+    for (size_t k = 0; k < 2; k++) {
+      sgpp::base::DataVector result(n);
+      op->mult(alpha, result);
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(result[i] - reference[i], 1e-10);
+      }
+    }
+
+    // concurrent applications of the same operator
+    const int numCalls = 4;
+    std::vector<sgpp::base::DataVector> results(numCalls, sgpp::base::DataVector(n));
+#pragma omp parallel for schedule(static, 1)
+    for (int c = 0; c < numCalls; c++) {
+      op->mult(alpha, results[c]);
+    }
+
+    for (int c = 0; c < numCalls; c++) {
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_SMALL(results[c][i] - reference[i], 1e-10);
+      }
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceUpDownParallel) {
+    const size_t d = 4;
+    const size_t l = 5;
+
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+    SequentialLaplaceLinear linear(&grid->getStorage());
+    checkUpDownOneOpDimParallel(*grid, linear);
+
+    grid.reset(sgpp::base::Grid::createLinearBoundaryGrid(d));
+    grid->getGenerator().regular(l - 1);
+    SequentialLaplaceLinearBoundary linearBoundary(&grid->getStorage());
+    checkUpDownOneOpDimParallel(*grid, linearBoundary);
+
+    grid.reset(sgpp::base::Grid::createModLinearGrid(d));
+    grid->getGenerator().regular(l);
+    SequentialLaplaceModLinear modLinear(&grid->getStorage());
+    checkUpDownOneOpDimParallel(*grid, modLinear);
+  }
+
+  void checkLaplaceWithMassMatrix(sgpp::base::Grid& grid, double factor) {
+    size_t n = grid.getSize();
+    std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+        sgpp::op_factory::createOperationLaplace(grid));
+    std::unique_ptr<sgpp::base::OperationMatrix> opMass(
+        sgpp::op_factory::createOperationLTwoDotProduct(grid));
+
+    sgpp::base::DataVector alpha(n);
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = std::sin(static_cast<double>(i) + 0.5);
+    }
+
+    sgpp::base::DataVector reference(n);
+    sgpp::base::DataVector laplace(n);
+    opMass->mult(alpha, reference);
+    opLaplace->mult(alpha, laplace);
+    reference.axpy(factor, laplace);
+
+    UpDownOneOpDim* upDown = UpDownOneOpDim::getLaplaceWithMassSweeps(grid, opLaplace.get());
+    BOOST_REQUIRE(upDown != nullptr);
+
+    sgpp::base::DataVector result(n, 1.0);
+    upDown->multWithMassMatrix(alpha, result, factor);
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(result[i] - reference[i], 1e-10);
+    }
+  }
+
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceWithMassMatrix) {
+    const size_t d = 3;
+    const size_t l = 5;
+
+    std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+    checkLaplaceWithMassMatrix(*grid, 0.25);
+    checkLaplaceWithMassMatrix(*grid, -0.01);
+
+    grid.reset(sgpp::base::Grid::createLinearBoundaryGrid(d));
+    grid->getGenerator().regular(l - 1);
+    checkLaplaceWithMassMatrix(*grid, 0.25);
+
+    grid.reset(sgpp::base::Grid::createLinearBoundaryGrid(d, 0));
+    grid->getGenerator().regular(l - 1);
+    checkLaplaceWithMassMatrix(*grid, 0.25);
+
+    // Clenshaw-Curtis stretching, i.e. non-equidistant grid points
+    std::vector<sgpp::base::BoundingBox1D> boundaries(d);
+    std::vector<sgpp::base::Stretching1D> stretching1Ds(d, sgpp::base::Stretching1D("cc"));
+    sgpp::base::Stretching stretching(boundaries, stretching1Ds);
+
+    grid.reset(sgpp::base::Grid::createLinearStretchedGrid(d));
+    grid->getStorage().setStretching(stretching);
+    grid->getGenerator().regular(l);
+    checkLaplaceWithMassMatrix(*grid, 0.25);
+
+    grid.reset(sgpp::base::Grid::createLinearStretchedBoundaryGrid(d));
+    grid->getStorage().setStretching(stretching);
+    grid->getGenerator().regular(l - 1);
+    checkLaplaceWithMassMatrix(*grid, 0.25);
+
+    // the up/down operations of the modlinear Laplace operator are not the ones of the mass matrix
+    grid.reset(sgpp::base::Grid::createModLinearGrid(d));
+    grid->getGenerator().regular(l);
+    std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+        sgpp::op_factory::createOperationLaplace(*grid));
+    BOOST_CHECK(UpDownOneOpDim::getLaplaceWithMassSweeps(*grid, opLaplace.get()) == nullptr);
+  }
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace pde
 }  // namespace sgpp
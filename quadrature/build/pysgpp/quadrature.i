@@ -5,11 +5,13 @@
 
 // The Good, i.e. without any modifications
 %include "quadrature/src/sgpp/quadrature/Random.hpp"
+%newobject sgpp::quadrature::SampleGenerator::clone;
 %include "quadrature/src/sgpp/quadrature/sampling/SampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/NaiveSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/HaltonSampleGenerator.hpp"
+%include "quadrature/src/sgpp/quadrature/sampling/SobolSampleGenerator.hpp"
 
 %include "OpFactory.i"
 
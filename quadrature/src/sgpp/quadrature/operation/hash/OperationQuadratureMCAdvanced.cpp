@@ -12,28 +12,91 @@
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/NaiveSampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
 namespace quadrature {
 
+namespace {
+
+/// default number of samples per chunk
+const size_t DEFAULT_CHUNK_SIZE = 16384;
+/// minimal number of chunks between two checks of the early stopping criterion
+const size_t MIN_CHUNKS_PER_ROUND = 16;
+
+/**
+ * Running mean and sum of squared deviations (Welford's algorithm).
+ */
+struct RunningStatistics {
+  size_t count = 0;
+  double mean = 0.0;
+  double m2 = 0.0;
+
+  void add(double value) {
+    count++;
+    const double delta = value - mean;
+    mean += delta / static_cast<double>(count);
+    m2 += delta * (value - mean);
+  }
+
+  /// combines the statistics of two disjoint sets of values (Chan et al.)
+  void merge(const RunningStatistics& other) {
+    if (other.count == 0) {
+      return;
+    }
+
+    const size_t newCount = count + other.count;
+    const double delta = other.mean - mean;
+    const double weight = static_cast<double>(other.count) / static_cast<double>(newCount);
+    mean += delta * weight;
+    m2 += other.m2 + delta * delta * static_cast<double>(count) * weight;
+    count = newCount;
+  }
+
+  double variance() const {
+    return (count > 1) ? m2 / static_cast<double>(count - 1) : 0.0;
+  }
+};
+
+}  // namespace
+
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& grid,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(&grid), numberOfSamples(numberOfSamples), seed(seed) {
+    : grid(&grid),
+      numberOfSamples(numberOfSamples),
+      seed(seed),
+      chunkSize(DEFAULT_CHUNK_SIZE),
+      targetStandardError(0.0),
+      variance(0.0),
+      numberOfSamplesUsed(0) {
   dimensions = grid.getDimension();
-  myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
+  myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed, true);
 }
 
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(size_t dimensions,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(NULL), numberOfSamples(numberOfSamples), dimensions(dimensions), seed(seed) {
-  myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
+    : grid(NULL),
+      numberOfSamples(numberOfSamples),
+      dimensions(dimensions),
+      seed(seed),
+      chunkSize(DEFAULT_CHUNK_SIZE),
+      targetStandardError(0.0),
+      variance(0.0),
+      numberOfSamplesUsed(0) {
+  myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed, true);
 }
 
 OperationQuadratureMCAdvanced::~OperationQuadratureMCAdvanced() {
@@ -47,7 +110,7 @@ void OperationQuadratureMCAdvanced::useNaiveMonteCarlo() {
     delete myGenerator;
   }
 
-  myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
+  myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed, true);
 }
 
 void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
@@ -56,7 +119,7 @@ void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
     delete myGenerator;
   }
 
-  myGenerator = new sgpp::quadrature::StratifiedSampleGenerator(strataPerDimension, seed);
+  myGenerator = new sgpp::quadrature::StratifiedSampleGenerator(strataPerDimension, seed, true);
 }
 
 void OperationQuadratureMCAdvanced::useLatinHypercubeMonteCarlo() {
@@ -65,7 +128,7 @@ void OperationQuadratureMCAdvanced::useLatinHypercubeMonteCarlo() {
   }
 
   myGenerator =
-      new sgpp::quadrature::LatinHypercubeSampleGenerator(dimensions, numberOfSamples, seed);
+      new sgpp::quadrature::LatinHypercubeSampleGenerator(dimensions, numberOfSamples, seed, true);
 }
 
 void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
@@ -76,62 +139,161 @@ void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
   myGenerator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
 }
 
-double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
-  sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
-
-  myGenerator->getSamples(dm);
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithSobolSequences() {
+  if (myGenerator != NULL) {
+    delete myGenerator;
+  }
 
-  sgpp::base::DataVector res = sgpp::base::DataVector(numberOfSamples);
-  sgpp::op_factory::createOperationMultipleEval(*grid, dm)->mult(alpha, res);
-  return res.sum() / static_cast<double>(numberOfSamples);
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions);
 }
 
-double OperationQuadratureMCAdvanced::doQuadratureFunc(FUNC func, void* clientdata) {
-  // double* p = new double[dimensions];
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithScrambledSobolSequences() {
+  if (myGenerator != NULL) {
+    delete myGenerator;
+  }
 
-  sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
-  myGenerator->getSamples(dm);
+  myGenerator =
+      new sgpp::quadrature::SobolSampleGenerator(dimensions, SobolScrambling::Owen, seed);
+}
 
-  // create number of paths (uniformly drawn from [0,1]^d)
-  double res = 0;
+double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
+  return integrate([this, &alpha](sgpp::base::DataMatrix& samples, sgpp::base::DataVector& values) {
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, samples));
+    opEval->mult(alpha, values);
+  });
+}
 
-  for (size_t i = 0; i < numberOfSamples; i++) {
-    sgpp::base::DataVector dv(dimensions);
-    dm.getRow(i, dv);
-    res += func(*reinterpret_cast<int*>(&dimensions), dv.getPointer(), clientdata);
-  }
+double OperationQuadratureMCAdvanced::doQuadratureFunc(FUNC func, void* clientdata) {
+  int dim = static_cast<int>(dimensions);
 
-  // delete p;
-  return res / static_cast<double>(numberOfSamples);
+  return integrate([func, clientdata, dim](sgpp::base::DataMatrix& samples,
+                                           sgpp::base::DataVector& values) {
+    values.resize(samples.getNrows());
+
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      values[i] = func(dim, samples.getPointer() + i * samples.getNcols(), clientdata);
+    }
+  });
 }
 
 double OperationQuadratureMCAdvanced::doQuadratureL2Error(FUNC func, void* clientdata,
                                                           sgpp::base::DataVector& alpha) {
-  // create number of paths (uniformly drawn from [0,1]^d)
-  sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
-  myGenerator->getSamples(dm);
-
-  double x;
-  double* p = new double[dimensions];
-
-  sgpp::base::DataVector point(dimensions);
-  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
-  double res = 0;
-
-  for (size_t i = 0; i < numberOfSamples; i++) {
-    for (size_t d = 0; d < dimensions; d++) {
-      x = dm.get(i, d);
-      p[d] = x;
-      point[d] = x;
+  int dim = static_cast<int>(dimensions);
+
+  double res = integrate([this, func, clientdata, dim, &alpha](sgpp::base::DataMatrix& samples,
+                                                               sgpp::base::DataVector& values) {
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, samples));
+    opEval->mult(alpha, values);
+
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      values[i] = pow(func(dim, samples.getPointer() + i * samples.getNcols(), clientdata) -
+                      values[i], 2);
+    }
+  });
+
+  return sqrt(res);
+}
+
+double OperationQuadratureMCAdvanced::integrate(const SampleEvaluator& evaluator) {
+  const size_t numberOfChunks = (numberOfSamples + chunkSize - 1) / chunkSize;
+#ifdef _OPENMP
+  const size_t maxThreads = static_cast<size_t>(omp_get_max_threads());
+#else
+  const size_t maxThreads = 1;
+#endif
+  const size_t chunksPerRound = std::max(MIN_CHUNKS_PER_ROUND, 2 * maxThreads);
+
+  // each thread works on its own copy of the generator, which is only moved forward
+  std::vector<std::unique_ptr<SampleGenerator>> generators(maxThreads);
+  std::vector<size_t> generatorPositions(maxThreads, 0);
+  std::vector<RunningStatistics> chunkStatistics(chunksPerRound);
+  RunningStatistics statistics;
+  size_t firstChunk = 0;
+  bool finished = (numberOfChunks == 0);
+
+#pragma omp parallel
+  {
+#ifdef _OPENMP
+    const size_t threadId = static_cast<size_t>(omp_get_thread_num());
+#else
+    const size_t threadId = 0;
+#endif
+    generators[threadId].reset(myGenerator->clone());
+    SampleGenerator& generator = *generators[threadId];
+    size_t& position = generatorPositions[threadId];
+    sgpp::base::DataMatrix samples(0, dimensions);
+    sgpp::base::DataVector values(0);
+
+    while (!finished) {
+      const size_t chunksInRound = std::min(chunksPerRound, numberOfChunks - firstChunk);
+
+      // chunks are assigned in increasing order, so the generators only skip forward
+#pragma omp for schedule(static, 1)
+      for (size_t k = 0; k < chunksInRound; k++) {
+        const size_t begin = (firstChunk + k) * chunkSize;
+        const size_t end = std::min(begin + chunkSize, numberOfSamples);
+
+        generator.skipSamples(begin - position);
+        samples.resize(end - begin, dimensions);
+        generator.getSamples(samples);
+
+        position = end;
+        values.resize(end - begin);
+        evaluator(samples, values);
+
+        RunningStatistics& current = chunkStatistics[k];
+        current = RunningStatistics();
+
+        for (size_t i = 0; i < end - begin; i++) {
+          current.add(values[i]);
+        }
+      }
+
+#pragma omp single
+      {
+        // merge in the order of the chunks, so the result doesn't depend on the thread count
+        for (size_t k = 0; k < chunksInRound; k++) {
+          statistics.merge(chunkStatistics[k]);
+        }
+
+        firstChunk += chunksInRound;
+        finished = (firstChunk == numberOfChunks) ||
+                   ((targetStandardError > 0.0) && (statistics.count > 1) &&
+                    (std::sqrt(statistics.variance() / static_cast<double>(statistics.count)) <=
+                     targetStandardError));
+      }
     }
-    res += pow(
-        func(*reinterpret_cast<int*>(&dimensions), p, clientdata) - opEval->eval(alpha, point), 2);
   }
 
-  delete[] p;
-  return sqrt(res / static_cast<double>(numberOfSamples));
+  variance = statistics.variance();
+  numberOfSamplesUsed = statistics.count;
+
+  // the next quadrature continues with the following samples
+  myGenerator->skipSamples(numberOfSamplesUsed);
+
+  return statistics.mean;
+}
+
+void OperationQuadratureMCAdvanced::setChunkSize(size_t chunkSize) {
+  this->chunkSize = std::max(chunkSize, static_cast<size_t>(1));
+}
+
+void OperationQuadratureMCAdvanced::setTargetStandardError(double targetStandardError) {
+  this->targetStandardError = targetStandardError;
 }
 
+double OperationQuadratureMCAdvanced::getVariance() { return variance; }
+
+double OperationQuadratureMCAdvanced::getStandardError() {
+  return (numberOfSamplesUsed > 0)
+             ? std::sqrt(variance / static_cast<double>(numberOfSamplesUsed))
+             : 0.0;
+}
+
+size_t OperationQuadratureMCAdvanced::getNumberOfSamplesUsed() { return numberOfSamplesUsed; }
+
 size_t OperationQuadratureMCAdvanced::getDimensions() { return dimensions; }
 
 }  // namespace quadrature
@@ -11,6 +11,7 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/quadrature/sampling/SampleGenerator.hpp>
 
+#include <functional>
 #include <vector>
 
 namespace sgpp {
@@ -26,6 +27,15 @@ typedef double (*FUNC)(int, double*, void*);
 /**
  * Quadrature on any sparse grid (that has OperationMultipleEval implemented)
  * using various Monte Carlo Methods (Advanced).
+ *
+ * The samples are generated and evaluated in chunks of bounded size, so the memory consumption
+ * doesn't depend on the number of samples. The chunks are distributed to the OpenMP threads, each
+ * thread works on a copy of the sample generator that is moved to the beginning of its chunks by
+ * SampleGenerator::skipSamples, so the result doesn't depend on the number of threads. The random
+ * sample generators use the CounterBasedRandomEngine, which skips samples in constant time.
+ * Mean and variance of the integrand are accumulated with Welford's algorithm; optionally, the
+ * integration stops as soon as the standard error of the mean drops below a target value.
+ * Functions passed to doQuadratureFunc and doQuadratureL2Error have to be thread-safe.
  */
 
 class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
@@ -109,14 +119,50 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
 
   /**
    * @brief Initialize SampleGenerator for SobolSequenceGenerator
+   * (at most SobolSampleGenerator::MAX_DIMENSIONS dimensions)
    */
   void useQuasiMonteCarloWithSobolSequences();
 
   /**
    * @brief Initialize SampleGenerator for ScrambledSobolSequenceGenerator
+   * (Owen scrambled Sobol sequence, randomized by the seed of the operation)
    */
   void useQuasiMonteCarloWithScrambledSobolSequences();
 
+  /**
+   * @brief Sets the number of samples that are generated and evaluated at once by a thread
+   * (defaults to 16384).
+   *
+   * @param chunkSize number of samples per chunk
+   */
+  void setChunkSize(size_t chunkSize);
+
+  /**
+   * @brief Enables early stopping: the quadrature stops before all samples are used as soon as
+   * the standard error of the mean of the integrand is at most the given value. The criterion is
+   * checked after each round of chunks.
+   *
+   * @param targetStandardError target standard error (0 disables early stopping, the default)
+   */
+  void setTargetStandardError(double targetStandardError);
+
+  /**
+   * @return sample variance of the integrand in the last quadrature
+   * (for doQuadratureL2Error: of the squared error)
+   */
+  double getVariance();
+
+  /**
+   * @return standard error of the mean of the integrand in the last quadrature (only meaningful
+   * for random samples, not for quasi-random sequences)
+   */
+  double getStandardError();
+
+  /**
+   * @return number of samples used in the last quadrature
+   */
+  size_t getNumberOfSamplesUsed();
+
   /**
    * @brief Method returns the total number of samples which can be generated
    * according to the sample generator settings (dimensions and subdivision into strata)
@@ -126,6 +172,21 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
   size_t getDimensions();
 
  protected:
+  /**
+   * Evaluates the integrand at the samples (rows of the matrix), the result vector has to be
+   * resized to the number of samples. Is called concurrently by multiple threads.
+   */
+  typedef std::function<void(sgpp::base::DataMatrix&, sgpp::base::DataVector&)> SampleEvaluator;
+
+  /**
+   * @brief Computes the mean of the integrand over the samples and stores the statistics.
+   * The generator is advanced by the number of used samples.
+   *
+   * @param evaluator evaluates the integrand at a chunk of samples
+   * @return mean of the integrand
+   */
+  double integrate(const SampleEvaluator& evaluator);
+
   // Pointer to the grid object
   sgpp::base::Grid* grid;
   // Number of MC samples
@@ -138,6 +199,15 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
 
   // SampleGenerator Instance
   sgpp::quadrature::SampleGenerator* myGenerator;
+
+  // number of samples per chunk
+  size_t chunkSize;
+  // target standard error for early stopping (0 for no early stopping)
+  double targetStandardError;
+  // sample variance of the integrand in the last quadrature
+  double variance;
+  // number of samples used in the last quadrature
+  size_t numberOfSamplesUsed;
 };
 
 }  // namespace quadrature
@@ -0,0 +1,84 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef COUNTERBASEDRANDOMENGINE_HPP
+#define COUNTERBASEDRANDOMENGINE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <limits>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Counter-based 64 bit random number engine (the SplitMix64 generator of G. Steele, D. Lea and
+ * C. Flood, "Fast Splittable Pseudorandom Number Generators", 2014). The n-th number is a bit
+ * mixing function of the seed and n, so discard() jumps ahead in constant time, which the sample
+ * generators need to skip to the part of the sequence of a thread.
+ * Satisfies the requirements of a uniform random bit generator of the standard library.
+ */
+class CounterBasedRandomEngine {
+ public:
+  typedef std::uint64_t result_type;
+
+  /**
+   * Constructor
+   *
+   * @param seed seed of the sequence
+   */
+  explicit CounterBasedRandomEngine(result_type seed = 5489u) { this->seed(seed); }
+
+  /**
+   * Restarts the sequence with the given seed.
+   *
+   * @param seed seed of the sequence
+   */
+  void seed(result_type seed) {
+    // mixing the seed decorrelates the sequences of neighboring seeds
+    key = mix(seed);
+    counter = 0;
+  }
+
+  /**
+   * @return next number of the sequence
+   */
+  result_type operator()() {
+    counter++;
+    return mix(key + counter * GAMMA);
+  }
+
+  /**
+   * Advances the sequence in constant time.
+   *
+   * @param numberOfValues number of values to skip
+   */
+  void discard(unsigned long long numberOfValues) {  // NOLINT(runtime/int)
+    counter += numberOfValues;
+  }
+
+  static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+
+  static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+ private:
+  /// odd constant of the Weyl sequence (the golden ratio scaled to 64 bits)
+  static constexpr result_type GAMMA = 0x9e3779b97f4a7c15ull;
+
+  static result_type mix(result_type z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  result_type key;
+  result_type counter;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* COUNTERBASEDRANDOMENGINE_HPP */
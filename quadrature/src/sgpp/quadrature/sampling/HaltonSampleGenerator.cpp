@@ -50,5 +50,9 @@ void HaltonSampleGenerator::getSample(sgpp::base::DataVector& dv) {
   index++;
 }
 
+void HaltonSampleGenerator::skipSamples(size_t numberOfSamples) { index += numberOfSamples; }
+
+SampleGenerator* HaltonSampleGenerator::clone() const { return new HaltonSampleGenerator(*this); }
+
 }  // namespace quadrature
 }  // namespace sgpp
@@ -43,6 +43,18 @@ class HaltonSampleGenerator : public SampleGenerator {
    */
   virtual void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Skips samples in constant time.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  virtual void skipSamples(size_t numberOfSamples);
+
+  /**
+   * @return copy of the generator including its current state, has to be deleted by the caller
+   */
+  virtual SampleGenerator* clone() const;
+
  private:
   size_t index;
   std::vector<size_t> baseVector;
@@ -17,14 +17,14 @@ namespace quadrature {
 
 LatinHypercubeSampleGenerator::LatinHypercubeSampleGenerator(size_t dimensions,
                                                              size_t numberOfStrata,
-                                                             std::uint64_t seed)
-    : SampleGenerator(dimensions, seed),
+                                                             std::uint64_t seed,
+                                                             bool counterBased)
+    : SampleGenerator(dimensions, seed, counterBased),
       numberOfStrata(
           numberOfStrata),       // each dimension is divided in n strata to provide n sample points
       numberOfCurrentSample(1),  // index number of current sample [1, n]
       // equidistant split of [0,1] in n strata -> size of one stratum = 1 / n
-      sizeOfStrata(1. / static_cast<double>(numberOfStrata)),
-      uniformRealDist(0, 1) {
+      sizeOfStrata(1. / static_cast<double>(numberOfStrata)) {
   for (size_t i = 0; i < dimensions; i++) {
     currentStrata.push_back(std::vector<size_t>());
 
@@ -42,7 +42,8 @@ void LatinHypercubeSampleGenerator::getSample(sgpp::base::DataVector& sample) {
   // compute random value inside the current stratum selected from the shuffled strata sequence
   for (size_t i = 0; i < dimensions; i++) {
     sample[i] =
-        (static_cast<double>(currentStrata[i][numberOfCurrentSample - 1]) + uniformRealDist(rng)) *
+        (static_cast<double>(currentStrata[i][numberOfCurrentSample - 1]) +
+         getUniformRandomNumber()) *
         sizeOfStrata;
   }
 
@@ -51,16 +52,47 @@ void LatinHypercubeSampleGenerator::getSample(sgpp::base::DataVector& sample) {
   if (numberOfCurrentSample < numberOfStrata) {
     numberOfCurrentSample++;
   } else {
-    numberOfCurrentSample = 0;
+    numberOfCurrentSample = 1;
     shuffleStrataSequence();
   }
 }
 
 void LatinHypercubeSampleGenerator::shuffleStrataSequence() {
   for (size_t i = 0; i < dimensions; i++) {
-    std::shuffle(currentStrata[i].begin(), currentStrata[i].end(), rng);
+    if (counterBased) {
+      std::shuffle(currentStrata[i].begin(), currentStrata[i].end(), counterBasedRng);
+    } else {
+      std::shuffle(currentStrata[i].begin(), currentStrata[i].end(), rng);
+    }
+  }
+}
+
+void LatinHypercubeSampleGenerator::skipSamples(size_t numberOfSamples) {
+  if (!counterBased) {
+    SampleGenerator::skipSamples(numberOfSamples);
+    return;
+  }
+
+  while (numberOfSamples > 0) {
+    // samples left in the current permutation of the strata
+    const size_t remaining = numberOfStrata - numberOfCurrentSample + 1;
+
+    if (numberOfSamples < remaining) {
+      counterBasedRng.discard(numberOfSamples * dimensions);
+      numberOfCurrentSample += numberOfSamples;
+      numberOfSamples = 0;
+    } else {
+      counterBasedRng.discard(remaining * dimensions);
+      numberOfCurrentSample = 1;
+      shuffleStrataSequence();
+      numberOfSamples -= remaining;
+    }
   }
 }
 
+SampleGenerator* LatinHypercubeSampleGenerator::clone() const {
+  return new LatinHypercubeSampleGenerator(*this);
+}
+
 }  // namespace quadrature
 }  // namespace sgpp
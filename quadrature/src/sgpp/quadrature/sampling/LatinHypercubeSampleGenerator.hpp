@@ -31,10 +31,12 @@ class LatinHypercubeSampleGenerator : public SampleGenerator {
    * @param dimensions number of dimensions used for sample generation
    * @param numberOfStrata number of strata
    * @param seed custom seed (defaults to default seed of mt19937_64)
+   * @param counterBased use the CounterBasedRandomEngine instead of mt19937_64
    */
 
   LatinHypercubeSampleGenerator(size_t dimensions, size_t numberOfStrata,
-                                std::uint64_t seed = std::mt19937_64::default_seed);
+                                std::uint64_t seed = std::mt19937_64::default_seed,
+                                bool counterBased = false);
 
   /**
    * Destructor
@@ -50,6 +52,21 @@ class LatinHypercubeSampleGenerator : public SampleGenerator {
 
   void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Skips samples. The counter-based random number engine jumps ahead by one value per
+   * coordinate, which takes constant time within the current permutation of the strata; each
+   * further permutation that is skipped is generated, i.e., skipping is linear in the number of
+   * skipped permutations. mt19937_64 generates and discards the samples.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void skipSamples(size_t numberOfSamples);
+
+  /**
+   * @return copy of the generator including its current state, has to be deleted by the caller
+   */
+  SampleGenerator* clone() const;
+
  private:
   /**
    * This method generates one sample .
@@ -69,9 +86,6 @@ class LatinHypercubeSampleGenerator : public SampleGenerator {
 
   //
   std::vector<std::vector<size_t> > currentStrata;
-
-  //
-  std::uniform_real_distribution<double> uniformRealDist;
 };
 
 }  // namespace quadrature
@@ -11,8 +11,9 @@
 namespace sgpp {
 namespace quadrature {
 
-NaiveSampleGenerator::NaiveSampleGenerator(size_t dimension, std::uint64_t seed)
-    : SampleGenerator(dimension, seed), uniformRealDist(0, 1) {}
+NaiveSampleGenerator::NaiveSampleGenerator(size_t dimension, std::uint64_t seed,
+                                           bool counterBased)
+    : SampleGenerator(dimension, seed, counterBased) {}
 
 NaiveSampleGenerator::~NaiveSampleGenerator() {}
 
@@ -20,9 +21,19 @@ void NaiveSampleGenerator::getSample(base::DataVector& sample) {
   // generate random sample with dimensionality corresponding to the
   // size of the given datavector (in 0 to 1)
   for (size_t i = 0; i < sample.getSize(); i++) {
-    sample[i] = uniformRealDist(rng);
+    sample[i] = getUniformRandomNumber();
   }
 }
 
+void NaiveSampleGenerator::skipSamples(size_t numberOfSamples) {
+  if (counterBased) {
+    counterBasedRng.discard(numberOfSamples * dimensions);
+  } else {
+    SampleGenerator::skipSamples(numberOfSamples);
+  }
+}
+
+SampleGenerator* NaiveSampleGenerator::clone() const { return new NaiveSampleGenerator(*this); }
+
 }  // namespace quadrature
 }  // namespace sgpp
@@ -29,9 +29,11 @@ class NaiveSampleGenerator : public SampleGenerator {
    *
    * @param dimension number of dimensions used for sample generation
    * @param seed custom seed (defaults to default seed of mt19937_64)
+   * @param counterBased use the CounterBasedRandomEngine instead of mt19937_64
    */
   explicit NaiveSampleGenerator(size_t dimension,
-                                std::uint64_t seed = std::mt19937_64::default_seed);
+                                std::uint64_t seed = std::mt19937_64::default_seed,
+                                bool counterBased = false);
 
   /**
    * Destructor
@@ -46,8 +48,18 @@ class NaiveSampleGenerator : public SampleGenerator {
    */
   virtual void getSample(sgpp::base::DataVector& sample);
 
- private:
-  std::uniform_real_distribution<double> uniformRealDist;
+  /**
+   * Skips samples. The counter-based random number engine jumps ahead by one value per
+   * coordinate in constant time, mt19937_64 generates and discards the samples.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  virtual void skipSamples(size_t numberOfSamples);
+
+  /**
+   * @return copy of the generator including its current state, has to be deleted by the caller
+   */
+  virtual SampleGenerator* clone() const;
 };
 
 }  // namespace quadrature
@@ -11,10 +11,13 @@
 namespace sgpp {
 namespace quadrature {
 
-SampleGenerator::SampleGenerator(size_t dimensions, std::uint64_t seed)
-    : dimensions(dimensions), seed(seed) {
-  rng.seed(seed);
-}
+SampleGenerator::SampleGenerator(size_t dimensions, std::uint64_t seed, bool counterBased)
+    : dimensions(dimensions),
+      seed(seed),
+      rng(seed),
+      counterBased(counterBased),
+      counterBasedRng(seed),
+      uniformRealDist(0, 1) {}
 
 SampleGenerator::~SampleGenerator() {}
 
@@ -31,6 +34,23 @@ void SampleGenerator::getSamples(base::DataMatrix& samples) {
   }
 }
 
+void SampleGenerator::skipSamples(size_t numberOfSamples) {
+  base::DataVector dv(dimensions);
+
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    getSample(dv);
+  }
+}
+
+double SampleGenerator::getUniformRandomNumber() {
+  if (counterBased) {
+    // the upper 53 bits give a double in [0, 1), so skipping one number discards one value
+    return static_cast<double>(counterBasedRng() >> 11) * (1.0 / 9007199254740992.0);
+  } else {
+    return uniformRealDist(rng);
+  }
+}
+
 size_t SampleGenerator::getDimensions() { return dimensions; }
 
 void SampleGenerator::setDimensions(size_t dimensions) { this->dimensions = dimensions; }
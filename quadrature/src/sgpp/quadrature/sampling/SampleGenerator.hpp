@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/CounterBasedRandomEngine.hpp>
 
 #include <random>
 
@@ -29,9 +30,12 @@ class SampleGenerator {
    *
    * @param dimensions number of dimensions used for sample generation
    * @param seed custom seed (defaults to default seed of mt19937_64)
+   * @param counterBased use the CounterBasedRandomEngine instead of mt19937_64 (skipping samples
+   * takes constant time, but the samples differ from the ones of mt19937_64)
    */
 
-  explicit SampleGenerator(size_t dimensions, std::uint64_t seed = std::mt19937_64::default_seed);
+  explicit SampleGenerator(size_t dimensions, std::uint64_t seed = std::mt19937_64::default_seed,
+                           bool counterBased = false);
   virtual ~SampleGenerator();
 
   /**
@@ -50,11 +54,33 @@ class SampleGenerator {
    * samples are written to the parameter DataMatrix. Therefore the
    * number of cols has to fit the number of dimensions whereas the
    * number of rows defines the number of generated samples.
+   * Subclasses may override this method to generate many samples at once.
    *
    * @param samples provide a DataMatrix to hold the generated samples
    */
 
-  void getSamples(sgpp::base::DataMatrix& samples);
+  virtual void getSamples(sgpp::base::DataMatrix& samples);
+
+  /**
+   * Advances the generator as if the given number of samples had been generated, i.e., the next
+   * sample is the same as without skipping after generating numberOfSamples samples.
+   * Used to give each thread its own part of the sample sequence.
+   * The default implementation generates and discards the samples. With the counter-based random
+   * number engine, skipping takes constant time for the naive and stratified generators and is
+   * linear in the number of skipped permutations of the strata for the Latin hypercube generator.
+   * It takes constant time for the Halton and \f$\mathcal{O}(d \log n)\f$ for the Sobol
+   * generator.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+
+  virtual void skipSamples(size_t numberOfSamples);
+
+  /**
+   * @return copy of the generator including its current state, has to be deleted by the caller
+   */
+
+  virtual SampleGenerator* clone() const = 0;
 
   /**
    *
@@ -72,6 +98,12 @@ class SampleGenerator {
   void setDimensions(size_t dimensions);
 
  protected:
+  /**
+   * @return uniformly distributed random number in [0, 1) drawn from the random number engine in
+   * use, with the counter-based engine exactly one value of the engine is consumed
+   */
+  double getUniformRandomNumber();
+
   // number of dimensions for sample generation
   size_t dimensions;
 
@@ -80,6 +112,15 @@ class SampleGenerator {
 
   // random number generator
   std::mt19937_64 rng;
+
+  // whether counterBasedRng is used instead of rng
+  bool counterBased;
+
+  // counter-based random number generator, i.e., it can jump ahead in constant time
+  CounterBasedRandomEngine counterBasedRng;
+
+  // distribution for getUniformRandomNumber with rng
+  std::uniform_real_distribution<double> uniformRealDist;
 };
 }  // namespace quadrature
 }  // namespace sgpp
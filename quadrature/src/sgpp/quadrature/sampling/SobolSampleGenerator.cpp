@@ -0,0 +1,224 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+namespace {
+
+/**
+ * Primitive polynomials and initial direction numbers of the dimensions 2, 3, ...
+ * (S. Joe and F. Y. Kuo, "Constructing Sobol sequences with better two-dimensional projections",
+ * SIAM J. Sci. Comput. 30, 2008, file new-joe-kuo-6.21201).
+ */
+struct SobolInitialNumbers {
+  // degree of the polynomial
+  unsigned int s;
+  // coefficients of the polynomial (without the leading and the constant one)
+  unsigned int a;
+  // initial direction numbers
+  unsigned int m[7];
+};
+
+const SobolInitialNumbers INITIAL_NUMBERS[] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}}};
+
+/// scaling of the bit vectors to [0, 1)
+const double BIT_SCALING = 1.0 / 4294967296.0;
+
+inline std::uint32_t reverseBits(std::uint32_t x) {
+  x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+  x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+  x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+  x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+  return (x >> 16) | (x << 16);
+}
+
+/// position of the lowest zero bit
+inline size_t lowestZeroBit(std::uint64_t n) {
+  size_t k = 0;
+
+  while (n & 1) {
+    n >>= 1;
+    k++;
+  }
+
+  return k;
+}
+
+}  // namespace
+
+SobolSampleGenerator::SobolSampleGenerator(size_t dimensions, SobolScrambling scrambling,
+                                           std::uint64_t seed)
+    : SampleGenerator(dimensions, seed),
+      scrambling(scrambling),
+      directions(BITS * dimensions),
+      state(dimensions, 0),
+      scramblingSeeds(dimensions, 0),
+      index(0) {
+  if (dimensions > MAX_DIMENSIONS) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: direction numbers are only available for up to 21 dimensions");
+  }
+
+  // first dimension: van der Corput sequence in base 2
+  for (size_t k = 0; (k < BITS) && (dimensions > 0); k++) {
+    directions[k * dimensions] = 1u << (BITS - 1 - k);
+  }
+
+  for (size_t d = 1; d < dimensions; d++) {
+    const SobolInitialNumbers& numbers = INITIAL_NUMBERS[d - 1];
+    const size_t s = numbers.s;
+    std::vector<std::uint32_t> v(BITS);
+
+    for (size_t k = 0; k < BITS; k++) {
+      if (k < s) {
+        v[k] = static_cast<std::uint32_t>(numbers.m[k]) << (BITS - 1 - k);
+      } else {
+        // recurrence given by the primitive polynomial
+        v[k] = v[k - s] ^ (v[k - s] >> s);
+
+        for (size_t j = 1; j < s; j++) {
+          if ((numbers.a >> (s - 1 - j)) & 1u) {
+            v[k] ^= v[k - j];
+          }
+        }
+      }
+
+      directions[k * dimensions + d] = v[k];
+    }
+  }
+
+  if (scrambling != SobolScrambling::None) {
+    std::uniform_int_distribution<std::uint32_t> distInt;
+
+    for (size_t d = 0; d < dimensions; d++) {
+      scramblingSeeds[d] = distInt(rng);
+    }
+  }
+}
+
+SobolSampleGenerator::~SobolSampleGenerator() {}
+
+std::uint32_t SobolSampleGenerator::scramble(std::uint32_t x, size_t d) const {
+  if (scrambling == SobolScrambling::DigitalShift) {
+    return x ^ scramblingSeeds[d];
+  } else if (scrambling == SobolScrambling::Owen) {
+    // the permutation of Laine and Karras only depends on less significant bits,
+    // so it's applied to the reversed bits
+    x = reverseBits(x);
+    x += scramblingSeeds[d];
+    x ^= x * 0x6c50b47cu;
+    x ^= x * 0xb82f1e52u;
+    x ^= x * 0xc7afe638u;
+    x ^= x * 0x8d22f6e6u;
+    return reverseBits(x);
+  } else {
+    return x;
+  }
+}
+
+void SobolSampleGenerator::nextPoint(double* point) {
+  if (index >= MAX_POINTS) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: the sequence is exhausted after 2^32 points");
+  }
+
+  for (size_t d = 0; d < dimensions; d++) {
+    point[d] = static_cast<double>(scramble(state[d], d)) * BIT_SCALING;
+  }
+
+  // Gray code order: the next point differs in one direction number
+  // (there is none after the last point)
+  const size_t k = lowestZeroBit(index);
+
+  if (k < BITS) {
+    const std::uint32_t* v = &directions[k * dimensions];
+
+    for (size_t d = 0; d < dimensions; d++) {
+      state[d] ^= v[d];
+    }
+  }
+
+  index++;
+}
+
+void SobolSampleGenerator::getSample(sgpp::base::DataVector& sample) {
+  if (sample.getSize() != dimensions) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator::getSample: size of the sample doesn't match the dimension");
+  }
+
+  nextPoint(sample.getPointer());
+}
+
+void SobolSampleGenerator::getSamples(sgpp::base::DataMatrix& samples) {
+  if (samples.getNcols() != dimensions) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator::getSamples: number of columns doesn't match the dimension");
+  }
+
+  double* row = samples.getPointer();
+
+  for (size_t i = 0; i < samples.getNrows(); i++, row += dimensions) {
+    nextPoint(row);
+  }
+}
+
+void SobolSampleGenerator::skipSamples(size_t numberOfSamples) {
+  if (numberOfSamples > MAX_POINTS - index) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator::skipSamples: the sequence only has 2^32 points");
+  }
+
+  index += numberOfSamples;
+
+  // the point with index n is the XOR of the direction numbers of the bits of the Gray code of n
+  const std::uint64_t gray = index ^ (index >> 1);
+
+  for (size_t d = 0; d < dimensions; d++) {
+    state[d] = 0;
+  }
+
+  for (size_t k = 0; k < BITS; k++) {
+    if ((gray >> k) & 1u) {
+      const std::uint32_t* v = &directions[k * dimensions];
+
+      for (size_t d = 0; d < dimensions; d++) {
+        state[d] ^= v[d];
+      }
+    }
+  }
+}
+
+SampleGenerator* SobolSampleGenerator::clone() const { return new SobolSampleGenerator(*this); }
+
+}  // namespace quadrature
+}  // namespace sgpp
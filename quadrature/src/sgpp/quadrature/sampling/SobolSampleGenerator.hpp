@@ -0,0 +1,136 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SOBOLSAMPLEGENERATOR_HPP
+#define SOBOLSAMPLEGENERATOR_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Randomization of the Sobol sequence.
+ */
+enum class SobolScrambling {
+  /// plain Sobol sequence
+  None,
+  /// XOR of each coordinate with a random bit vector (random digital shift)
+  DigitalShift,
+  /// nested uniform (Owen) scrambling, realized by the hash-based permutation
+  /// of Laine and Karras (see B. Burley, "Practical Hash-based Owen Scrambling", 2020)
+  Owen
+};
+
+/**
+ * The class SobolSampleGenerator generates the points of the Sobol sequence
+ * (with the direction numbers of S. Joe and F. Y. Kuo) with a resolution of 32 bits,
+ * i.e., at most \f$2^{32}\f$ points (generating or skipping beyond them throws).
+ * Consecutive points are generated in Gray code order with one XOR per coordinate, and
+ * skipSamples jumps to an arbitrary point in \f$\mathcal{O}(\log n)\f$ operations per
+ * coordinate.
+ *
+ * The sequence can be randomized by a digital shift or by Owen scrambling. The randomization only
+ * depends on the seed, so generators with different seeds give independent randomized QMC
+ * estimates, whose spread estimates the integration error.
+ */
+class SobolSampleGenerator : public SampleGenerator {
+ public:
+  /// maximal number of dimensions for which direction numbers are available
+  static const size_t MAX_DIMENSIONS = 21;
+
+  /**
+   * Standard constructor
+   *
+   * @param dimensions number of dimensions used for sample generation (at most MAX_DIMENSIONS)
+   * @param scrambling randomization of the sequence
+   * @param seed custom seed for the randomization (defaults to default seed of mt19937_64)
+   */
+  explicit SobolSampleGenerator(size_t dimensions,
+                                SobolScrambling scrambling = SobolScrambling::None,
+                                std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * Destructor
+   */
+  virtual ~SobolSampleGenerator();
+
+  /**
+   * This method generates one sample .
+   * Implementation of the abstract Method getSample from SampelGenerator.
+   * Throws if the size of the vector doesn't match the dimension.
+   *
+   * @param sample DataVector storing the new generated sample vector.
+   */
+  void getSample(sgpp::base::DataVector& sample);
+
+  /**
+   * Generates one sample per row of the given matrix. The points are generated one after the
+   * other (each depends on its predecessor), the coordinates of a point are updated together from
+   * contiguous direction numbers and written to its row directly, as DataMatrix is row-major.
+   * Throws if the number of columns doesn't match the dimension.
+   *
+   * @param samples provide a DataMatrix to hold the generated samples
+   */
+  void getSamples(sgpp::base::DataMatrix& samples);
+
+  /**
+   * Jumps ahead in the sequence (in logarithmic time).
+   * Throws if this moves beyond the end of the sequence.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void skipSamples(size_t numberOfSamples);
+
+  /**
+   * @return copy of the generator including its current state, has to be deleted by the caller
+   */
+  SampleGenerator* clone() const;
+
+ private:
+  /// number of bits of the coordinates
+  static const size_t BITS = 32;
+  /// number of points of the sequence
+  static const std::uint64_t MAX_POINTS = std::uint64_t(1) << BITS;
+
+  /**
+   * Applies the randomization to one coordinate.
+   *
+   * @param x coordinate as bit vector
+   * @param d dimension of the coordinate
+   * @return randomized coordinate
+   */
+  inline std::uint32_t scramble(std::uint32_t x, size_t d) const;
+
+  /**
+   * Writes the current point to the given array and moves to the next point.
+   *
+   * @param point array for the coordinates of the point
+   */
+  inline void nextPoint(double* point);
+
+  // randomization
+  SobolScrambling scrambling;
+  // direction numbers, directions[k * dimensions + d] is the k-th direction number of dimension d
+  std::vector<std::uint32_t> directions;
+  // current point of the (unscrambled) sequence as bit vectors
+  std::vector<std::uint32_t> state;
+  // random shifts (digital shift) or seeds (Owen scrambling) of the dimensions
+  std::vector<std::uint32_t> scramblingSeeds;
+  // index of the current point
+  std::uint64_t index;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* SOBOLSAMPLEGENERATOR_HPP */
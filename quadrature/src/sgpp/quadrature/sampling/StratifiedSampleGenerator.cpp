@@ -14,12 +14,11 @@ namespace sgpp {
 namespace quadrature {
 
 StratifiedSampleGenerator::StratifiedSampleGenerator(std::vector<size_t>& strataPerDimension,
-                                                     uint64_t seed)
-    : SampleGenerator(strataPerDimension.size(), seed),
+                                                     uint64_t seed, bool counterBased)
+    : SampleGenerator(strataPerDimension.size(), seed, counterBased),
       numberOfStrata(strataPerDimension),
       currentStrata(strataPerDimension.size()),
-      sizeOfStrata(strataPerDimension.size()),
-      uniformRealDist(0, 1) {
+      sizeOfStrata(strataPerDimension.size()) {
   // set counter to the first strata for each dimension
   // compute size of strata per dimension
   for (size_t i = 0; i < dimensions; i++) {
@@ -38,7 +37,7 @@ void StratifiedSampleGenerator::getSample(sgpp::base::DataVector& dv) {
 
   // Choose a random number inside the stratum selected for this dimension
   for (size_t i = 0; i < dimensions; i++) {
-    dv[i] = (static_cast<double>(currentStrata[i]) + uniformRealDist(rng)) * sizeOfStrata[i];
+    dv[i] = (static_cast<double>(currentStrata[i]) + getUniformRandomNumber()) * sizeOfStrata[i];
   }
 
   // continue to the next stratum used for the next sample
@@ -59,5 +58,27 @@ void StratifiedSampleGenerator::getNextStrata() {
   }
 }
 
+void StratifiedSampleGenerator::skipSamples(size_t numberOfSamples) {
+  if (!counterBased) {
+    SampleGenerator::skipSamples(numberOfSamples);
+    return;
+  }
+
+  counterBasedRng.discard(numberOfSamples * dimensions);
+
+  // the strata are counted like the digits of a number with mixed radices
+  size_t carry = numberOfSamples;
+
+  for (size_t i = 0; (i < dimensions) && (carry > 0); i++) {
+    const size_t digit = currentStrata[i] + carry % numberOfStrata[i];
+    carry = carry / numberOfStrata[i] + digit / numberOfStrata[i];
+    currentStrata[i] = digit % numberOfStrata[i];
+  }
+}
+
+SampleGenerator* StratifiedSampleGenerator::clone() const {
+  return new StratifiedSampleGenerator(*this);
+}
+
 }  // namespace quadrature
 }  // namespace sgpp
@@ -30,10 +30,12 @@ class StratifiedSampleGenerator : public SampleGenerator {
    * @param strataPerDimension array holding the number of strata used to
    * subdivide the specific dimension
    * @param seed custom seed (defaults to default seed of mt19937_64)
+   * @param counterBased use the CounterBasedRandomEngine instead of mt19937_64
    */
 
   StratifiedSampleGenerator(std::vector<size_t>& strataPerDimension,
-                            std::uint64_t seed = std::mt19937_64::default_seed);
+                            std::uint64_t seed = std::mt19937_64::default_seed,
+                            bool counterBased = false);
 
   /**
    * Destructor
@@ -49,6 +51,20 @@ class StratifiedSampleGenerator : public SampleGenerator {
 
   void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Skips samples. The counter-based random number engine jumps ahead by one value per
+   * coordinate and the strata are advanced in constant time, mt19937_64 generates and discards
+   * the samples.
+   *
+   * @param numberOfSamples number of samples to skip
+   */
+  void skipSamples(size_t numberOfSamples);
+
+  /**
+   * @return copy of the generator including its current state, has to be deleted by the caller
+   */
+  SampleGenerator* clone() const;
+
  private:
   // Array containing the number of strata per dimension
   std::vector<size_t> numberOfStrata;
@@ -65,9 +81,6 @@ class StratifiedSampleGenerator : public SampleGenerator {
    * counts up the next dimension by 1.
    */
   void getNextStrata();
-
-  //
-  std::uniform_real_distribution<double> uniformRealDist;
 };
 
 }  // namespace quadrature
@@ -27,11 +27,16 @@ std::string normalize_test_case_name(const_string name) {
 
 #include <sgpp_base.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
 
 #include <sgpp_quadrature.hpp>
 #include <sgpp/quadrature/QuadratureOpFactory.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <omp.h>
+
+#include <random>
+#include <utility>
 #include <vector>
 
 using sgpp::base::DataVector;
@@ -40,6 +45,8 @@ using sgpp::quadrature::HaltonSampleGenerator;
 using sgpp::quadrature::LatinHypercubeSampleGenerator;
 using sgpp::quadrature::NaiveSampleGenerator;
 using sgpp::quadrature::SampleGenerator;
+using sgpp::quadrature::SobolSampleGenerator;
+using sgpp::quadrature::SobolScrambling;
 using sgpp::quadrature::StratifiedSampleGenerator;
 
 double f(DataVector x) {
@@ -93,33 +100,57 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
                                        sgpp::quadrature::SamplerTypes samplerType, size_t dim,
                                        size_t numSamples, std::vector<size_t>& blockSize,
                                        double analyticResult, double tol, uint64_t seed = 1234567) {
-  std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuad(
-      sgpp::op_factory::createOperationQuadratureMCAdvanced(grid, numSamples, seed));
+  auto createOperation = [&]() {
+    std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuad(
+        sgpp::op_factory::createOperationQuadratureMCAdvanced(grid, numSamples, seed));
 
-  switch (samplerType) {
-    case sgpp::quadrature::SamplerTypes::Naive:
-      opQuad->useNaiveMonteCarlo();
-      break;
+    switch (samplerType) {
+      case sgpp::quadrature::SamplerTypes::Naive:
+        opQuad->useNaiveMonteCarlo();
+        break;
 
-    case sgpp::quadrature::SamplerTypes::Stratified:
-      opQuad->useStratifiedMonteCarlo(blockSize);
-      break;
+      case sgpp::quadrature::SamplerTypes::Stratified:
+        opQuad->useStratifiedMonteCarlo(blockSize);
+        break;
 
-    case sgpp::quadrature::SamplerTypes::LatinHypercube:
-      opQuad->useLatinHypercubeMonteCarlo();
-      break;
+      case sgpp::quadrature::SamplerTypes::LatinHypercube:
+        opQuad->useLatinHypercubeMonteCarlo();
+        break;
 
-    case sgpp::quadrature::SamplerTypes::Halton:
-      opQuad->useQuasiMonteCarloWithHaltonSequences();
-      break;
+      case sgpp::quadrature::SamplerTypes::Halton:
+        opQuad->useQuasiMonteCarloWithHaltonSequences();
+        break;
 
-    default:
-      std::cout << "test_quadrature::testOperationQuadratureMCAdvanced : sampler type not available"
-                << std::endl;
-  }
+      case sgpp::quadrature::SamplerTypes::Sobol:
+        opQuad->useQuasiMonteCarloWithSobolSequences();
+        break;
+
+      case sgpp::quadrature::SamplerTypes::ScrambledSobol:
+        opQuad->useQuasiMonteCarloWithScrambledSobolSequences();
+        break;
+
+      default:
+        std::cout << "test_quadrature::testOperationQuadratureMCAdvanced : "
+                  << "sampler type not available" << std::endl;
+    }
+
+    return opQuad;
+  };
 
-  double resMC = opQuad->doQuadrature(alpha);
+  double resMC = createOperation()->doQuadrature(alpha);
   BOOST_CHECK_CLOSE(resMC, analyticResult, tol * 1e2);
+
+  // the result doesn't depend on the number of threads (the chunks are merged in order)
+  const int maxNumberOfThreads = omp_get_max_threads();
+
+  for (int numberOfThreads : {1, 2, 4}) {
+    omp_set_num_threads(numberOfThreads);
+    std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuad(createOperation());
+    opQuad->setChunkSize(numSamples / 10 + 7);
+    BOOST_CHECK_CLOSE(opQuad->doQuadrature(alpha), resMC, 1e-10);
+  }
+
+  omp_set_num_threads(maxNumberOfThreads);
 }
 
 BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
@@ -155,4 +186,315 @@ BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
                                     dim, numSamples, blockSize, analyticResult, 1e-3, seed);
   testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Halton, dim,
                                     numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Sobol, dim,
+                                    numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::ScrambledSobol,
+                                    dim, numSamples, blockSize, analyticResult, 1e-3, seed);
+}
+
+double fFunc(int dim, double* x, void* /*clientdata*/) {
+  double res = 1.0;
+
+  for (int i = 0; i < dim; i++) {
+    res *= 4 * (1 - x[i]) * x[i];
+  }
+
+  return res;
+}
+
+BOOST_AUTO_TEST_CASE(testSkipSamples) {
+  size_t dim = 3;
+  size_t numSamples = 1000;
+  uint64_t seed = 1234567;
+  std::vector<size_t> blockSize(dim, 4);
+
+  NaiveSampleGenerator pNSampler(dim, seed);
+  NaiveSampleGenerator pNCounterSampler(dim, seed, true);
+  HaltonSampleGenerator pHSampler(dim, seed);
+  LatinHypercubeSampleGenerator pLHSampler(dim, 30, seed);
+  LatinHypercubeSampleGenerator pLHCounterSampler(dim, 30, seed, true);
+  StratifiedSampleGenerator pSSampler(blockSize, seed);
+  StratifiedSampleGenerator pSCounterSampler(blockSize, seed, true);
+  SobolSampleGenerator pSobolSampler(dim);
+  SobolSampleGenerator pOwenSampler(dim, SobolScrambling::Owen, seed);
+  std::vector<SampleGenerator*> samplers = {
+      &pNSampler,        &pNCounterSampler, &pHSampler,     &pLHSampler,  &pLHCounterSampler,
+      &pSSampler,        &pSCounterSampler, &pSobolSampler, &pOwenSampler};
+
+  for (SampleGenerator* sampler : samplers) {
+    std::unique_ptr<SampleGenerator> skippingSampler(sampler->clone());
+    DataVector sample(dim);
+    DataVector skippedSample(dim);
+
+    // skip an irregular number of samples (crossing the end of strata sequences)
+    for (size_t numSkip : {0, 1, 7, 29, 64, 100}) {
+      for (size_t i = 0; i < numSkip; i++) {
+        sampler->getSample(sample);
+      }
+
+      skippingSampler->skipSamples(numSkip);
+
+      for (size_t i = 0; i < numSamples / 100; i++) {
+        sampler->getSample(sample);
+        skippingSampler->getSample(skippedSample);
+
+        for (size_t d = 0; d < dim; d++) {
+          BOOST_CHECK_EQUAL(sample[d], skippedSample[d]);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testDefaultRandomEngine) {
+  size_t dim = 3;
+  uint64_t seed = 1234567;
+
+  // by default, the samples are the ones of mt19937_64 with the given seed
+  NaiveSampleGenerator sampler(dim, seed);
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> uniformRealDist(0, 1);
+  DataVector sample(dim);
+
+  for (size_t i = 0; i < 100; i++) {
+    sampler.getSample(sample);
+
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_EQUAL(sample[d], uniformRealDist(rng));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMCAdvancedChunked) {
+  size_t dim = 2;
+  size_t numSamples = 20000;
+  double analyticResult = std::pow(2. / 3., dim);
+  std::uint64_t seed = 1234567;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createPolyGrid(dim, 2));
+  grid->getGenerator().regular(1);
+  DataVector alpha(1, 1.0);
+
+  // the samples and thus the result don't depend on the chunk size
+  std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuad(
+      sgpp::op_factory::createOperationQuadratureMCAdvanced(*grid, numSamples, seed));
+  opQuad->setChunkSize(numSamples);
+  double resOneChunk = opQuad->doQuadrature(alpha);
+  double varianceOneChunk = opQuad->getVariance();
+
+  // nor on the number of threads
+  const int maxNumberOfThreads = omp_get_max_threads();
+  double resChunked = 0.0;
+
+  for (int numberOfThreads : {1, 2, 4}) {
+    omp_set_num_threads(numberOfThreads);
+    opQuad.reset(sgpp::op_factory::createOperationQuadratureMCAdvanced(*grid, numSamples, seed));
+    opQuad->setChunkSize(333);
+    resChunked = opQuad->doQuadrature(alpha);
+
+    BOOST_CHECK_CLOSE(resChunked, resOneChunk, 1e-10);
+    BOOST_CHECK_CLOSE(opQuad->getVariance(), varianceOneChunk, 1e-8);
+    BOOST_CHECK_EQUAL(opQuad->getNumberOfSamplesUsed(), numSamples);
+  }
+
+  omp_set_num_threads(maxNumberOfThreads);
+  BOOST_CHECK_CLOSE(resChunked, analyticResult, 5.0);
+
+  // the standard error matches the actual error (up to a few standard deviations)
+  BOOST_CHECK_LT(std::abs(resChunked - analyticResult), 5.0 * opQuad->getStandardError());
+
+  // direct computation of the variance
+  sgpp::quadrature::NaiveSampleGenerator sampler(dim, seed, true);
+  DataVector sample(dim);
+  double sum = 0.0;
+  double sumSquares = 0.0;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    sampler.getSample(sample);
+    double value = f(sample);
+    sum += value;
+    sumSquares += value * value;
+  }
+
+  double mean = sum / static_cast<double>(numSamples);
+  double variance =
+      (sumSquares - static_cast<double>(numSamples) * mean * mean) /
+      (static_cast<double>(numSamples) - 1.0);
+  BOOST_CHECK_CLOSE(resChunked, mean, 1e-10);
+  BOOST_CHECK_CLOSE(opQuad->getVariance(), variance, 1e-6);
+
+  // functions are integrated in the same way
+  opQuad.reset(sgpp::op_factory::createOperationQuadratureMCAdvanced(*grid, numSamples, seed));
+  opQuad->setChunkSize(1000);
+  BOOST_CHECK_CLOSE(opQuad->doQuadratureFunc(fFunc, nullptr), mean, 1e-10);
+
+  // the grid function interpolates f exactly
+  opQuad->useQuasiMonteCarloWithHaltonSequences();
+  BOOST_CHECK_SMALL(opQuad->doQuadratureL2Error(fFunc, nullptr, alpha), 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMCAdvancedEarlyStopping) {
+  size_t dim = 2;
+  size_t numSamples = 10000000;
+  double targetStandardError = 1e-3;
+  std::uint64_t seed = 1234567;
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createPolyGrid(dim, 2));
+  grid->getGenerator().regular(1);
+  DataVector alpha(1, 1.0);
+
+  std::unique_ptr<sgpp::quadrature::OperationQuadratureMCAdvanced> opQuad(
+      sgpp::op_factory::createOperationQuadratureMCAdvanced(*grid, numSamples, seed));
+  opQuad->setChunkSize(1000);
+  opQuad->setTargetStandardError(targetStandardError);
+  double res = opQuad->doQuadrature(alpha);
+
+  BOOST_CHECK_LT(opQuad->getNumberOfSamplesUsed(), numSamples / 100);
+  BOOST_CHECK_LE(opQuad->getStandardError(), targetStandardError);
+  BOOST_CHECK_CLOSE(res, std::pow(2. / 3., dim), 2.0);
+}
+
+BOOST_AUTO_TEST_CASE(testSobolSampler) {
+  size_t dim = 4;
+  size_t numSamples = 4096;
+  double analyticResult = std::pow(2. / 3., dim);
+  DataVector sample(dim);
+
+  // first points of the sequence
+  SobolSampleGenerator sobolSampler(2);
+  DataVector point(2);
+  double expected[4][2] = {{0.0, 0.0}, {0.5, 0.5}, {0.75, 0.25}, {0.25, 0.75}};
+
+  for (size_t i = 0; i < 4; i++) {
+    sobolSampler.getSample(point);
+    BOOST_CHECK_EQUAL(point[0], expected[i][0]);
+    BOOST_CHECK_EQUAL(point[1], expected[i][1]);
+  }
+
+  // points of the sequence in the maximal dimension (reference values of the implementation
+  // with the same direction numbers in Boost.Random)
+  size_t maxDim = SobolSampleGenerator::MAX_DIMENSIONS;
+  DataVector highDimensionalPoint(maxDim);
+  std::vector<std::pair<size_t, std::vector<double>>> expectedHighDimensional = {
+      {5, {0.875, 0.875, 0.125, 0.375, 0.875, 0.625, 0.875, 0.375, 0.375, 0.125, 0.375,
+           0.875, 0.875, 0.125, 0.875, 0.375, 0.875, 0.375, 0.375, 0.625, 0.625}},
+      {1000, {0.2197265625, 0.0966796875, 0.5185546875, 0.6767578125, 0.2802734375,
+              0.9072265625, 0.0458984375, 0.8994140625, 0.5009765625, 0.0693359375,
+              0.0849609375, 0.2548828125, 0.1611328125, 0.3837890625, 0.1435546875,
+              0.3701171875, 0.7197265625, 0.3447265625, 0.9912109375, 0.7255859375,
+              0.5224609375}},
+      {123456789, {0.97589773684740067, 0.79243192821741104, 0.0064059123396873474,
+                   0.90878767520189285, 0.87485844641923904, 0.85136087983846664,
+                   0.97530753165483475, 0.69227422028779984, 0.64159045368432999,
+                   0.40392694622278214, 0.79387407749891281, 0.98108043521642685,
+                   0.36564821749925613, 0.72098179906606674, 0.97235245257616043,
+                   0.68673247843980789, 0.97121090441942215, 0.96110004931688309,
+                   0.17921707779169083, 0.97567873448133469, 0.23856609314680099}}};
+
+  for (const auto& expectedPoint : expectedHighDimensional) {
+    // both by jumping to the point and by generating the sequence up to it
+    SobolSampleGenerator jumpingSampler(maxDim);
+    jumpingSampler.skipSamples(expectedPoint.first);
+    jumpingSampler.getSample(highDimensionalPoint);
+
+    for (size_t d = 0; d < maxDim; d++) {
+      BOOST_CHECK_EQUAL(highDimensionalPoint[d], expectedPoint.second[d]);
+    }
+
+    if (expectedPoint.first <= 1000) {
+      SobolSampleGenerator sequentialSampler(maxDim);
+
+      for (size_t i = 0; i <= expectedPoint.first; i++) {
+        sequentialSampler.getSample(highDimensionalPoint);
+      }
+
+      for (size_t d = 0; d < maxDim; d++) {
+        BOOST_CHECK_EQUAL(highDimensionalPoint[d], expectedPoint.second[d]);
+      }
+    }
+  }
+
+  size_t tooManyDimensions = SobolSampleGenerator::MAX_DIMENSIONS + 1;
+  BOOST_CHECK_THROW(SobolSampleGenerator invalidSampler(tooManyDimensions),
+                    sgpp::base::application_exception);
+
+  // the sample has to match the dimension
+  DataVector wrongSizeSample(3);
+  BOOST_CHECK_THROW(sobolSampler.getSample(wrongSizeSample), sgpp::base::application_exception);
+
+  // the sequence ends after 2^32 points instead of wrapping around
+  const size_t numberOfPoints = size_t(1) << 32;
+  SobolSampleGenerator exhaustedSampler(2);
+  exhaustedSampler.skipSamples(numberOfPoints - 1);
+  exhaustedSampler.getSample(point);
+  BOOST_CHECK_THROW(exhaustedSampler.getSample(point), sgpp::base::application_exception);
+  BOOST_CHECK_THROW(SobolSampleGenerator(2).skipSamples(numberOfPoints + 1),
+                    sgpp::base::application_exception);
+
+  // the bulk generation agrees with single samples
+  for (SobolScrambling scrambling :
+       {SobolScrambling::None, SobolScrambling::DigitalShift, SobolScrambling::Owen}) {
+    SobolSampleGenerator sampler(dim, scrambling, 42);
+    std::unique_ptr<SampleGenerator> bulkSampler(sampler.clone());
+    sgpp::base::DataMatrix samples(100, dim);
+    sampler.skipSamples(3);
+    bulkSampler->skipSamples(3);
+    bulkSampler->getSamples(samples);
+
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      sampler.getSample(sample);
+
+      for (size_t d = 0; d < dim; d++) {
+        BOOST_CHECK_EQUAL(samples(i, d), sample[d]);
+        BOOST_CHECK_GE(sample[d], 0.0);
+        BOOST_CHECK_LT(sample[d], 1.0);
+      }
+    }
+  }
+
+  // Sobol points integrate the smooth function more accurately than Halton points
+  SobolSampleGenerator pSobolSampler(dim);
+  HaltonSampleGenerator pHSampler(dim);
+  double errorSobol = 0.0;
+  double errorHalton = 0.0;
+
+  for (size_t i = 0; i < numSamples; i++) {
+    pSobolSampler.getSample(sample);
+    errorSobol += f(sample);
+    pHSampler.getSample(sample);
+    errorHalton += f(sample);
+  }
+
+  errorSobol = std::abs(errorSobol / static_cast<double>(numSamples) - analyticResult);
+  errorHalton = std::abs(errorHalton / static_cast<double>(numSamples) - analyticResult);
+  BOOST_CHECK_LT(errorSobol, errorHalton);
+
+  // independent scrambled replicates estimate the integration error
+  size_t numReplicates = 16;
+  double mean = 0.0;
+  double sumSquares = 0.0;
+
+  for (size_t r = 0; r < numReplicates; r++) {
+    SobolSampleGenerator sampler(dim, SobolScrambling::Owen, 1000 + r);
+    double estimate = 0.0;
+
+    for (size_t i = 0; i < numSamples; i++) {
+      sampler.getSample(sample);
+      estimate += f(sample);
+    }
+
+    estimate /= static_cast<double>(numSamples);
+    double delta = estimate - mean;
+    mean += delta / static_cast<double>(r + 1);
+    sumSquares += delta * (estimate - mean);
+  }
+
+  double standardError =
+      std::sqrt(sumSquares / static_cast<double>(numReplicates - 1) /
+                static_cast<double>(numReplicates));
+  BOOST_CHECK_GT(standardError, 0.0);
+  BOOST_CHECK_LT(std::abs(mean - analyticResult), 5.0 * standardError);
+  // far more accurate than plain Monte Carlo (standard error of about 0.2 / sqrt(n))
+  BOOST_CHECK_LT(standardError,
+                 0.1 * 0.2 / std::sqrt(static_cast<double>(numSamples * numReplicates)));
 }
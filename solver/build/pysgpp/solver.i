@@ -9,7 +9,11 @@
 %include "solver/src/sgpp/solver/ODESolver.hpp"
 %feature("director") ConjugateGradients;
 %include "solver/src/sgpp/solver/sle/ConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/PipelinedConjugateGradients.hpp"
 %include "solver/src/sgpp/solver/sle/BiCGStab.hpp"
+%include "solver/src/sgpp/solver/sle/BlockConjugateGradients.hpp"
+%include "solver/src/sgpp/solver/sle/JacobiPreconditioner.hpp"
+%include "solver/src/sgpp/solver/sle/LevelScalingPreconditioner.hpp"
 %include "solver/src/sgpp/solver/ode/Euler.hpp"
 %include "solver/src/sgpp/solver/ode/CrankNicolson.hpp"
 %include "solver/src/sgpp/solver/TypesSolver.hpp"
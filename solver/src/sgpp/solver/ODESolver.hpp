@@ -12,6 +12,7 @@
 
 #include <sgpp/solver/SGSolver.hpp>
 #include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/ode/TimestepEngine.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -19,6 +20,10 @@ namespace sgpp {
 namespace solver {
 
 class ODESolver : public SGSolver {
+ protected:
+  /// executes the linear solves and collects the statistics of the time steps
+  TimestepEngine engine;
+
  public:
   /**
    * Std-Constructor
@@ -46,6 +51,12 @@ class ODESolver : public SGSolver {
   virtual void solve(SLESolver& LinearSystemSolver,
                      sgpp::solver::OperationParabolicPDESolverSystem& System,
                      bool bIdentifyLastStep = false, bool verbose = false) = 0;
+
+  /**
+   * @return the engine that executes the linear solves of the time steps, e.g. to disable
+   * warm starting or to set a callback for the statistics of each time step
+   */
+  TimestepEngine& getTimestepEngine() { return engine; }
 };
 
 }  // namespace solver
@@ -21,6 +21,10 @@ namespace sgpp {
 namespace solver {
 
 class SLESolver : public SGSolver {
+ protected:
+  /// preconditioner, applies an approximation of the inverse system matrix (NULL if none)
+  sgpp::base::OperationMatrix* preconditioner;
+
  public:
   /**
    * Std-Constructor
@@ -28,7 +32,7 @@ class SLESolver : public SGSolver {
    * @param imax number of maximum executed iterations
    * @param epsilon the final error in the iterative solver
    */
-  SLESolver(size_t imax, double epsilon) : SGSolver(imax, epsilon) {}
+  SLESolver(size_t imax, double epsilon) : SGSolver(imax, epsilon), preconditioner(NULL) {}
 
   /**
    * Std-Destructor
@@ -49,6 +53,23 @@ class SLESolver : public SGSolver {
   virtual void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
                      double max_threshold = DEFAULT_RES_THRESHOLD) = 0;
+
+  /**
+   * Sets the preconditioner that is used by subsequent calls of solve, e.g. a
+   * JacobiPreconditioner. The stopping criterion still refers to the unpreconditioned residual.
+   * Currently, ConjugateGradients and BiCGStab make use of it.
+   *
+   * @param preconditioner operation that applies an approximation of the inverse system matrix,
+   * NULL disables preconditioning; the solver does not take ownership
+   */
+  void setPreconditioner(sgpp::base::OperationMatrix* preconditioner) {
+    this->preconditioner = preconditioner;
+  }
+
+  /**
+   * @return the preconditioner, NULL if none is set
+   */
+  sgpp::base::OperationMatrix* getPreconditioner() { return preconditioner; }
 };
 
 }  // namespace solver
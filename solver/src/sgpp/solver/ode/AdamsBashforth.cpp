@@ -29,7 +29,7 @@ void AdamsBashforth::solve(SLESolver& LinearSystemSolver,
                            sgpp::solver::OperationParabolicPDESolverSystem& System,
                            bool bIdentifyLastStep, bool verbose) {
   size_t allIter = 0;
-  sgpp::base::DataVector* rhs;
+  engine.reset();
 
   for (size_t i = 0; i < this->nMaxIterations; i++) {
     if (i > 0)
@@ -37,11 +37,8 @@ void AdamsBashforth::solve(SLESolver& LinearSystemSolver,
     else
       System.setODESolver("ExEul");
 
-    // generate right hand side
-    rhs = System.generateRHS();
-
-    // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    // generate right hand side and solve the system of the current timestep
+    engine.solveTimestep(LinearSystemSolver, System, this->myEpsilon);
 
     allIter += LinearSystemSolver.getNumberIterations();
 
@@ -69,6 +66,7 @@ void AdamsBashforth::solve(SLESolver& LinearSystemSolver,
     }
 
     System.finishTimestep();
+    engine.acceptTimestep(System, static_cast<double>(i + 1) * this->myEpsilon, this->myEpsilon);
 
     if (bIdentifyLastStep == false) {
       System.coarsenAndRefine(false);
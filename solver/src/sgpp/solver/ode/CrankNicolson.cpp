@@ -23,14 +23,11 @@ void CrankNicolson::solve(SLESolver& LinearSystemSolver,
                           sgpp::solver::OperationParabolicPDESolverSystem& System,
                           bool bIdentifyLastStep, bool verbose) {
   size_t allIter = 0;
-  sgpp::base::DataVector* rhs = NULL;
+  engine.reset();
 
   for (size_t i = 0; i < this->nMaxIterations; i++) {
-    // generate right hand side
-    rhs = System.generateRHS();
-
-    // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    // generate right hand side and solve the system of the current timestep
+    engine.solveTimestep(LinearSystemSolver, System, this->myEpsilon);
     allIter += LinearSystemSolver.getNumberIterations();
 
     if (verbose == true) {
@@ -57,6 +54,7 @@ void CrankNicolson::solve(SLESolver& LinearSystemSolver,
     }
 
     System.finishTimestep();
+    engine.acceptTimestep(System, static_cast<double>(i + 1) * this->myEpsilon, this->myEpsilon);
 
     // Do some adjustments on the boundaries if needed, copy values back
     if (bIdentifyLastStep == false) {
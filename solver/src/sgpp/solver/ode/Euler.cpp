@@ -37,7 +37,7 @@ void Euler::solve(SLESolver& LinearSystemSolver,
                   sgpp::solver::OperationParabolicPDESolverSystem& System, bool bIdentifyLastStep,
                   bool verbose) {
   size_t allIter = 0;
-  sgpp::base::DataVector* rhs;
+  engine.reset();
 
   // Do some animation creation exception handling
   size_t animationStep = this->nMaxIterations / 1500;
@@ -62,11 +62,8 @@ void Euler::solve(SLESolver& LinearSystemSolver,
   }
 
   for (size_t i = 0; i < this->nMaxIterations; i++) {
-    // generate right hand side
-    rhs = System.generateRHS();
-
-    // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    // generate right hand side and solve the system of the current timestep
+    engine.solveTimestep(LinearSystemSolver, System, this->myEpsilon);
 
     allIter += LinearSystemSolver.getNumberIterations();
 
@@ -94,6 +91,7 @@ void Euler::solve(SLESolver& LinearSystemSolver,
     }
 
     System.finishTimestep();
+    engine.acceptTimestep(System, static_cast<double>(i + 1) * this->myEpsilon, this->myEpsilon);
 
     if (bIdentifyLastStep == false) {
       System.coarsenAndRefine(false);
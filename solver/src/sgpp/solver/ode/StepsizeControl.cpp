@@ -119,6 +119,7 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
   System.getGridCoefficientsForSC(YkImEul);
 
   rhs = NULL;
+  engine.reset();
 
   for (size_t i = 0; i < maxIter && time < maxTimestep; i++) {
     YkAdBas.resize(System.getGridCoefficients()->getSize());
@@ -140,12 +141,14 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
         tmp_timestepsize = _gamma * tmp_timestepsize;
 
       System.abortTimestep();
+      engine.rejectTimestep();
       allIter += LinearSystemSolver.getNumberIterations();
 
     } else {
       fileout << i << " " << (tmp_timestepsize_new - tmp_timestepsize) << " " << time << " "
               << tmp_timestepsize << std::endl;
       time += tmp_timestepsize;
+      engine.acceptTimestep(System, time, tmp_timestepsize);
       allIter += LinearSystemSolver.getNumberIterations();
 
       if (verbose == true) {
@@ -53,11 +53,8 @@ void StepsizeControlEJ::corrector(SLESolver& LinearSystemSolver,
 
   System.setTimestepSize(tmp_timestepsize);
 
-  // generate right hand side
-  rhs = System.generateRHS();
-
-  // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  // generate right hand side and solve the system of the current timestep
+  engine.solveTimestep(LinearSystemSolver, System, tmp_timestepsize);
 
   System.finishTimestep();
   dv.resize(System.getGridCoefficients()->getSize());
@@ -39,11 +39,8 @@ void StepsizeControlH::predictor(SLESolver& LinearSystemSolver,
   System.setODESolver(_odesolver);
   System.setTimestepSize(tmp_timestepsize);
 
-  // generate right hand side
-  rhs = System.generateRHS();
-
-  // solve the system of the current timesteps
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  // generate right hand side and solve the system of the current timestep
+  engine.solveTimestep(LinearSystemSolver, System, tmp_timestepsize);
 
   System.finishTimestep();
 
@@ -60,16 +57,11 @@ void StepsizeControlH::corrector(SLESolver& LinearSystemSolver,
   System.setODESolver(_odesolver);
   System.setTimestepSize(tmp_timestepsize / 2.0);
 
-  // generate right hand side
-  rhs = System.generateRHS();
-
-  // solve the system of the current timesteps
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  // generate right hand side and solve the system of the current timestep
+  engine.solveTimestep(LinearSystemSolver, System, tmp_timestepsize / 2.0);
   System.finishTimestep();
 
-  rhs = System.generateRHS();
-
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  engine.solveTimestep(LinearSystemSolver, System, tmp_timestepsize / 2.0);
   System.finishTimestep();
 
   dv.resize(System.getGridCoefficients()->getSize());
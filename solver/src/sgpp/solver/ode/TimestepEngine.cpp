@@ -0,0 +1,99 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/ode/TimestepEngine.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+TimestepEngine::TimestepEngine() : warmStart(true) { reset(); }
+
+TimestepEngine::~TimestepEngine() {}
+
+void TimestepEngine::reset() {
+  statistics = TimestepStatistics();
+  lastStatistics = TimestepStatistics();
+  stepInProgress = false;
+  stepStartHash = 0;
+  incrementHash = 0;
+  incrementTimestepSize = 0.0;
+  incrementValid = false;
+  numberTimesteps = 0;
+  totalIterations = 0;
+  totalRejections = 0;
+  stopwatch.start();
+}
+
+void TimestepEngine::solveTimestep(SLESolver& LinearSystemSolver,
+                                   sgpp::solver::OperationParabolicPDESolverSystem& System,
+                                   double timestepSize) {
+  // generate right hand side (before the starting vector is modified)
+  sgpp::base::DataVector* rhs = System.generateRHS();
+  sgpp::base::DataVector* alpha = System.getGridCoefficientsForCG();
+
+  if (!stepInProgress) {
+    // the grid doesn't change during a time step, so it's hashed only once
+    stepStart = *alpha;
+    stepStartHash = System.getGridStorage()->computeHash();
+    stepInProgress = true;
+  }
+
+  // extrapolate starting vector
+  if (warmStart && incrementValid && (increment.getSize() == alpha->getSize()) &&
+      (incrementHash == stepStartHash)) {
+    alpha->axpy(timestepSize / incrementTimestepSize, increment);
+  }
+
+  // solve the system of the current timestep
+  LinearSystemSolver.solve(System, *alpha, *rhs, true, false, -1.0);
+
+  statistics.iterations += LinearSystemSolver.getNumberIterations();
+  statistics.residuum = LinearSystemSolver.getResiduum();
+  totalIterations += LinearSystemSolver.getNumberIterations();
+}
+
+void TimestepEngine::rejectTimestep() {
+  statistics.rejections++;
+  totalRejections++;
+}
+
+const TimestepStatistics& TimestepEngine::acceptTimestep(
+    sgpp::solver::OperationParabolicPDESolverSystem& System, double time, double timestepSize) {
+  sgpp::base::DataVector* alpha = System.getGridCoefficientsForCG();
+  incrementValid = stepInProgress && (alpha->getSize() == stepStart.getSize()) &&
+                   (timestepSize > 0.0);
+
+  if (incrementValid) {
+    // the vectors keep their memory, so they are allocated only if the grid grows
+    increment = *alpha;
+    increment.sub(stepStart);
+    incrementHash = stepStartHash;
+    incrementTimestepSize = timestepSize;
+  }
+
+  statistics.step = numberTimesteps;
+  statistics.time = time;
+  statistics.timestepSize = timestepSize;
+  statistics.wallTime = stopwatch.stop();
+
+  if (callback) {
+    callback(statistics);
+  }
+
+  numberTimesteps++;
+  stepInProgress = false;
+
+  // statistics of the last time step stay available until the next one is accepted
+  lastStatistics = statistics;
+  statistics = TimestepStatistics();
+  stopwatch.start();
+
+  return lastStatistics;
+}
+
+}  // namespace solver
+}  // namespace sgpp
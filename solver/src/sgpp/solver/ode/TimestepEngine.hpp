@@ -0,0 +1,181 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef TIMESTEPENGINE_HPP
+#define TIMESTEPENGINE_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/solver/SLESolver.hpp>
+#include <sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Statistics of one accepted time step, reported by TimestepEngine
+ */
+struct TimestepStatistics {
+  /// number of the time step (starting with 0)
+  size_t step;
+  /// time at the end of the time step
+  double time;
+  /// size of the accepted time step
+  double timestepSize;
+  /// iterations of all linear solves of the time step, including rejected attempts
+  size_t iterations;
+  /// number of rejected attempts before the time step was accepted
+  size_t rejections;
+  /// residuum of the last linear solve
+  double residuum;
+  /// wall time in seconds spent on the time step, including rejected attempts
+  double wallTime;
+};
+
+/**
+ * Executes the linear solves of the ODE solvers (Euler, CrankNicolson, AdamsBashforth and the
+ * StepsizeControl variants) and keeps state across the time steps.
+ *
+ * If warm starting is enabled, the starting vector of the iterative solver is extrapolated
+ * linearly in time from the increment of the last accepted time step, i.e.,
+ * \f$x^{(0)} = x_n + \frac{\tau}{\tau_{\text{last}}} (x_n - x_{n-1})\f$, instead of just
+ * starting with \f$x_n\f$. The extrapolation is skipped if the grid has changed in between.
+ * The vectors needed for this are allocated once and reused in every time step.
+ * The SLESolver (including a preconditioner set by SLESolver::setPreconditioner) is left as it
+ * is, so its state persists over all time steps.
+ *
+ * After each accepted time step, its TimestepStatistics are passed to an optional callback.
+ */
+class TimestepEngine {
+ public:
+  /// type of the callback that is called after each accepted time step
+  typedef std::function<void(const TimestepStatistics&)> Callback;
+
+  /**
+   * Std-Constructor, warm starting is enabled
+   */
+  TimestepEngine();
+
+  /**
+   * Std-Destructor
+   */
+  ~TimestepEngine();
+
+  /**
+   * Discards the history and the statistics, has to be called at the beginning of a
+   * time integration.
+   */
+  void reset();
+
+  /**
+   * Generates the right hand side of System and solves the system of the current time step.
+   * The mode and the time step size have to be set in System before.
+   *
+   * @param LinearSystemSolver solver for the system of linear equations
+   * @param System system of the time step
+   * @param timestepSize size of the (sub-)step, used for the extrapolation of the starting
+   * vector
+   */
+  void solveTimestep(SLESolver& LinearSystemSolver,
+                     sgpp::solver::OperationParabolicPDESolverSystem& System,
+                     double timestepSize);
+
+  /**
+   * Marks the current attempt of a time step as rejected.
+   * The next call of solveTimestep starts a new attempt of the same time step.
+   */
+  void rejectTimestep();
+
+  /**
+   * Marks the current time step as accepted, has to be called after
+   * OperationParabolicPDESolverSystem::finishTimestep and before
+   * OperationParabolicPDESolverSystem::coarsenAndRefine.
+   * Calls the callback with the statistics of the time step.
+   *
+   * @param System system of the time step
+   * @param time time at the end of the time step
+   * @param timestepSize size of the accepted time step
+   * @return statistics of the time step
+   */
+  const TimestepStatistics& acceptTimestep(
+      sgpp::solver::OperationParabolicPDESolverSystem& System, double time, double timestepSize);
+
+  /**
+   * @return statistics of the last accepted time step
+   */
+  const TimestepStatistics& getLastStatistics() const { return lastStatistics; }
+
+  /**
+   * @param warmStart whether the starting vectors should be extrapolated
+   */
+  void setWarmStart(bool warmStart) { this->warmStart = warmStart; }
+
+  /**
+   * @return whether the starting vectors are extrapolated
+   */
+  bool getWarmStart() const { return warmStart; }
+
+  /**
+   * @param callback function that is called after each accepted time step
+   * (an empty function disables the callback)
+   */
+  void setCallback(const Callback& callback) { this->callback = callback; }
+
+  /**
+   * @return number of accepted time steps since the last reset
+   */
+  size_t getNumberTimesteps() const { return numberTimesteps; }
+
+  /**
+   * @return total number of iterations of the linear solves since the last reset
+   */
+  size_t getTotalIterations() const { return totalIterations; }
+
+  /**
+   * @return total number of rejected attempts since the last reset
+   */
+  size_t getTotalRejections() const { return totalRejections; }
+
+ protected:
+  /// whether the starting vectors are extrapolated
+  bool warmStart;
+  /// callback after each accepted time step
+  Callback callback;
+  /// statistics of the current time step
+  TimestepStatistics statistics;
+  /// statistics of the last accepted time step
+  TimestepStatistics lastStatistics;
+  /// measures the wall time of the current time step
+  sgpp::base::SGppStopwatch stopwatch;
+  /// whether the current time step has been started, i.e., stepStart is valid
+  bool stepInProgress;
+  /// coefficients at the beginning of the current time step
+  sgpp::base::DataVector stepStart;
+  /// hash of the grid at the beginning of the current time step
+  size_t stepStartHash;
+  /// increment of the coefficients during the last accepted time step
+  sgpp::base::DataVector increment;
+  /// hash of the grid of increment
+  size_t incrementHash;
+  /// size of the last accepted time step
+  double incrementTimestepSize;
+  /// whether increment is valid
+  bool incrementValid;
+  /// number of accepted time steps
+  size_t numberTimesteps;
+  /// total number of iterations
+  size_t totalIterations;
+  /// total number of rejected attempts
+  size_t totalRejections;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* TIMESTEPENGINE_HPP */
@@ -43,11 +43,8 @@ void VarTimestep::predictor(SLESolver& LinearSystemSolver,
 
   System.setODESolver("AdBas");
 
-  // generate right hand side
-  rhs = System.generateRHS();
-
-  // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  // generate right hand side and solve the system of the current timestep
+  engine.solveTimestep(LinearSystemSolver, System, tmp_timestepsize);
 
   System.finishTimestep();
 
@@ -64,11 +61,8 @@ void VarTimestep::corrector(SLESolver& LinearSystemSolver,
                             sgpp::base::DataVector* rhs) {
   System.setODESolver("CrNic");
 
-  // generate right hand side
-  rhs = System.generateRHS();
-
-  // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  // generate right hand side and solve the system of the current timestep
+  engine.solveTimestep(LinearSystemSolver, System, tmp_timestepsize);
 
   System.finishTimestep();
 
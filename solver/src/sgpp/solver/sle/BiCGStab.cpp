@@ -57,10 +57,22 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
   v.setAll(0.0);
   w.setAll(0.0);
 
+  // right preconditioning: the search directions are preconditioned before the
+  // multiplication with the system matrix
+  bool precondition = (this->preconditioner != NULL);
+  sgpp::base::DataVector pHatStorage(precondition ? alpha.getSize() : 0);
+  sgpp::base::DataVector wHatStorage(precondition ? alpha.getSize() : 0);
+  sgpp::base::DataVector& pHat = precondition ? pHatStorage : p;
+  sgpp::base::DataVector& wHat = precondition ? wHatStorage : w;
+
   while (this->nIterations < this->nMaxIterations) {
     // s  = Ap
+    if (precondition) {
+      this->preconditioner->mult(p, pHat);
+    }
+
     s.setAll(0.0);
-    SystemMatrix.mult(p, s);
+    SystemMatrix.mult(pHat, s);
 
     // std::cout << "s " << s.get(0) << " " << s.get(1)  << std::endl;
 
@@ -77,16 +89,20 @@ void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::Data
     w.axpy((-1.0) * a, s);
 
     // v = Aw
+    if (precondition) {
+      this->preconditioner->mult(w, wHat);
+    }
+
     v.setAll(0.0);
-    SystemMatrix.mult(w, v);
+    SystemMatrix.mult(wHat, v);
 
     // std::cout << "v " << v.get(0) << " " << v.get(1)  << std::endl;
 
     omega = (v.dotProduct(w)) / (v.dotProduct(v));
 
     // x = x - a*p - omega*w
-    alpha.axpy((-1.0) * a, p);
-    alpha.axpy((-1.0) * omega, w);
+    alpha.axpy((-1.0) * a, pHat);
+    alpha.axpy((-1.0) * omega, wHat);
 
     // r = r - a*s - omega*v
     r.axpy((-1.0) * a, s);
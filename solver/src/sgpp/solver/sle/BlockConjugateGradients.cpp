@@ -0,0 +1,227 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/solver_exception.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+namespace {
+
+/// copies the given columns of the vectors into the matrix (one row per unknown)
+void packColumns(std::vector<sgpp::base::DataVector>& vectors, const std::vector<size_t>& columns,
+                 sgpp::base::DataMatrix& matrix) {
+  const size_t n = matrix.getNrows();
+  const size_t k = columns.size();
+  double* data = matrix.getPointer();
+
+  for (size_t c = 0; c < k; c++) {
+    const double* vector = vectors[columns[c]].getPointer();
+
+    for (size_t i = 0; i < n; i++) {
+      data[i * k + c] = vector[i];
+    }
+  }
+}
+
+/// copies column c of the matrix into the vector
+void unpackColumn(sgpp::base::DataMatrix& matrix, size_t c, sgpp::base::DataVector& vector) {
+  const size_t n = matrix.getNrows();
+  const size_t k = matrix.getNcols();
+  const double* data = matrix.getPointer();
+
+  for (size_t i = 0; i < n; i++) {
+    vector[i] = data[i * k + c];
+  }
+}
+
+}  // namespace
+
+BlockConjugateGradients::BlockConjugateGradients(size_t imax, double epsilon)
+    : SLESolver(imax, epsilon) {}
+
+BlockConjugateGradients::~BlockConjugateGradients() {}
+
+void BlockConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                    sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                    bool reuse, bool verbose, double max_threshold) {
+  sgpp::base::DataMatrix alphaBlock(alpha.getSize(), 1);
+  sgpp::base::DataMatrix bBlock(b.getSize(), 1);
+  alphaBlock.setColumn(0, alpha);
+  bBlock.setColumn(0, b);
+
+  solveBlock(SystemMatrix, alphaBlock, bBlock, reuse, verbose, max_threshold);
+  alphaBlock.getColumn(0, alpha);
+}
+
+void BlockConjugateGradients::solveBlock(sgpp::base::OperationMatrix& SystemMatrix,
+                                         sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& b,
+                                         bool reuse, bool verbose, double max_threshold) {
+  const size_t n = b.getNrows();
+  const size_t k = b.getNcols();
+
+  if ((alpha.getNrows() != n) || (alpha.getNcols() != k)) {
+    throw sgpp::base::solver_exception(
+        "BlockConjugateGradients::solveBlock : alpha and b must have the same shape");
+  }
+
+  if (verbose == true) {
+    std::cout << "Starting Block Conjugated Gradients with " << k << " right hand sides"
+              << std::endl;
+  }
+
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  const bool preconditioned = (this->preconditioner != NULL);
+  this->nIterations = 0;
+  columnIterations.assign(k, 0);
+  columnResiduals.assign(k, 0.0);
+
+  if (reuse == false) {
+    alpha.setAll(0.0);
+  }
+
+  // starting residuals r = b - A*x
+  sgpp::base::DataMatrix temp(n, k);
+  SystemMatrix.multBlock(alpha, temp);
+
+  std::vector<sgpp::base::DataVector> x(k, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> r(k, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> z(preconditioned ? k : 0, sgpp::base::DataVector(n));
+  std::vector<sgpp::base::DataVector> d(k, sgpp::base::DataVector(n));
+  std::vector<double> delta0(k);
+  std::vector<double> rho(k);
+  std::vector<size_t> active;
+
+  for (size_t j = 0; j < k; j++) {
+    alpha.getColumn(j, x[j]);
+    b.getColumn(j, r[j]);
+    // as in ConjugateGradients, the tolerance is relative to the norm of b (i.e., the residual
+    // of the zero vector), also if the starting values are reused
+    delta0[j] = r[j].dotProduct(r[j]) * epsilonSquared;
+
+    sgpp::base::DataVector Ax(n);
+    temp.getColumn(j, Ax);
+    r[j].sub(Ax);
+    columnResiduals[j] = r[j].dotProduct(r[j]);
+
+    if (preconditioned) {
+      this->preconditioner->mult(r[j], z[j]);
+      rho[j] = r[j].dotProduct(z[j]);
+      d[j].copyFrom(z[j]);
+    } else {
+      rho[j] = columnResiduals[j];
+      d[j].copyFrom(r[j]);
+    }
+
+    if ((columnResiduals[j] > delta0[j]) && (columnResiduals[j] > max_threshold)) {
+      active.push_back(j);
+    }
+  }
+
+  sgpp::base::DataMatrix dBlock;
+  sgpp::base::DataMatrix qBlock;
+  sgpp::base::DataVector q(n);
+
+  while ((this->nIterations < this->nMaxIterations) && !active.empty()) {
+    const size_t numActive = active.size();
+    dBlock.resize(n, numActive);
+    qBlock.resize(n, numActive);
+
+    // q = A*d for all columns that have not converged yet
+    packColumns(d, active, dBlock);
+    SystemMatrix.multBlock(dBlock, qBlock);
+
+    // residuals are recomputed from scratch from time to time, as in ConjugateGradients
+    const bool recompute = ((this->nIterations % 50) == 0) && (this->nIterations > 0);
+    std::vector<size_t> stillActive;
+
+    for (size_t c = 0; c < numActive; c++) {
+      const size_t j = active[c];
+      unpackColumn(qBlock, c, q);
+      double dq = d[j].dotProduct(q);
+
+      if (dq == 0.0) {
+        continue;
+      }
+
+      double a = rho[j] / dq;
+      x[j].axpy(a, d[j]);
+
+      if (!recompute) {
+        r[j].axpy(-a, q);
+      }
+
+      columnIterations[j]++;
+      stillActive.push_back(j);
+    }
+
+    if (recompute && !stillActive.empty()) {
+      sgpp::base::DataMatrix xBlock(n, stillActive.size());
+      packColumns(x, stillActive, xBlock);
+      temp.resize(n, stillActive.size());
+      SystemMatrix.multBlock(xBlock, temp);
+
+      for (size_t c = 0; c < stillActive.size(); c++) {
+        const size_t j = stillActive[c];
+        b.getColumn(j, r[j]);
+        unpackColumn(temp, c, q);
+        r[j].sub(q);
+      }
+    }
+
+    active.clear();
+
+    for (size_t j : stillActive) {
+      columnResiduals[j] = r[j].dotProduct(r[j]);
+      double rhoOld = rho[j];
+
+      if (preconditioned) {
+        this->preconditioner->mult(r[j], z[j]);
+        rho[j] = r[j].dotProduct(z[j]);
+      } else {
+        rho[j] = columnResiduals[j];
+      }
+
+      // deflation: converged columns leave the block
+      if ((columnResiduals[j] <= delta0[j]) || (columnResiduals[j] <= max_threshold)) {
+        continue;
+      }
+
+      d[j].mult(rho[j] / rhoOld);
+      d[j].add(preconditioned ? z[j] : r[j]);
+      active.push_back(j);
+    }
+
+    this->nIterations++;
+
+    if (verbose == true) {
+      std::cout << "iteration " << this->nIterations << ": " << active.size() << " of " << k
+                << " columns active" << std::endl;
+    }
+  }
+
+  for (size_t j = 0; j < k; j++) {
+    alpha.setColumn(j, x[j]);
+  }
+
+  this->residuum = (k > 0) ? *std::max_element(columnResiduals.begin(), columnResiduals.end())
+                           : 0.0;
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final maximum norm of residuum: " << this->residuum << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
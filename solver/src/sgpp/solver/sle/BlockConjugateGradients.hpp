@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BLOCKCONJUGATEGRADIENTS_HPP
+#define BLOCKCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/solver/SLESolver.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Conjugate gradients for several right hand sides with the same system matrix, e.g. one per
+ * class in a classification task.
+ *
+ * Each column runs its own (optionally preconditioned) CG recurrence, but the system matrix is
+ * applied to the search directions of all columns with one call of
+ * sgpp::base::OperationMatrix::multBlock. Operators that override multBlock (e.g.
+ * datadriven::DMSystemMatrix) thus stream the grid and the data set only once per iteration.
+ * Columns whose residual has dropped below the tolerance are deflated, i.e., removed from the
+ * block, so that the remaining iterations only pay for the columns that have not converged yet.
+ */
+class BlockConjugateGradients : public SLESolver {
+ public:
+  /**
+   * Constructor
+   *
+   * @param imax maximum number of iterations (i.e., block matrix applications)
+   * @param epsilon tolerance of the residual norm of each column relative to the norm of the
+   * column of b (as in ConjugateGradients, also if the starting values are reused)
+   */
+  BlockConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Destructor
+   */
+  ~BlockConjugateGradients() override;
+
+  /**
+   * Solves the system for one right hand side (a block with one column).
+   */
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+  /**
+   * Solves the system for all columns of b.
+   *
+   * @param SystemMatrix the system matrix, should override multBlock
+   * @param alpha matrix with one row per unknown and one column per right hand side, contains
+   * the solutions afterwards
+   * @param b the right hand sides, same shape as alpha
+   * @param reuse identifies if the columns of alpha should be used as starting values
+   * @param verbose prints information during execution of the solver
+   * @param max_threshold additional absolute threshold for the squared residual norms
+   */
+  void solveBlock(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataMatrix& alpha,
+                  sgpp::base::DataMatrix& b, bool reuse = false, bool verbose = false,
+                  double max_threshold = -1.0);
+
+  /**
+   * @return number of iterations each column needed in the last call of solveBlock
+   */
+  const std::vector<size_t>& getColumnIterations() const { return columnIterations; }
+
+  /**
+   * @return squared residual norm of each column after the last call of solveBlock
+   */
+  const std::vector<double>& getColumnResiduals() const { return columnResiduals; }
+
+ protected:
+  /// number of iterations of each column in the last solve
+  std::vector<size_t> columnIterations;
+  /// squared residual norm of each column after the last solve
+  std::vector<double> columnResiduals;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* BLOCKCONJUGATEGRADIENTS_HPP */
@@ -37,10 +37,14 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
   sgpp::base::DataVector temp(alpha.getSize());
   sgpp::base::DataVector q(alpha.getSize());
   sgpp::base::DataVector r(b);
+  // preconditioned residuum, only needed if a preconditioner is set
+  sgpp::base::DataVector z(this->preconditioner != NULL ? alpha.getSize() : 0);
 
   double delta_0 = 0.0;
-  double delta_old = 0.0;
   double delta_new = 0.0;
+  // r.z, equals delta_new without preconditioner
+  double rho_old = 0.0;
+  double rho_new = 0.0;
   double beta = 0.0;
   double a = 0.0;
 
@@ -63,11 +67,17 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
 
   r.sub(temp);
 
-  sgpp::base::DataVector d(r);
-
-  delta_old = 0.0;
   delta_new = r.dotProduct(r);
 
+  if (this->preconditioner != NULL) {
+    this->preconditioner->mult(r, z);
+    rho_new = r.dotProduct(z);
+  } else {
+    rho_new = delta_new;
+  }
+
+  sgpp::base::DataVector d((this->preconditioner != NULL) ? z : r);
+
   if (reuse == false) {
     delta_0 = delta_new * epsilonSquared;
     // delta_0 = delta_new;
@@ -101,8 +111,8 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
       break;
     }
 
-    // a = d_new / d.q
-    a = delta_new / d.dotProduct(q);
+    // a = rho_new / d.q
+    a = rho_new / dq;
 
     // x = x + a*d
     alpha.axpy(a, d);
@@ -119,9 +129,17 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     }
 
     // calculate new deltas and determine beta
-    delta_old = delta_new;
     delta_new = r.dotProduct(r);
-    beta = delta_new / delta_old;
+    rho_old = rho_new;
+
+    if (this->preconditioner != NULL) {
+      this->preconditioner->mult(r, z);
+      rho_new = r.dotProduct(z);
+    } else {
+      rho_new = delta_new;
+    }
+
+    beta = rho_new / rho_old;
 
 #ifdef X86_MIC_SYMMETRIC
     MPI_Bcast(&delta_new, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
@@ -135,7 +153,7 @@ void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
     }
 
     d.mult(beta);
-    d.add(r);
+    d.add((this->preconditioner != NULL) ? z : r);
 
     this->nIterations++;
   }
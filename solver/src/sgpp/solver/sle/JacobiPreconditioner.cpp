@@ -0,0 +1,57 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/JacobiPreconditioner.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+JacobiPreconditioner::JacobiPreconditioner() : inverseDiagonal(0) {}
+
+JacobiPreconditioner::JacobiPreconditioner(const sgpp::base::DataVector& diagonal)
+    : inverseDiagonal(0) {
+  setDiagonal(diagonal);
+}
+
+JacobiPreconditioner::JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperation,
+                                           size_t size)
+    : inverseDiagonal(0) {
+  // the diagonal of a diagonal matrix is its product with the ones vector
+  sgpp::base::DataVector ones(size, 1.0);
+  sgpp::base::DataVector diagonal(size);
+  diagonalOperation.mult(ones, diagonal);
+  setDiagonal(diagonal);
+}
+
+JacobiPreconditioner::~JacobiPreconditioner() {}
+
+void JacobiPreconditioner::setDiagonal(const sgpp::base::DataVector& diagonal) {
+  inverseDiagonal.resize(diagonal.getSize());
+
+  for (size_t i = 0; i < diagonal.getSize(); i++) {
+    inverseDiagonal[i] = (diagonal[i] != 0.0) ? (1.0 / diagonal[i]) : 1.0;
+  }
+}
+
+void JacobiPreconditioner::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  const size_t size = alpha.getSize();
+
+  if (size != inverseDiagonal.getSize()) {
+    throw sgpp::base::solver_exception("JacobiPreconditioner::mult : dimension mismatch");
+  }
+
+  result.resize(size);
+
+#pragma omp parallel for
+  for (size_t i = 0; i < size; i++) {
+    result[i] = inverseDiagonal[i] * alpha[i];
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
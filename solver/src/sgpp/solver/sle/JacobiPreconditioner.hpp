@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef JACOBIPRECONDITIONER_HPP
+#define JACOBIPRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Jacobi (diagonal) preconditioner for the iterative solvers, see
+ * SLESolver::setPreconditioner. It applies the inverse of a given diagonal.
+ * Zero entries of the diagonal are treated as ones.
+ */
+class JacobiPreconditioner : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor
+   *
+   * @param diagonal the diagonal of the system matrix
+   */
+  explicit JacobiPreconditioner(const sgpp::base::DataVector& diagonal);
+
+  /**
+   * Constructor, takes the diagonal from an operation that applies a diagonal matrix,
+   * e.g. sgpp::base::OperationDiagonal
+   *
+   * @param diagonalOperation operation that applies a diagonal matrix
+   * @param size number of rows of the matrix
+   */
+  JacobiPreconditioner(sgpp::base::OperationMatrix& diagonalOperation, size_t size);
+
+  /**
+   * Destructor
+   */
+  virtual ~JacobiPreconditioner();
+
+  /**
+   * Divides alpha by the diagonal
+   *
+   * @param alpha vector the preconditioner is applied to
+   * @param result the result
+   */
+  virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
+
+  /**
+   * @return the inverse of the diagonal
+   */
+  const sgpp::base::DataVector& getInverseDiagonal() const { return inverseDiagonal; }
+
+ protected:
+  /**
+   * Constructor for derived classes, which have to call setDiagonal
+   */
+  JacobiPreconditioner();
+
+  /**
+   * @param diagonal the diagonal of the system matrix
+   */
+  void setDiagonal(const sgpp::base::DataVector& diagonal);
+
+  /// entrywise inverse of the diagonal
+  sgpp::base::DataVector inverseDiagonal;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* JACOBIPRECONDITIONER_HPP */
@@ -0,0 +1,63 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/LevelScalingPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <map>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+LevelScalingPreconditioner::LevelScalingPreconditioner(sgpp::base::OperationMatrix& systemMatrix,
+                                                       sgpp::base::GridStorage& storage)
+    : JacobiPreconditioner(), numberOfProbes(0) {
+  const size_t size = storage.getSize();
+  const size_t dim = storage.getDimension();
+
+  // group the points by level; on the boundary (level 0), the functions with index 0 and 1
+  // overlap and are put into different groups
+  std::map<std::vector<size_t>, std::vector<size_t>> groups;
+  std::vector<size_t> key(2 * dim);
+
+  for (size_t i = 0; i < size; i++) {
+    sgpp::base::GridPoint& point = storage.getPoint(i);
+
+    for (size_t d = 0; d < dim; d++) {
+      key[2 * d] = point.getLevel(d);
+      key[2 * d + 1] = (point.getLevel(d) == 0) ? point.getIndex(d) : 0;
+    }
+
+    groups[key].push_back(i);
+  }
+
+  sgpp::base::DataVector diagonal(size);
+  sgpp::base::DataVector probe(size);
+  sgpp::base::DataVector product(size);
+
+  for (auto& group : groups) {
+    probe.setAll(0.0);
+
+    for (size_t i : group.second) {
+      probe[i] = 1.0;
+    }
+
+    systemMatrix.mult(probe, product);
+
+    for (size_t i : group.second) {
+      diagonal[i] = product[i];
+    }
+  }
+
+  numberOfProbes = groups.size();
+  setDiagonal(diagonal);
+}
+
+LevelScalingPreconditioner::~LevelScalingPreconditioner() {}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,64 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef LEVELSCALINGPRECONDITIONER_HPP
+#define LEVELSCALINGPRECONDITIONER_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/JacobiPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Multilevel diagonal scaling for systems in the hierarchical basis of a sparse grid.
+ * Each basis function is scaled by the inverse of its energy (the diagonal entry of the
+ * system matrix), which is the hierarchical counterpart of the level scaling of BPX-type
+ * preconditioners.
+ *
+ * The system matrix does not have to be assembled: the grid points are grouped by their level
+ * (and by their index in dimensions with level 0, i.e. on the boundary). The basis functions of
+ * one group have disjoint supports, hence applying the system matrix to the indicator vector of
+ * a group yields the diagonal entries of all its members. This takes one matrix-vector product
+ * per group, i.e. per level of the grid, instead of one per grid point.
+ *
+ * This is exact for operators whose entries vanish for basis functions with disjoint supports
+ * (mass, stiffness and regression matrices) and for bases whose functions of the same level do
+ * not overlap (e.g. piecewise linear bases).
+ */
+class LevelScalingPreconditioner : public JacobiPreconditioner {
+ public:
+  /**
+   * Constructor, determines the diagonal of the system matrix
+   *
+   * @param systemMatrix the system matrix
+   * @param storage storage of the grid the system matrix is defined on
+   */
+  LevelScalingPreconditioner(sgpp::base::OperationMatrix& systemMatrix,
+                             sgpp::base::GridStorage& storage);
+
+  /**
+   * Destructor
+   */
+  virtual ~LevelScalingPreconditioner();
+
+  /**
+   * @return number of products with the system matrix needed to determine the diagonal
+   */
+  size_t getNumberOfProbes() const { return numberOfProbes; }
+
+ protected:
+  /// number of products with the system matrix needed to determine the diagonal
+  size_t numberOfProbes;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* LEVELSCALINGPRECONDITIONER_HPP */
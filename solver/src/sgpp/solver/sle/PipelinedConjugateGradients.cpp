@@ -0,0 +1,300 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(size_t imax, double epsilon)
+    : ConjugateGradients(imax, epsilon),
+      numChunks(1),
+      operatorDuration(0.0),
+      preconditionerDuration(0.0),
+      updateDuration(0.0),
+      reductionDuration(0.0) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::computePartialSums(const double* r, const double* u,
+                                                     const double* w, size_t size) {
+#pragma omp parallel for schedule(static)
+  for (size_t chunk = 0; chunk < numChunks; chunk++) {
+    double rr = 0.0;
+    double ru = 0.0;
+    double wu = 0.0;
+
+    for (size_t i = chunk * size / numChunks; i < (chunk + 1) * size / numChunks; i++) {
+      rr += r[i] * r[i];
+      ru += r[i] * u[i];
+      wu += w[i] * u[i];
+    }
+
+    partialSums[3 * chunk] = rr;
+    partialSums[3 * chunk + 1] = ru;
+    partialSums[3 * chunk + 2] = wu;
+  }
+}
+
+void PipelinedConjugateGradients::reducePartialSums(double& rr, double& ru, double& wu) {
+  rr = 0.0;
+  ru = 0.0;
+  wu = 0.0;
+
+  for (size_t chunk = 0; chunk < numChunks; chunk++) {
+    rr += partialSums[3 * chunk];
+    ru += partialSums[3 * chunk + 1];
+    wu += partialSums[3 * chunk + 2];
+  }
+}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  const size_t n = alpha.getSize();
+  const bool preconditioned = (this->preconditioner != NULL);
+  const double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  this->nIterations = 0;
+
+  operatorDuration = 0.0;
+  preconditionerDuration = 0.0;
+  updateDuration = 0.0;
+  reductionDuration = 0.0;
+  sgpp::base::SGppStopwatch stopwatch;
+
+  size_t maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = static_cast<size_t>(omp_get_max_threads());
+#endif
+  numChunks = std::max<size_t>(std::min<size_t>(4 * maxThreads, n / 256), 1);
+  partialSums.assign(3 * numChunks, 0.0);
+
+  // without preconditioner, u = r, m = w and q = s, so these vectors are not allocated
+  sgpp::base::DataVector r(n);
+  sgpp::base::DataVector w(n);
+  sgpp::base::DataVector nVec(n);
+  sgpp::base::DataVector z(n);
+  sgpp::base::DataVector s(n);
+  sgpp::base::DataVector p(n);
+  sgpp::base::DataVector uVec(preconditioned ? n : 0);
+  sgpp::base::DataVector mVec(preconditioned ? n : 0);
+  sgpp::base::DataVector qVec(preconditioned ? n : 0);
+  sgpp::base::DataVector& u = preconditioned ? uVec : r;
+  sgpp::base::DataVector& m = preconditioned ? mVec : w;
+  sgpp::base::DataVector& q = preconditioned ? qVec : s;
+
+  double delta_0 = 0.0;
+
+  if (reuse == true) {
+    delta_0 = b.dotProduct(b) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // r = b - A*x, u = M*r, w = A*u
+  auto computeResiduals = [&]() {
+    stopwatch.start();
+    SystemMatrix.mult(alpha, r);
+    operatorDuration += stopwatch.stop();
+
+    r.mult(-1.0);
+    r.add(b);
+
+    if (preconditioned) {
+      stopwatch.start();
+      this->preconditioner->mult(r, u);
+      preconditionerDuration += stopwatch.stop();
+    }
+
+    stopwatch.start();
+    SystemMatrix.mult(u, w);
+    operatorDuration += stopwatch.stop();
+  };
+
+  computeResiduals();
+
+  double delta_new = 0.0;
+  double gamma = 0.0;
+  double delta = 0.0;
+  double gammaOld = 0.0;
+  double aOld = 0.0;
+
+  stopwatch.start();
+  computePartialSums(r.getPointer(), u.getPointer(), w.getPointer(), n);
+  updateDuration += stopwatch.stop();
+  stopwatch.start();
+  reducePartialSums(delta_new, gamma, delta);
+  reductionDuration += stopwatch.stop();
+
+  if (reuse == false) {
+    delta_0 = delta_new * epsilonSquared;
+  }
+
+  this->residuum = (delta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  while ((this->nIterations < this->nMaxIterations) && (delta_new > delta_0) &&
+         (delta_new > max_threshold)) {
+    // m = M*w, n = A*m; in a distributed setting, the reduction of gamma and delta (and the
+    // residual norm) could still be in flight here
+    if (preconditioned) {
+      stopwatch.start();
+      this->preconditioner->mult(w, m);
+      preconditionerDuration += stopwatch.stop();
+    }
+
+    stopwatch.start();
+    SystemMatrix.mult(m, nVec);
+    operatorDuration += stopwatch.stop();
+
+    double beta = 0.0;
+    double a = 0.0;
+
+    if (this->nIterations == 0) {
+      a = gamma / delta;
+    } else {
+      beta = gamma / gammaOld;
+      a = gamma / (delta - beta * gamma / aOld);
+    }
+
+    if (!std::isfinite(a)) {
+      break;
+    }
+
+    // fused update of all vectors and local parts of the dot products of the next iteration
+    stopwatch.start();
+    double* x_ = alpha.getPointer();
+    double* r_ = r.getPointer();
+    double* u_ = u.getPointer();
+    double* w_ = w.getPointer();
+    double* m_ = m.getPointer();
+    double* n_ = nVec.getPointer();
+    double* z_ = z.getPointer();
+    double* q_ = q.getPointer();
+    double* s_ = s.getPointer();
+    double* p_ = p.getPointer();
+    const size_t chunks = numChunks;
+
+#pragma omp parallel for schedule(static)
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+      double rr = 0.0;
+      double ru = 0.0;
+      double wu = 0.0;
+      const size_t end = (chunk + 1) * n / chunks;
+
+      if (preconditioned) {
+        for (size_t i = chunk * n / chunks; i < end; i++) {
+          z_[i] = n_[i] + beta * z_[i];
+          q_[i] = m_[i] + beta * q_[i];
+          s_[i] = w_[i] + beta * s_[i];
+          p_[i] = u_[i] + beta * p_[i];
+          x_[i] += a * p_[i];
+          r_[i] -= a * s_[i];
+          u_[i] -= a * q_[i];
+          w_[i] -= a * z_[i];
+          rr += r_[i] * r_[i];
+          ru += r_[i] * u_[i];
+          wu += w_[i] * u_[i];
+        }
+      } else {
+        for (size_t i = chunk * n / chunks; i < end; i++) {
+          z_[i] = n_[i] + beta * z_[i];
+          s_[i] = w_[i] + beta * s_[i];
+          p_[i] = r_[i] + beta * p_[i];
+          x_[i] += a * p_[i];
+          r_[i] -= a * s_[i];
+          w_[i] -= a * z_[i];
+          rr += r_[i] * r_[i];
+          wu += w_[i] * r_[i];
+        }
+
+        ru = rr;
+      }
+
+      partialSums[3 * chunk] = rr;
+      partialSums[3 * chunk + 1] = ru;
+      partialSums[3 * chunk + 2] = wu;
+    }
+
+    updateDuration += stopwatch.stop();
+    gammaOld = gamma;
+    aOld = a;
+
+    if ((this->nIterations % 50) == 0 && this->nIterations > 0) {
+      // replace the recursively updated residuals and search directions to limit the loss of
+      // accuracy: s = A*p, q = M*s, z = A*q
+      computeResiduals();
+
+      stopwatch.start();
+      SystemMatrix.mult(p, s);
+
+      if (preconditioned) {
+        operatorDuration += stopwatch.stop();
+        stopwatch.start();
+        this->preconditioner->mult(s, q);
+        preconditionerDuration += stopwatch.stop();
+        stopwatch.start();
+      }
+
+      SystemMatrix.mult(q, z);
+      operatorDuration += stopwatch.stop();
+
+      stopwatch.start();
+      computePartialSums(r.getPointer(), u.getPointer(), w.getPointer(), n);
+      updateDuration += stopwatch.stop();
+    }
+
+    stopwatch.start();
+    reducePartialSums(delta_new, gamma, delta);
+    reductionDuration += stopwatch.stop();
+
+    this->residuum = delta_new;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << delta_new << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = delta_new;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << delta_new << std::endl;
+    std::cout << "Time operator: " << operatorDuration
+              << "s, preconditioner: " << preconditionerDuration
+              << "s, updates: " << updateDuration << "s, reductions: " << reductionDuration << "s"
+              << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
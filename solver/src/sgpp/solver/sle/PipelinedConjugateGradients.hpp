@@ -0,0 +1,102 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined (preconditioned) conjugate gradients after Ghysels and Vanroose.
+ *
+ * Compared to ConjugateGradients, the recurrences are rearranged such that all vector updates
+ * of an iteration and the three dot products needed by the next iteration are computed in a
+ * single pass over the vectors. The dot products do not depend on the following application of
+ * the system matrix (and the preconditioner), so in distributed runs their global reduction can
+ * be overlapped with it; each iteration has only one synchronization point.
+ * The price are four (six with preconditioner) additional vectors and slightly lower attainable
+ * accuracy, which is countered by recomputing the residuals from scratch every 50 iterations.
+ *
+ * The time spent in each phase of the last solve is available via the get...Duration methods.
+ */
+class PipelinedConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Constructor
+   *
+   * @param imax maximum number of iterations
+   * @param epsilon relative tolerance of the residual norm
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Destructor
+   */
+  ~PipelinedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+
+  /**
+   * @return time in seconds spent in applications of the system matrix during the last solve
+   */
+  double getOperatorDuration() const { return operatorDuration; }
+
+  /**
+   * @return time in seconds spent in applications of the preconditioner during the last solve
+   */
+  double getPreconditionerDuration() const { return preconditionerDuration; }
+
+  /**
+   * @return time in seconds spent in the fused vector updates (including the thread-local parts
+   * of the dot products) during the last solve
+   */
+  double getUpdateDuration() const { return updateDuration; }
+
+  /**
+   * @return time in seconds spent in combining the partial sums of the dot products during the
+   * last solve
+   */
+  double getReductionDuration() const { return reductionDuration; }
+
+ protected:
+  /**
+   * Computes the partial sums of r.r, r.u and w.u of each chunk of the vectors.
+   */
+  void computePartialSums(const double* r, const double* u, const double* w, size_t size);
+
+  /**
+   * Sums the partial sums of all chunks, i.e., the (global) reduction.
+   *
+   * @param[out] rr r.r
+   * @param[out] ru r.u
+   * @param[out] wu w.u
+   */
+  void reducePartialSums(double& rr, double& ru, double& wu);
+
+  /// number of chunks the vectors are split into for the fused updates
+  size_t numChunks;
+  /// partial sums r.r, r.u and w.u of each chunk
+  std::vector<double> partialSums;
+
+  double operatorDuration;
+  double preconditionerDuration;
+  double updateDuration;
+  double reductionDuration;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
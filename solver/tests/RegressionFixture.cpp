@@ -0,0 +1,82 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include "RegressionFixture.hpp"
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+RegressionMatrix::RegressionMatrix(sgpp::base::Grid& grid, DataMatrix& dataset, double lambda,
+                                   sgpp::base::OperationMatrix* regularization)
+    : op(sgpp::op_factory::createOperationMultipleEval(grid, dataset)),
+      regularization(regularization),
+      lambda(lambda),
+      numMults(0),
+      numBlockMults(0),
+      temp(dataset.getNrows()),
+      tempRegularization(grid.getSize()) {}
+
+void RegressionMatrix::mult(DataVector& alpha, DataVector& result) {
+  op->mult(alpha, temp);
+  op->multTranspose(temp, result);
+
+  if (regularization == nullptr) {
+    result.axpy(lambda, alpha);
+  } else {
+    regularization->mult(alpha, tempRegularization);
+    result.axpy(lambda, tempRegularization);
+  }
+
+  numMults++;
+}
+
+void RegressionMatrix::multBlock(DataMatrix& alpha, DataMatrix& result) {
+  DataMatrix tempBlock(temp.getSize(), alpha.getNcols());
+  op->multBlock(alpha, tempBlock);
+  op->multTransposeBlock(tempBlock, result);
+  DataMatrix regularized(alpha);
+
+  if (regularization != nullptr) {
+    DataVector column(alpha.getNrows());
+
+    for (size_t j = 0; j < alpha.getNcols(); j++) {
+      alpha.getColumn(j, column);
+      regularization->mult(column, tempRegularization);
+      regularized.setColumn(j, tempRegularization);
+    }
+  }
+
+  regularized.mult(lambda);
+  result.add(regularized);
+  numBlockMults++;
+}
+
+DataMatrix createDataset(size_t numPoints) {
+  DataMatrix dataset(numPoints, 2);
+
+  for (size_t i = 0; i < numPoints; i++) {
+    dataset.set(i, 0, std::fmod(0.5 + 0.6180339887 * static_cast<double>(i), 1.0));
+    dataset.set(i, 1, std::fmod(0.5 + 0.7548776662 * static_cast<double>(i), 1.0));
+  }
+
+  return dataset;
+}
+
+void probeDiagonal(sgpp::base::OperationMatrix& A, size_t n, DataVector& diagonal) {
+  DataVector unit(n, 0.0);
+  DataVector column(n);
+  diagonal.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    unit[i] = 1.0;
+    A.mult(unit, column);
+    diagonal[i] = column[i];
+    unit[i] = 0.0;
+  }
+}
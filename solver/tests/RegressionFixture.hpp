@@ -0,0 +1,63 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef REGRESSION_FIXTURE_HPP
+#define REGRESSION_FIXTURE_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <memory>
+
+/**
+ * Regression system B^T B + lambda * C of a sparse grid, where C is the identity or a given
+ * regularization operator. Counts its (block) applications.
+ */
+class RegressionMatrix : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * @param grid            sparse grid
+   * @param dataset         data points (one per row)
+   * @param lambda          regularization parameter
+   * @param regularization  regularization operator C (nullptr for the identity), must outlive
+   *                        the matrix
+   */
+  RegressionMatrix(sgpp::base::Grid& grid, sgpp::base::DataMatrix& dataset, double lambda,
+                   sgpp::base::OperationMatrix* regularization = nullptr);
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multBlock(sgpp::base::DataMatrix& alpha, sgpp::base::DataMatrix& result) override;
+
+  std::unique_ptr<sgpp::base::OperationMultipleEval> op;
+  sgpp::base::OperationMatrix* regularization;
+  double lambda;
+  size_t numMults;
+  size_t numBlockMults;
+
+ private:
+  sgpp::base::DataVector temp;
+  sgpp::base::DataVector tempRegularization;
+};
+
+/**
+ * @param numPoints number of points
+ * @return deterministic, well-spread 2D dataset (golden ratio sequences)
+ */
+sgpp::base::DataMatrix createDataset(size_t numPoints);
+
+/**
+ * Determines the diagonal of a matrix by applying it to the unit vectors.
+ *
+ * @param A         matrix
+ * @param n         size of the matrix
+ * @param[out] diagonal diagonal of A
+ */
+void probeDiagonal(sgpp::base::OperationMatrix& A, size_t n, sgpp::base::DataVector& diagonal);
+
+#endif /* REGRESSION_FIXTURE_HPP */
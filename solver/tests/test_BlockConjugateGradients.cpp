@@ -0,0 +1,151 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "RegressionFixture.hpp"
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/solver/sle/BlockConjugateGradients.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/JacobiPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+BOOST_AUTO_TEST_SUITE(TestBlockConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testBlockSolveMatchesColumnwiseCG) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(4);
+  DataMatrix dataset = createDataset(500);
+  RegressionMatrix A(*grid, dataset, 1e-2);
+  const size_t n = grid->getSize();
+  const size_t k = 4;
+
+  // the last right hand side is zero and must not cause any iteration
+  DataMatrix b(n, k, 0.0);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j + 1 < k; j++) {
+      b.set(i, j, std::sin(static_cast<double>((j + 1) * i)));
+    }
+  }
+
+  sgpp::solver::BlockConjugateGradients blockCG(1000, 1e-10);
+  DataMatrix x(n, k);
+  blockCG.solveBlock(A, x, b);
+
+  BOOST_CHECK_EQUAL(A.numMults, 0);
+  BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[k - 1], 0);
+  BOOST_CHECK_EQUAL(A.numBlockMults, blockCG.getNumberIterations() + 1 +
+                                         (blockCG.getNumberIterations() - 1) / 50);
+
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  DataVector bColumn(n);
+  DataVector xColumn(n);
+  DataVector xBlockColumn(n);
+
+  for (size_t j = 0; j < k; j++) {
+    b.getColumn(j, bColumn);
+    cg.solve(A, xColumn, bColumn);
+    x.getColumn(j, xBlockColumn);
+
+    if (j + 1 < k) {
+      BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[j], cg.getNumberIterations());
+    }
+
+    xBlockColumn.sub(xColumn);
+    BOOST_CHECK_SMALL(xBlockColumn.maxNorm(), 1e-8 * (1.0 + xColumn.maxNorm()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPreconditionedBlockSolve) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(4);
+  DataMatrix dataset = createDataset(500);
+  RegressionMatrix A(*grid, dataset, 1e-2);
+  const size_t n = grid->getSize();
+  const size_t k = 3;
+
+  DataMatrix b(n, k);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < k; j++) {
+      b.set(i, j, std::cos(static_cast<double>((j + 2) * i)));
+    }
+  }
+
+  DataVector diagonal(n);
+  probeDiagonal(A, n, diagonal);
+
+  sgpp::solver::JacobiPreconditioner preconditioner(diagonal);
+  sgpp::solver::BlockConjugateGradients blockCG(1000, 1e-8);
+  blockCG.setPreconditioner(&preconditioner);
+  DataMatrix x(n, k);
+  blockCG.solveBlock(A, x, b);
+
+  DataMatrix Ax(n, k);
+  A.multBlock(x, Ax);
+
+  for (size_t j = 0; j < k; j++) {
+    DataVector residual(n);
+    DataVector bColumn(n);
+    Ax.getColumn(j, residual);
+    b.getColumn(j, bColumn);
+    residual.sub(bColumn);
+    BOOST_CHECK_SMALL(residual.l2Norm() / bColumn.l2Norm(), 1e-6);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testReuseMatchesCG) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(4);
+  DataMatrix dataset = createDataset(500);
+  RegressionMatrix A(*grid, dataset, 1e-2);
+  const size_t n = grid->getSize();
+  const size_t k = 2;
+
+  DataMatrix b(n, k);
+  DataMatrix x(n, k);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < k; j++) {
+      b.set(i, j, std::sin(static_cast<double>((j + 1) * i)));
+      x.set(i, j, 0.1 * std::cos(static_cast<double>(i + j)));
+    }
+  }
+
+  DataMatrix xStart(x);
+  sgpp::solver::BlockConjugateGradients blockCG(1000, 1e-6);
+  blockCG.solveBlock(A, x, b, true);
+
+  // the tolerance of both solvers is relative to the norm of b, not to the starting residual
+  sgpp::solver::ConjugateGradients cg(1000, 1e-6);
+  DataVector bColumn(n);
+  DataVector xColumn(n);
+  DataVector xBlockColumn(n);
+
+  for (size_t j = 0; j < k; j++) {
+    b.getColumn(j, bColumn);
+    xStart.getColumn(j, xColumn);
+    cg.solve(A, xColumn, bColumn, true);
+    BOOST_CHECK_EQUAL(blockCG.getColumnIterations()[j], cg.getNumberIterations());
+
+    x.getColumn(j, xBlockColumn);
+    xBlockColumn.sub(xColumn);
+    BOOST_CHECK_SMALL(xBlockColumn.maxNorm(), 1e-8 * (1.0 + xColumn.maxNorm()));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
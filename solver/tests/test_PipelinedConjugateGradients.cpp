@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "RegressionFixture.hpp"
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+void checkAgainstCG(sgpp::base::OperationMatrix& A, DataVector& b,
+                    sgpp::base::OperationMatrix* preconditioner) {
+  const size_t n = b.getSize();
+
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+  cg.setPreconditioner(preconditioner);
+  DataVector xReference(n);
+  cg.solve(A, xReference, b);
+
+  sgpp::solver::PipelinedConjugateGradients pipelinedCG(1000, 1e-10);
+  pipelinedCG.setPreconditioner(preconditioner);
+  DataVector x(n);
+  pipelinedCG.solve(A, x, b);
+
+  DataVector residual(n);
+  A.mult(x, residual);
+  residual.sub(b);
+  BOOST_CHECK_SMALL(residual.l2Norm() / b.l2Norm(), 1e-9);
+  // rounding errors delay the convergence of the pipelined recurrences a little
+  BOOST_CHECK_LE(pipelinedCG.getNumberIterations(), cg.getNumberIterations() * 6 / 5);
+
+  x.sub(xReference);
+  BOOST_CHECK_SMALL(x.maxNorm(), 1e-7 * (1.0 + xReference.maxNorm()));
+
+  BOOST_CHECK_GT(pipelinedCG.getOperatorDuration(), 0.0);
+  BOOST_CHECK_GE(pipelinedCG.getUpdateDuration(), 0.0);
+  BOOST_CHECK_GE(pipelinedCG.getReductionDuration(), 0.0);
+  BOOST_CHECK_EQUAL(pipelinedCG.getPreconditionerDuration() > 0.0, preconditioner != NULL);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPipelinedConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testPipelinedCG) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(5);
+  DataMatrix dataset = createDataset(1000);
+  // the small regularization parameter requires more than 50 iterations, so that the residuals
+  // are replaced at least once
+  RegressionMatrix A(*grid, dataset, 1e-4);
+  const size_t n = grid->getSize();
+
+  DataVector b(n);
+
+  for (size_t i = 0; i < n; i++) {
+    b[i] = std::sin(static_cast<double>(i));
+  }
+
+  checkAgainstCG(A, b, NULL);
+
+  DataVector diagonal(n);
+  probeDiagonal(A, n, diagonal);
+
+  sgpp::solver::JacobiPreconditioner preconditioner(diagonal);
+  checkAgainstCG(A, b, &preconditioner);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,112 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "RegressionFixture.hpp"
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationDiagonal.hpp>
+#include <sgpp/solver/sle/BiCGStab.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/JacobiPreconditioner.hpp>
+#include <sgpp/solver/sle/LevelScalingPreconditioner.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+namespace {
+
+void checkSolution(sgpp::base::OperationMatrix& A, DataVector& x, DataVector& b) {
+  DataVector Ax(b.getSize());
+  A.mult(x, Ax);
+  Ax.sub(b);
+  BOOST_CHECK_SMALL(Ax.l2Norm() / b.l2Norm(), 1e-6);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPreconditioner)
+
+BOOST_AUTO_TEST_CASE(testJacobiFromOperationDiagonal) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  sgpp::base::OperationDiagonal opDiagonal(&grid->getStorage(), 0.25);
+
+  sgpp::solver::JacobiPreconditioner preconditioner(opDiagonal, grid->getSize());
+  DataVector alpha(grid->getSize(), 2.0);
+  DataVector diagonalTimesAlpha(grid->getSize());
+  DataVector result(grid->getSize());
+  opDiagonal.mult(alpha, diagonalTimesAlpha);
+  preconditioner.mult(diagonalTimesAlpha, result);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_CLOSE(result[i], 2.0, 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLevelScalingDiagonal) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(2));
+  grid->getGenerator().regular(3);
+  DataMatrix dataset = createDataset(500);
+  sgpp::base::OperationDiagonal regularization(&grid->getStorage());
+  RegressionMatrix A(*grid, dataset, 1e-3, &regularization);
+  const size_t n = grid->getSize();
+
+  sgpp::solver::LevelScalingPreconditioner preconditioner(A, grid->getStorage());
+  BOOST_CHECK_LT(preconditioner.getNumberOfProbes(), n);
+
+  // compare with the diagonal determined by unit vectors
+  DataVector diagonal(n);
+  probeDiagonal(A, n, diagonal);
+
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_CLOSE(preconditioner.getInverseDiagonal()[i], 1.0 / diagonal[i], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPreconditionedSolvers) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(5);
+  DataMatrix dataset = createDataset(1000);
+  sgpp::base::OperationDiagonal regularization(&grid->getStorage());
+  RegressionMatrix A(*grid, dataset, 1.0, &regularization);
+  const size_t n = grid->getSize();
+
+  DataVector b(n);
+  for (size_t i = 0; i < n; i++) {
+    b[i] = std::sin(static_cast<double>(i));
+  }
+
+  sgpp::solver::LevelScalingPreconditioner preconditioner(A, grid->getStorage());
+
+  sgpp::solver::ConjugateGradients cg(10000, 1e-8);
+  DataVector x(n);
+  cg.solve(A, x, b);
+  size_t iterationsPlain = cg.getNumberIterations();
+  checkSolution(A, x, b);
+
+  cg.setPreconditioner(&preconditioner);
+  cg.solve(A, x, b);
+  size_t iterationsPreconditioned = cg.getNumberIterations();
+  checkSolution(A, x, b);
+  BOOST_CHECK_LT(iterationsPreconditioned, iterationsPlain);
+
+  sgpp::solver::BiCGStab bicgstab(10000, 1e-8);
+  bicgstab.setPreconditioner(&preconditioner);
+  bicgstab.solve(A, x, b);
+  checkSolution(A, x, b);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,249 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/solver/ode/AdamsBashforth.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/ode/Euler.hpp>
+#include <sgpp/solver/ode/TimestepEngine.hpp>
+#include <sgpp/solver/ode/VarTimestep.hpp>
+#include <sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using sgpp::base::DataVector;
+using sgpp::solver::TimestepStatistics;
+
+namespace {
+
+/**
+ * System of the ODE \f$\dot{u} = -K u\f$ with the identity as mass matrix and a scaled
+ * tridiagonal matrix \f$K\f$ (1D finite differences), the grid is only used for its size.
+ */
+class HeatSystem : public sgpp::solver::OperationParabolicPDESolverSystem {
+ public:
+  HeatSystem(sgpp::base::Grid& grid, double timestepSize) {
+    const size_t n = grid.getSize();
+    BoundGrid = &grid;
+    alpha_complete = new DataVector(n);
+    rhs = NULL;
+    oldGridStorage = NULL;
+    secondGridStorage = NULL;
+    TimestepSize = timestepSize;
+    TimestepSize_old = timestepSize;
+
+    for (size_t i = 0; i < n; i++) {
+      const double x = static_cast<double>(i + 1) / static_cast<double>(n + 1);
+      (*alpha_complete)[i] = x * x * (1.0 - x);
+    }
+
+    alpha_complete_old = new DataVector(*alpha_complete);
+    alpha_complete_tmp = new DataVector(*alpha_complete);
+  }
+
+  ~HeatSystem() override {
+    delete alpha_complete;
+    delete alpha_complete_old;
+    delete alpha_complete_tmp;
+    delete oldGridStorage;
+    delete secondGridStorage;
+    delete rhs;
+  }
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    if (tOperationMode == "ImEul") {
+      applyK(alpha, result);
+      result.mult(TimestepSize);
+      result.add(alpha);
+    } else if (tOperationMode == "CrNic") {
+      applyK(alpha, result);
+      result.mult(0.5 * TimestepSize);
+      result.add(alpha);
+    } else {
+      result = alpha;
+    }
+  }
+
+  DataVector* generateRHS() override {
+    DataVector& u = *alpha_complete;
+    DataVector temp(u.getSize());
+    delete rhs;
+    rhs = new DataVector(u);
+
+    if (tOperationMode == "ExEul") {
+      applyK(u, temp);
+      rhs->axpy(-TimestepSize, temp);
+    } else if (tOperationMode == "CrNic") {
+      applyK(u, temp);
+      rhs->axpy(-0.5 * TimestepSize, temp);
+    } else if (tOperationMode == "AdBas") {
+      const double ratio = TimestepSize / TimestepSize_old;
+      applyK(u, temp);
+      rhs->axpy(-TimestepSize * (1.0 + 0.5 * ratio), temp);
+      applyK(*alpha_complete_old, temp);
+      rhs->axpy(TimestepSize * 0.5 * ratio, temp);
+    }
+
+    return rhs;
+  }
+
+  void finishTimestep() override {}
+
+  void coarsenAndRefine(bool /*isLastTimestep*/ = false) override {}
+
+  void startTimestep() override {}
+
+  DataVector* getGridCoefficientsForCG() override { return alpha_complete; }
+
+ protected:
+  void applyK(const DataVector& alpha, DataVector& result) {
+    const size_t n = alpha.getSize();
+    const double c = static_cast<double>((n + 1) * (n + 1));
+
+    for (size_t i = 0; i < n; i++) {
+      result[i] = 2.0 * alpha[i];
+
+      if (i > 0) result[i] -= alpha[i - 1];
+      if (i < n - 1) result[i] -= alpha[i + 1];
+
+      result[i] *= c;
+    }
+  }
+};
+
+/**
+ * Solves the ODE with the given solver and returns the final coefficients.
+ */
+DataVector solveODE(sgpp::solver::ODESolver& odeSolver, sgpp::base::Grid& grid,
+                    double timestepSize, const std::string& mode,
+                    std::vector<TimestepStatistics>& statistics) {
+  HeatSystem system(grid, timestepSize);
+  system.setODESolver(mode);
+  sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+
+  statistics.clear();
+  odeSolver.getTimestepEngine().setCallback(
+      [&statistics](const TimestepStatistics& s) { statistics.push_back(s); });
+  odeSolver.solve(cg, system, false, false);
+
+  return *system.getGridCoefficients();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestTimestepEngine)
+
+BOOST_AUTO_TEST_CASE(testWarmStart) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(1));
+  grid->getGenerator().regular(6);
+
+  const size_t numberTimesteps = 20;
+  const double timestepSize = 1e-3;
+  std::vector<TimestepStatistics> statistics;
+
+  sgpp::solver::Euler implicitEuler("ImEul", numberTimesteps, timestepSize);
+  sgpp::solver::CrankNicolson crankNicolson(numberTimesteps, timestepSize);
+  sgpp::solver::AdamsBashforth adamsBashforth(numberTimesteps, timestepSize);
+  std::vector<std::pair<sgpp::solver::ODESolver*, std::string>> odeSolvers = {
+      {&implicitEuler, "ImEul"}, {&crankNicolson, "CrNic"}, {&adamsBashforth, "AdBas"}};
+
+  for (auto& odeSolver : odeSolvers) {
+    sgpp::solver::TimestepEngine& engine = odeSolver.first->getTimestepEngine();
+    BOOST_CHECK(engine.getWarmStart());
+
+    engine.setWarmStart(false);
+    DataVector reference = solveODE(*odeSolver.first, *grid, timestepSize, odeSolver.second,
+                                    statistics);
+    const size_t iterationsCold = engine.getTotalIterations();
+
+    engine.setWarmStart(true);
+    DataVector alpha = solveODE(*odeSolver.first, *grid, timestepSize, odeSolver.second,
+                                statistics);
+    const size_t iterationsWarm = engine.getTotalIterations();
+
+    alpha.sub(reference);
+    BOOST_CHECK_SMALL(alpha.maxNorm() / reference.maxNorm(), 1e-8);
+
+    if (odeSolver.second == "AdBas") {
+      // the mass matrix is the identity, CG converges in one iteration anyway
+      BOOST_CHECK_LE(iterationsWarm, iterationsCold);
+    } else {
+      BOOST_CHECK_LT(iterationsWarm, iterationsCold);
+    }
+
+    // statistics of each time step
+    BOOST_REQUIRE_EQUAL(statistics.size(), numberTimesteps);
+    BOOST_CHECK_EQUAL(engine.getNumberTimesteps(), numberTimesteps);
+    BOOST_CHECK_EQUAL(engine.getTotalRejections(), 0U);
+    size_t iterations = 0;
+
+    for (size_t i = 0; i < numberTimesteps; i++) {
+      BOOST_CHECK_EQUAL(statistics[i].step, i);
+      BOOST_CHECK_CLOSE(statistics[i].time, static_cast<double>(i + 1) * timestepSize, 1e-10);
+      BOOST_CHECK_EQUAL(statistics[i].timestepSize, timestepSize);
+      BOOST_CHECK_EQUAL(statistics[i].rejections, 0U);
+      BOOST_CHECK_GE(statistics[i].wallTime, 0.0);
+      iterations += statistics[i].iterations;
+    }
+
+    BOOST_CHECK_EQUAL(iterations, iterationsWarm);
+    BOOST_CHECK_EQUAL(engine.getLastStatistics().step, numberTimesteps - 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testStepsizeControl) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(1));
+  grid->getGenerator().regular(5);
+
+  const size_t numberTimesteps = 10;
+  const double timestepSize = 1e-3;
+  const double epsilon = 1e-5;
+  std::vector<TimestepStatistics> statistics;
+
+  {
+    sgpp::solver::VarTimestep varTimestep("AdBas", "CrNic", numberTimesteps, timestepSize,
+                                          epsilon);
+    solveODE(varTimestep, *grid, timestepSize, "CrNic", statistics);
+    const sgpp::solver::TimestepEngine& engine = varTimestep.getTimestepEngine();
+
+    BOOST_REQUIRE_EQUAL(statistics.size(), engine.getNumberTimesteps());
+    BOOST_REQUIRE_GT(statistics.size(), 0U);
+    size_t rejections = 0;
+    size_t iterations = 0;
+    double time = 0.0;
+
+    for (size_t i = 0; i < statistics.size(); i++) {
+      BOOST_CHECK_EQUAL(statistics[i].step, i);
+      time += statistics[i].timestepSize;
+      BOOST_CHECK_CLOSE(statistics[i].time, time, 1e-10);
+      rejections += statistics[i].rejections;
+      iterations += statistics[i].iterations;
+    }
+
+    // the last time step ends at the final time
+    BOOST_CHECK_CLOSE(time, static_cast<double>(numberTimesteps) * timestepSize, 1e-8);
+    BOOST_CHECK_EQUAL(rejections, engine.getTotalRejections());
+    BOOST_CHECK_LE(iterations, engine.getTotalIterations());
+  }
+
+  // remove the time step log written by VarTimestep
+  std::stringstream filename;
+  filename << "Time_VaTim" << epsilon << ".gnuplot";
+  std::remove(filename.str().c_str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()